@@ -104,6 +104,7 @@
 #define SDL_asyncio_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_properties.h>
 
 #include <SDL3/SDL_begin_code.h>
 /* Set up for C function definitions, even when using C++ */
@@ -164,6 +165,47 @@ typedef struct SDL_AsyncIOOutcome
     void *userdata;    /**< pointer provided by the app when starting the task */
 } SDL_AsyncIOOutcome;
 
+/**
+ * The priority of the tasks in an async I/O task queue.
+ *
+ * Backends that schedule the I/O work themselves, like the thread pool SDL
+ * uses when the platform doesn't offer efficient async I/O, start pending
+ * tasks from higher priority queues first, so a queue that streams audio can
+ * be kept ahead of a queue that prefetches assets in the background.
+ * Backends that hand requests straight to the operating system ignore this.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAsyncIOQueueWithProperties
+ */
+typedef enum SDL_AsyncIOQueuePriority
+{
+    SDL_ASYNCIO_PRIORITY_LOW,     /**< background work, like prefetching. */
+    SDL_ASYNCIO_PRIORITY_NORMAL,  /**< the default. */
+    SDL_ASYNCIO_PRIORITY_HIGH     /**< latency sensitive work, like streaming audio. */
+} SDL_AsyncIOQueuePriority;
+
+/**
+ * Statistics about the tasks in an async I/O task queue.
+ *
+ * Latency is measured from the moment a task is started until it's
+ * finished, which might be a little later than the data arrived, depending on
+ * the backend.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAsyncIOQueueStats
+ */
+typedef struct SDL_AsyncIOQueueStats
+{
+    Uint64 tasks_started;     /**< number of tasks started on this queue. */
+    Uint64 tasks_completed;   /**< number of tasks whose results were returned from this queue. */
+    int tasks_pending;        /**< number of tasks currently started but not returned yet, the queue depth. */
+    int max_tasks_pending;    /**< the largest queue depth seen. */
+    Uint64 total_latency_ns;  /**< total latency of the completed tasks, in nanoseconds. Divide by `tasks_completed` for the average. */
+    Uint64 max_latency_ns;    /**< the largest latency of a completed task, in nanoseconds. */
+} SDL_AsyncIOQueueStats;
+
 /**
  * A queue of completed asynchronous I/O tasks.
  *
@@ -381,6 +423,134 @@ extern SDL_DECLSPEC bool SDLCALL SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flu
  */
 extern SDL_DECLSPEC SDL_AsyncIOQueue * SDLCALL SDL_CreateAsyncIOQueue(void);
 
+/**
+ * Create a task queue for tracking multiple I/O operations, with the
+ * specified properties.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_ASYNCIOQUEUE_CREATE_ENTRIES_NUMBER`: the number of I/O requests
+ *   the queue can submit to the operating system at once, if the platform
+ *   has a fixed size submission queue (like Linux's io_uring). More requests
+ *   than this can still be pending. Defaults to 128.
+ * - `SDL_PROP_ASYNCIOQUEUE_CREATE_SQPOLL_BOOLEAN`: true if the kernel should
+ *   poll the submission queue from a thread of its own, so submitting
+ *   requests doesn't need a system call at all while the queue is busy. This
+ *   costs a kernel thread per queue that spins for a short time after each
+ *   submission, so it's only worth it for queues that are kept very busy.
+ *   This is only supported with io_uring and might need extra privileges on
+ *   older kernels; it's silently ignored when it's not available. Defaults
+ *   to false.
+ * - `SDL_PROP_ASYNCIOQUEUE_CREATE_PRIORITY_NUMBER`: an SDL_AsyncIOQueuePriority
+ *   value for the tasks in this queue. Defaults to
+ *   SDL_ASYNCIO_PRIORITY_NORMAL.
+ *
+ * \param props the properties to use.
+ * \returns a new task queue object or NULL if there was an error; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAsyncIOQueue
+ * \sa SDL_DestroyAsyncIOQueue
+ */
+extern SDL_DECLSPEC SDL_AsyncIOQueue * SDLCALL SDL_CreateAsyncIOQueueWithProperties(SDL_PropertiesID props);
+
+#define SDL_PROP_ASYNCIOQUEUE_CREATE_ENTRIES_NUMBER     "SDL.asyncioqueue.create.entries"
+#define SDL_PROP_ASYNCIOQUEUE_CREATE_SQPOLL_BOOLEAN     "SDL.asyncioqueue.create.sqpoll"
+#define SDL_PROP_ASYNCIOQUEUE_CREATE_PRIORITY_NUMBER    "SDL.asyncioqueue.create.priority"
+
+/**
+ * Get statistics about the tasks in an async I/O task queue.
+ *
+ * \param queue the task queue to query.
+ * \param stats filled in with the statistics for this queue.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetAsyncIOQueueStats(SDL_AsyncIOQueue *queue, SDL_AsyncIOQueueStats *stats);
+
+/**
+ * Start collecting I/O tasks on a queue to submit them all at once.
+ *
+ * Until the matching SDL_SubmitAsyncIOBatch() call, reads, writes and
+ * closes that are started on this queue are prepared but not handed to the
+ * operating system, so hundreds of small requests can be submitted with a
+ * single system call. Batches can be nested; only the outermost
+ * SDL_SubmitAsyncIOBatch() call submits the tasks.
+ *
+ * Tasks in an open batch don't make progress, so don't wait for their
+ * results before submitting the batch. On platforms that can't submit
+ * requests in bulk, the tasks are started immediately as usual, so the
+ * results may also arrive before the batch is submitted.
+ *
+ * \param queue the task queue to batch tasks on.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but tasks
+ *               that other threads start on the same queue will be part of
+ *               the batch, too.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BeginAsyncIOBatch(SDL_AsyncIOQueue *queue);
+
+/**
+ * Submit the I/O tasks collected since SDL_BeginAsyncIOBatch().
+ *
+ * \param queue the task queue to submit.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BeginAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitAsyncIOBatch(SDL_AsyncIOQueue *queue);
+
+/**
+ * Register memory buffers that I/O tasks on a queue will use repeatedly.
+ *
+ * Reads and writes on this queue whose `ptr` and `size` fall entirely inside
+ * one of the registered buffers can skip mapping the memory in the kernel for
+ * every request, which matters when streaming many small pieces of data.
+ * Other memory keeps working as usual.
+ *
+ * This replaces any buffers that were registered on this queue before. Pass
+ * zero buffers to unregister everything. Don't change the registration while
+ * tasks using the registered buffers are still pending, and don't free the
+ * buffers while they are registered.
+ *
+ * On platforms that don't support registered buffers, this function
+ * succeeds and does nothing.
+ *
+ * \param queue the task queue that will use the buffers.
+ * \param buffers an array of pointers to the start of each buffer.
+ * \param sizes an array with the size of each buffer, in bytes.
+ * \param num_buffers the number of buffers in the arrays.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ReadAsyncIO
+ * \sa SDL_WriteAsyncIO
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RegisterAsyncIOBuffers(SDL_AsyncIOQueue *queue, void * const *buffers, const size_t *sizes, int num_buffers);
+
 /**
  * Destroy a previously-created async I/O task queue.
  *
@@ -1245,6 +1245,66 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetAudioStreamGain(SDL_AudioStream *stream
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain);
 
+/**
+ * The quality of the resampler an audio stream uses when its input and output
+ * frequencies differ.
+ *
+ * Higher quality resampling keeps more of the original sound and adds less
+ * noise, but takes more CPU time.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetAudioStreamResampleQuality
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_LINEAR,  /**< Linear interpolation between neighboring samples. Very cheap, but dulls high frequencies and can alias; fine for short sound effects. */
+    SDL_AUDIO_RESAMPLE_MEDIUM,  /**< A windowed sinc filter, the default. */
+    SDL_AUDIO_RESAMPLE_HIGH     /**< A longer windowed sinc filter with a sharper cutoff, for music and other audio where quality matters most. */
+} SDL_AudioResampleQuality;
+
+/**
+ * Get the resampling quality of an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \param quality a pointer filled in with the current resampling quality.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetAudioStreamResampleQuality
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetAudioStreamResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality *quality);
+
+/**
+ * Change the resampling quality of an audio stream.
+ *
+ * This only matters when the stream has to resample, because its input and
+ * output frequencies differ or its frequency ratio isn't 1.0f.
+ *
+ * Audio streams default to SDL_AUDIO_RESAMPLE_MEDIUM.
+ *
+ * This may be changed at any time; the new quality is used from the next
+ * audio the stream produces.
+ *
+ * \param stream the stream on which the quality is being changed.
+ * \param quality the new resampling quality.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAudioStreamResampleQuality
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality);
+
 /**
  * Get the current input channel map of an audio stream.
  *
@@ -1518,6 +1578,48 @@ typedef void (SDLCALL *SDL_AudioStreamDataCompleteCallback)(void *userdata, cons
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
 
+/**
+ * Give an audio stream a fixed-size ring buffer for its input.
+ *
+ * Once a stream has a ring buffer, SDL_PutAudioStreamData() copies into it
+ * without allocating memory or locking the stream, and the stream reads
+ * straight out of the ring the next time it's used with its lock held,
+ * usually when an audio device reads from it. This makes frequent small puts
+ * (voice chat, synthesized audio, etc) cheap, and keeps them from contending
+ * with the audio device thread for the stream lock. Data stays in the ring
+ * until it has been read from the stream, so the ring needs to be large
+ * enough for everything put into it that hasn't been read yet.
+ *
+ * The ring only supports a single producer: while it is in use, no more than
+ * one thread may call SDL_PutAudioStreamData() on the stream at a time. If
+ * there isn't room in the ring for all of `len`, SDL_PutAudioStreamData()
+ * fails and puts nothing; call SDL_GetAudioStreamQueued() or wait for the
+ * stream to be read before trying again. A stream bound to a recording device
+ * drops audio that doesn't fit.
+ *
+ * Other ways of adding data, like SDL_PutAudioStreamDataNoCopy(), still work
+ * and take the lock, and data already in the ring is kept in front of theirs.
+ *
+ * The size of the ring is rounded up to a power of two, and can't be more
+ * than 1 GiB. Setting `len` to zero removes the ring. Any data still in the
+ * old ring is moved to the stream's queue first, so nothing is lost.
+ *
+ * \param stream the audio stream to change.
+ * \param len the size of the ring, in bytes, or 0 to remove it.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but no
+ *               other thread may be putting data into the stream at the same
+ *               time, and it fails for a stream bound to a recording device.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_GetAudioStreamQueued
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamRingBuffer(SDL_AudioStream *stream, int len);
+
 /**
  * Add data to the stream with each channel in a separate array.
  *
@@ -2252,6 +2354,77 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * Create an audio stream that decodes a WAVE file as it is played.
+ *
+ * Unlike SDL_LoadWAV_IO(), this doesn't load the whole file into memory.
+ * The headers are read and checked right away, and the returned stream has a
+ * get callback (see SDL_SetAudioStreamGetCallback) that reads and decodes
+ * more of the file whenever the stream needs more data. Memory use stays
+ * constant no matter how long the file is, and playback can start as soon as
+ * this function returns. This is a good fit for long music and voice-over
+ * tracks.
+ *
+ * The input side of the stream uses the format of the WAVE data. The output
+ * side uses `dst_spec`, or the same format as the input if `dst_spec` is
+ * NULL. When the end of the data is reached, the stream is flushed, so
+ * SDL_GetAudioStreamQueued() drops to zero once everything has been played.
+ *
+ * The same formats, hints and leniency as SDL_LoadWAV_IO() apply. If the
+ * data turns out to be truncated while it is being decoded, playback just
+ * stops at that point.
+ *
+ * `src` is read from whichever thread asks the stream for data. For a stream
+ * bound to an audio device, that is the device's audio thread. `src` must not
+ * be used by anything else while the stream exists, and it must support
+ * seeking.
+ *
+ * Replacing the stream's get callback stops the decoding. Destroying the
+ * stream frees the decoder, and closes `src` if `closeio` is true.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the stream is
+ *                destroyed, or before returning if this function fails.
+ * \param dst_spec the format details of the output audio, or NULL to use the
+ *                 format of the WAVE data.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAudioStreamFromWAV
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_IO
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStreamFromWAV_IO(SDL_IOStream *src, bool closeio, const SDL_AudioSpec *dst_spec);
+
+/**
+ * Create an audio stream that decodes a WAVE file from a file path as it is
+ * played.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_CreateAudioStreamFromWAV_IO(SDL_IOFromFile(path, "rb"), true, dst_spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param dst_spec the format details of the output audio, or NULL to use the
+ *                 format of the WAVE data.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAudioStreamFromWAV_IO
+ * \sa SDL_DestroyAudioStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStreamFromWAV(const char *path, const SDL_AudioSpec *dst_spec);
+
 /**
  * Mix audio data in a specified format.
  *
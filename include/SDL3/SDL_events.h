@@ -1305,6 +1305,71 @@ extern SDL_DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PollEvent(SDL_Event *event);
 
+/**
+ * Poll for currently pending events, returning as many as possible at once.
+ *
+ * This behaves like calling SDL_PollEvent() in a loop, but moves up to
+ * `numevents` events out of the queue while holding the queue lock only
+ * once, which is much cheaper when many events are pending (high frequency
+ * mouse, pen or touch motion, for example).
+ *
+ * Events are returned in the order they were queued, after they have passed
+ * through the event filter and event watchers. Like SDL_PollEvent(), this
+ * function stops at the end of the current poll cycle, so a steady stream of
+ * new events can't keep the caller busy forever. If this function returns
+ * `numevents`, there may be more events from this cycle still pending:
+ *
+ * ```c
+ * SDL_Event events[128];
+ * int i, count;
+ * do {
+ *     count = SDL_PollEvents(events, SDL_arraysize(events));
+ *     for (i = 0; i < count; ++i) {
+ *         // decide what to do with events[i]
+ *     }
+ * } while (count == SDL_arraysize(events));
+ * ```
+ *
+ * The memory referenced by returned events (text input, dropped files, etc.)
+ * stays valid until the next call to SDL_PumpEvents(), just like with
+ * SDL_PollEvent().
+ *
+ * As this function may implicitly call SDL_PumpEvents(), you can only call
+ * this function in the thread that set the video mode.
+ *
+ * \param events an array of SDL_Event structures to be filled with events
+ *               from the queue.
+ * \param numevents the number of entries available in `events`.
+ * \returns the number of events stored in `events`, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_PollEvent
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event *events, int numevents);
+
+/**
+ * Get the number of motion events that have been merged into earlier events.
+ *
+ * When SDL_HINT_EVENT_COALESCE_MOTION is enabled, consecutive motion events
+ * from the same device are merged in the event queue rather than queued
+ * separately. This returns how many events have been merged that way since
+ * the event subsystem was initialized.
+ *
+ * \returns the number of events merged into other events.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_HINT_EVENT_COALESCE_MOTION
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetCoalescedEventCount(void);
+
 /**
  * Wait indefinitely for the next available event.
  *
@@ -502,6 +502,112 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetPathInfo(const char *path, SDL_PathInfo
  */
 extern SDL_DECLSPEC char ** SDLCALL SDL_GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count);
 
+/**
+ * A cache of directory listings, for globbing the same tree many times.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateDirectoryCache
+ * \sa SDL_GlobDirectoryCache
+ */
+typedef struct SDL_DirectoryCache SDL_DirectoryCache;
+
+/**
+ * Create a cache of the listings of a directory tree.
+ *
+ * SDL_GlobDirectoryCache() returns the same results as SDL_GlobDirectory(),
+ * but the first glob to walk through a directory keeps its listing in the
+ * cache, so later globs over the same part of the tree only match names in
+ * memory. This makes it cheap to glob a large asset tree over and over, like
+ * when looking for changed files to reload.
+ *
+ * On platforms that can report changes to directories, like Linux, the cache
+ * notices when files are created, deleted, or renamed, and reads those
+ * directories again the next time they're globbed. Elsewhere, the cache
+ * doesn't change until SDL_InvalidateDirectoryCache() is called.
+ *
+ * Nothing is read from `path` until the first glob.
+ *
+ * \param path the path of the directory tree to cache.
+ * \returns a new directory cache on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateStorageDirectoryCache
+ * \sa SDL_DestroyDirectoryCache
+ * \sa SDL_GlobDirectoryCache
+ * \sa SDL_InvalidateDirectoryCache
+ */
+extern SDL_DECLSPEC SDL_DirectoryCache * SDLCALL SDL_CreateDirectoryCache(const char *path);
+
+/**
+ * Enumerate a cached directory tree, filtered by pattern, and return a list.
+ *
+ * This takes the same patterns and flags as SDL_GlobDirectory() and returns
+ * the same list, with paths relative to the root of the cache. Directories
+ * that haven't been globbed before, or that changed since, are read from the
+ * filesystem; everything else comes from the cache. Path components of
+ * `pattern` without wildcards are looked up directly, so a pattern that
+ * starts with directory names only visits the directories it names.
+ *
+ * \param cache the directory cache to search.
+ * \param pattern the pattern that files in the directory must match. Can be
+ *                NULL.
+ * \param flags `SDL_GLOB_*` bitflags that affect this search.
+ * \param count on return, will be set to the number of items in the returned
+ *              array. Can be NULL.
+ * \returns an array of strings on success or NULL on failure; call
+ *          SDL_GetError() for more information. This is a single allocation
+ *          that should be freed with SDL_free() when it is no longer needed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateDirectoryCache
+ * \sa SDL_GlobDirectory
+ */
+extern SDL_DECLSPEC char ** SDLCALL SDL_GlobDirectoryCache(SDL_DirectoryCache *cache, const char *pattern, SDL_GlobFlags flags, int *count);
+
+/**
+ * Mark part of a directory cache as out of date.
+ *
+ * The directory at `path`, and every directory below it, is read again the
+ * next time a glob walks through it. If `path` is NULL, or isn't a directory
+ * that the cache has read yet, the whole cache is invalidated.
+ *
+ * \param cache the directory cache to invalidate.
+ * \param path the directory to invalidate, relative to the root of the cache,
+ *             or NULL for the whole cache.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GlobDirectoryCache
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_InvalidateDirectoryCache(SDL_DirectoryCache *cache, const char *path);
+
+/**
+ * Destroy a directory cache.
+ *
+ * \param cache the directory cache to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               no other thread is using `cache`.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateDirectoryCache
+ * \sa SDL_CreateStorageDirectoryCache
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyDirectoryCache(SDL_DirectoryCache *cache);
+
 /**
  * Get what the system believes is the "current working directory."
  *
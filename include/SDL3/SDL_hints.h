@@ -821,6 +821,32 @@ extern "C" {
  */
 #define SDL_HINT_EVDEV_DEVICES "SDL_EVDEV_DEVICES"
 
+/**
+ * A variable controlling whether consecutive motion events are merged in the
+ * internal event queue.
+ *
+ * When enabled, a mouse, pen, finger, joystick axis or gamepad axis motion
+ * event that is pushed while the most recently queued event is a motion
+ * event of the same type, from the same device and window, replaces that
+ * event instead of taking a new slot in the queue. Relative motion (`xrel`
+ * and `yrel` for the mouse, `dx` and `dy` for fingers) is accumulated, so no
+ * movement is lost, and the rest of the event reflects the newest state.
+ * This bounds queue growth when the application stalls for a while.
+ *
+ * The number of merged events can be queried with
+ * SDL_GetCoalescedEventCount().
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Every motion event is queued separately. (default)
+ * - "1": Consecutive motion events are merged.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION "SDL_EVENT_COALESCE_MOTION"
+
 /**
  * A variable controlling verbosity of the logging of SDL events pushed onto
  * the internal queue.
@@ -845,6 +871,33 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING "SDL_EVENT_LOGGING"
 
+/**
+ * A variable controlling the size of the lock-free ring used to stage events
+ * pushed onto the internal queue.
+ *
+ * By default every call to SDL_PushEvent() or SDL_PeepEvents() with
+ * SDL_ADDEVENT takes the event queue lock, so threads that push many events
+ * contend with the thread that is polling for them. When this hint is set to
+ * a non-zero value, events are instead written into a bounded
+ * multi-producer ring without taking the lock, and are moved into the event
+ * queue the next time it is examined. Events are still delivered in the
+ * order they were pushed, and SDL_PeepEvents() filtering works as usual.
+ *
+ * Events that carry temporary memory (text input, drag and drop, clipboard)
+ * and events pushed while the ring is full always go through the locked
+ * path.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Don't use a lock-free ring. (default)
+ * - N: Use a ring with at least N slots, rounded up to a power of two.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_EVENT_QUEUE_RING_SIZE "SDL_EVENT_QUEUE_RING_SIZE"
+
 /**
  * A variable controlling whether raising the window should be done more
  * forcefully.
@@ -3226,6 +3279,55 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling whether the renderer optimizes its command queue
+ * before handing it to the rendering backend.
+ *
+ * Redundant draw color, viewport and clip rectangle changes are dropped,
+ * draws are moved next to earlier draws with the same texture and state as
+ * long as they don't overlap anything they're moved past, and consecutive
+ * geometry with the same state is merged into a single draw. Since only
+ * draws that don't overlap change places, the result is the same with every
+ * blend mode.
+ *
+ * This mostly helps scenes that alternate between a few textures for many
+ * small draws, like sprites and tiles from several atlases. Use
+ * SDL_GetRenderCommandStats() to see what the optimization does for a frame.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Commands are handed to the backend in the order they were queued.
+ *   (default)
+ * - "1": Commands are optimized before they're handed to the backend.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_RENDER_OPTIMIZE_COMMANDS "SDL_RENDER_OPTIMIZE_COMMANDS"
+
+/**
+ * A variable controlling how many threads the software renderer may use.
+ *
+ * The render target is split into tiles and clears, rectangle fills,
+ * unscaled texture copies and geometry are sorted into the tiles they touch.
+ * Each tile then draws its commands in submission order on an internal pool
+ * of worker threads, so the output is identical to drawing on a single
+ * thread. Other commands, and targets that are too small to split, are
+ * always drawn on the calling thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "1": Draw on the calling thread only. (default)
+ * - "0": Use one thread per logical CPU core.
+ * - "N": Split the work across up to N threads.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -3391,6 +3493,9 @@ extern "C" {
  * user to force a specific target, such as "pc" if, say, you are on Steam but
  * want to avoid SteamRemoteStorage for title data.
  *
+ * Setting this to "pack" serves title storage from a .zip archive, whose
+ * path is passed as the `override` parameter of SDL_OpenTitleStorage().
+ *
  * This hint should be set before SDL is initialized.
  *
  * \since This hint is available since SDL 3.2.0.
@@ -3411,6 +3516,27 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many threads SDL_StretchSurface() and
+ * SDL_BlitSurfaceScaled() may use.
+ *
+ * Large scales can be split into bands of rows that are processed in
+ * parallel on an internal pool of worker threads. The output is identical to
+ * scaling on a single thread. Scales that are too small to benefit are always
+ * done on the calling thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "1": Scale on the calling thread only. (default)
+ * - "0": Use one thread per logical CPU core.
+ * - "N": Split the work across up to N threads.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_SURFACE_STRETCH_THREADS "SDL_SURFACE_STRETCH_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
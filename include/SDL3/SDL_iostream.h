@@ -229,6 +229,14 @@ typedef struct SDL_IOStream SDL_IOStream;
  * effect. For example, "t" is sometimes appended to make explicit the file is
  * a text file.
  *
+ * An "m" character can be added to a read-only mode ("rbm") to map the file
+ * into memory instead of reading it through the C runtime, which avoids a
+ * system call and a copy for every read. Such a stream is read-only, and
+ * behaves like one created with SDL_IOFromConstMem(), including the memory
+ * properties. If the file can't be mapped (it's empty or not a regular file,
+ * or the platform doesn't support it), this falls back to opening the file
+ * as if "m" wasn't there. The file shouldn't be modified while it's mapped.
+ *
  * This function supports Unicode filenames, but they must be encoded in UTF-8
  * format, regardless of the underlying operating system.
  *
@@ -257,6 +265,10 @@ typedef struct SDL_IOStream SDL_IOStream;
  *   to an Android NDK `AAsset *`, that this SDL_IOStream is using to access
  *   the filesystem. If SDL used some other method to access the filesystem,
  *   this property will not be set.
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: the start of the file's contents, if
+ *   the file was mapped into memory with the "m" mode flag.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: the size of the file, if it was
+ *   mapped into memory with the "m" mode flag.
  *
  * \param file a UTF-8 string representing the filename to open.
  * \param mode an ASCII string representing the mode to be used for opening
@@ -416,6 +428,54 @@ extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromDynamicMem(void);
 #define SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER    "SDL.iostream.dynamic.memory"
 #define SDL_PROP_IOSTREAM_DYNAMIC_CHUNKSIZE_NUMBER  "SDL.iostream.dynamic.chunksize"
 
+/**
+ * Use this function to create an SDL_IOStream that buffers another stream.
+ *
+ * Reads fill a buffer of `buffer_size` bytes from `src` at a time, so lots of
+ * small reads, like SDL_ReadU32LE() or walking the chunks of a file format,
+ * are served from memory instead of reaching the operating system each time.
+ * Reads at least as big as the buffer go straight to `src`. Writes are
+ * collected in the same buffer and written to `src` in one piece when it
+ * fills up, when the stream is flushed or closed, or before anything that
+ * needs `src` to be up to date, like reading or seeking outside the buffer.
+ * Seeking within the data that is already buffered doesn't touch `src`.
+ *
+ * This is most useful for streams that don't buffer on their own, like the
+ * ones from SDL_IOFromFD() or SDL_OpenIO().
+ *
+ * Don't use `src` directly while the buffered stream is open. If `closeio`
+ * is false, `src` is left positioned where the buffered stream was when it
+ * is closed.
+ *
+ * The following properties are set on the new stream:
+ *
+ * - `SDL_PROP_IOSTREAM_BUFFERED_SOURCE_POINTER`: the stream being buffered.
+ * - `SDL_PROP_IOSTREAM_BUFFERED_SIZE_NUMBER`: the size of the buffer, in
+ *   bytes.
+ *
+ * \param src the stream to buffer.
+ * \param buffer_size the size of the buffer in bytes, or 0 to use a default
+ *                    size.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the buffered
+ *                stream is closed, even in the case of an error.
+ * \returns a pointer to a new SDL_IOStream structure or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety Do not use the same SDL_IOStream from two threads at once.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseIO
+ * \sa SDL_FlushIO
+ * \sa SDL_ReadIO
+ * \sa SDL_SeekIO
+ * \sa SDL_WriteIO
+ */
+extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_CreateBufferedIO(SDL_IOStream *src, size_t buffer_size, bool closeio);
+
+#define SDL_PROP_IOSTREAM_BUFFERED_SOURCE_POINTER   "SDL.iostream.buffered.source"
+#define SDL_PROP_IOSTREAM_BUFFERED_SIZE_NUMBER      "SDL.iostream.buffered.size"
+
 /* @} *//* IOFrom functions */
 
 
@@ -2678,6 +2678,47 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer *renderer);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_FlushRenderer(SDL_Renderer *renderer);
 
+/**
+ * Statistics about the commands a renderer queued for a frame.
+ *
+ * When SDL_HINT_RENDER_OPTIMIZE_COMMANDS is enabled, the difference between
+ * `commands_queued` and `commands_submitted` is what the optimization saved
+ * before the commands reached the rendering backend.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetRenderCommandStats
+ */
+typedef struct SDL_RenderCommandStats
+{
+    int commands_queued;     /**< number of commands queued by the rendering functions, including state changes. */
+    int commands_submitted;  /**< number of commands handed to the rendering backend. */
+    int commands_dropped;    /**< redundant state changes and failed commands that were dropped. */
+    int draws_reordered;     /**< draws moved next to an earlier draw with the same texture and state. */
+    int draws_merged;        /**< geometry draws merged into the draw before them. */
+    int flushes;             /**< number of times the command queue was handed to the rendering backend. */
+} SDL_RenderCommandStats;
+
+/**
+ * Get statistics about the commands queued for the last presented frame.
+ *
+ * The statistics cover everything flushed since the previous call to
+ * SDL_RenderPresent(), up to and including the last one.
+ *
+ * \param renderer the rendering context.
+ * \param stats filled in with the statistics for the last presented frame.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_HINT_RENDER_OPTIMIZE_COMMANDS
+ * \sa SDL_RenderPresent
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetRenderCommandStats(SDL_Renderer *renderer, SDL_RenderCommandStats *stats);
+
 /**
  * Get the CAMetalLayer associated with the given Metal renderer.
  *
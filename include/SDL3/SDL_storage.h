@@ -245,6 +245,7 @@
 
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_error.h>
+#include <SDL3/SDL_asyncio.h>
 #include <SDL3/SDL_filesystem.h>
 #include <SDL3/SDL_properties.h>
 
@@ -402,6 +403,36 @@ extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenUserStorage(const char *org, c
  */
 extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenFileStorage(const char *path);
 
+/**
+ * Opens up a read-only container for the contents of a .zip archive.
+ *
+ * The archive's directory is read once, when it's opened, so getting path
+ * info, enumerating and globbing never touch the filesystem, and reading a
+ * file only reads from the one open archive. This is much faster than
+ * shipping lots of loose files on most platforms.
+ *
+ * Files can be stored uncompressed or compressed with deflate, which is what
+ * most zip tools produce by default. Other compression methods aren't
+ * supported. Zip64 archives are supported, encrypted archives are not.
+ *
+ * Title storage can also be served from an archive, by setting
+ * SDL_HINT_STORAGE_TITLE_DRIVER to "pack" and passing the path to the
+ * archive as the `override` parameter of SDL_OpenTitleStorage().
+ *
+ * \param path the path to the archive.
+ * \returns a storage container on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseStorage
+ * \sa SDL_GetStoragePathInfo
+ * \sa SDL_GlobStorageDirectory
+ * \sa SDL_OpenTitleStorage
+ * \sa SDL_ReadStorageFile
+ */
+extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenPackStorage(const char *path);
+
 /**
  * Opens up a container using a client-provided storage interface.
  *
@@ -521,6 +552,72 @@ extern SDL_DECLSPEC bool SDLCALL SDL_ReadStorageFile(SDL_Storage *storage, const
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_WriteStorageFile(SDL_Storage *storage, const char *path, const void *source, Uint64 length);
 
+/**
+ * Start reading a whole file from a storage container, asynchronously.
+ *
+ * This allocates a buffer for the file's contents and reads into it in the
+ * background, the same way SDL_LoadFileAsync() does. When the read finishes,
+ * an SDL_AsyncIOOutcome is added to `queue`, with its `type` set to
+ * SDL_ASYNCIO_TASK_READ, `asyncio` set to NULL, and `buffer` pointing at the
+ * file's contents. The buffer is null-terminated (the terminator is not
+ * counted in `bytes_transferred`) and belongs to the app, which must free it
+ * with SDL_free().
+ *
+ * Storage backends that can't work asynchronously read the file before this
+ * function returns, and only deliver the outcome through the queue, so the
+ * same code works with every storage container.
+ *
+ * \param storage a storage container to read from.
+ * \param path the relative path of the file to read.
+ * \param queue a queue to add the finished request to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAsyncIOResult
+ * \sa SDL_ReadStorageFile
+ * \sa SDL_WaitAsyncIOResult
+ * \sa SDL_WriteStorageFileAsync
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReadStorageFileAsync(SDL_Storage *storage, const char *path, SDL_AsyncIOQueue *queue, void *userdata);
+
+/**
+ * Start writing a whole file to a writable storage container,
+ * asynchronously.
+ *
+ * When the file has been written and closed, an SDL_AsyncIOOutcome is added
+ * to `queue`, with its `type` set to SDL_ASYNCIO_TASK_WRITE and `asyncio` set
+ * to NULL. `source` must not be freed or changed until then.
+ *
+ * Storage backends that can't work asynchronously write the file before this
+ * function returns, and only deliver the outcome through the queue.
+ *
+ * \param storage a storage container to write to.
+ * \param path the relative path of the file to write.
+ * \param source a client-provided buffer to write from.
+ * \param length the length of the source buffer.
+ * \param queue a queue to add the finished request to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAsyncIOResult
+ * \sa SDL_ReadStorageFileAsync
+ * \sa SDL_WaitAsyncIOResult
+ * \sa SDL_WriteStorageFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WriteStorageFileAsync(SDL_Storage *storage, const char *path, const void *source, Uint64 length, SDL_AsyncIOQueue *queue, void *userdata);
+
 /**
  * Create a directory in a writable storage container.
  *
@@ -677,6 +774,31 @@ extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetStorageSpaceRemaining(SDL_Storage *sto
  */
 extern SDL_DECLSPEC char ** SDLCALL SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count);
 
+/**
+ * Create a cache of the listings of a directory tree in a storage container.
+ *
+ * This works like SDL_CreateDirectoryCache(), but reads directories through
+ * `storage`. Storage containers don't report changes, so call
+ * SDL_InvalidateDirectoryCache() after changing the tree. `storage` must not
+ * be closed until the cache is destroyed.
+ *
+ * \param storage a storage container.
+ * \param path the path of the directory tree to cache, or NULL for the root.
+ * \returns a new directory cache on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, assuming
+ *               the `storage` object is thread-safe.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyDirectoryCache
+ * \sa SDL_GlobDirectoryCache
+ * \sa SDL_GlobStorageDirectory
+ * \sa SDL_InvalidateDirectoryCache
+ */
+extern SDL_DECLSPEC SDL_DirectoryCache * SDLCALL SDL_CreateStorageDirectoryCache(SDL_Storage *storage, const char *path);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -247,6 +247,10 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroySurface(SDL_Surface *surface);
  *   differently than what its camera provides (i.e. - the camera always
  *   provides portrait images but the phone is being held in landscape
  *   orientation). Since SDL 3.4.0.
+ * - `SDL_PROP_SURFACE_DITHER_BOOLEAN`: true if blitting this surface to a
+ *   palettized surface should use ordered dithering instead of picking the
+ *   nearest palette color for each pixel. This trades banding in gradients
+ *   for a fine, fixed pattern. Defaults to false. Since SDL 3.6.0.
  *
  * \param surface the SDL_Surface structure to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -264,6 +268,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSurfaceProperties(SDL_Surfac
 #define SDL_PROP_SURFACE_HOTSPOT_X_NUMBER                   "SDL.surface.hotspot.x"
 #define SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER                   "SDL.surface.hotspot.y"
 #define SDL_PROP_SURFACE_ROTATION_FLOAT                     "SDL.surface.rotation"
+#define SDL_PROP_SURFACE_DITHER_BOOLEAN                     "SDL.surface.dither"
 
 /**
  * Set the colorspace used by a surface.
@@ -570,6 +570,161 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetTLS(SDL_TLSID *id, const void *value, SD
  */
 extern SDL_DECLSPEC void SDLCALL SDL_CleanupTLS(void);
 
+/**
+ * An opaque pool of worker threads that run jobs.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+typedef struct SDL_JobPool SDL_JobPool;
+
+/**
+ * An opaque handle for a set of jobs that can be waited on together.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+typedef struct SDL_JobGroup SDL_JobGroup;
+
+/**
+ * The function type for jobs run by an SDL_JobPool.
+ *
+ * \param userdata what was passed as `userdata` to SDL_SubmitJob().
+ *
+ * \threadsafety This will run on one of the pool's worker threads, or on a
+ *               thread that is waiting in SDL_WaitJobGroup().
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobFunction)(void *userdata);
+
+/**
+ * Create a pool of worker threads for running short jobs in parallel.
+ *
+ * Each worker has its own queue of jobs. Jobs submitted from a worker go on
+ * that worker's queue, jobs submitted from other threads are spread across
+ * the workers, and a worker that runs out of jobs steals from the others.
+ *
+ * If the platform can't create threads, the pool is still usable: jobs are
+ * run by whichever thread calls SDL_WaitJobGroup().
+ *
+ * \param num_threads the number of worker threads to create, or 0 to use
+ *                    one per logical CPU core.
+ * \returns a new job pool, or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyJobPool
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC SDL_JobPool * SDLCALL SDL_CreateJobPool(int num_threads);
+
+/**
+ * Get the number of worker threads in a job pool.
+ *
+ * \param pool the job pool to query.
+ * \returns the number of worker threads, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetJobPoolThreadCount(SDL_JobPool *pool);
+
+/**
+ * Create a group that jobs can be added to and waited on together.
+ *
+ * \param pool the job pool that will run the group's jobs.
+ * \returns a new job group, or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyJobGroup
+ * \sa SDL_WaitJobGroup
+ */
+extern SDL_DECLSPEC SDL_JobGroup * SDLCALL SDL_CreateJobGroup(SDL_JobPool *pool);
+
+/**
+ * Queue a job to run on a job pool.
+ *
+ * Jobs should be short and shouldn't block waiting on other threads, except
+ * by calling SDL_WaitJobGroup(), which runs other jobs while it waits.
+ *
+ * \param pool the job pool to run the job on.
+ * \param group the group to add the job to, or NULL to not track it.
+ * \param fn the function to run.
+ * \param userdata a pointer that is passed to `fn`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_WaitJobGroup
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJob(SDL_JobPool *pool, SDL_JobGroup *group, SDL_JobFunction fn, void *userdata);
+
+/**
+ * Wait for all the jobs in a group to finish.
+ *
+ * While waiting, the calling thread runs queued jobs from the pool, so it's
+ * safe to call this from inside a job.
+ *
+ * \param group the group to wait for.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WaitJobGroup(SDL_JobGroup *group);
+
+/**
+ * Destroy a job group.
+ *
+ * This waits for any jobs still running in the group before freeing it.
+ *
+ * \param group the group to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobGroup(SDL_JobGroup *group);
+
+/**
+ * Destroy a job pool.
+ *
+ * All jobs that have been submitted are run before the worker threads exit.
+ * Any groups created for this pool must be destroyed before the pool.
+ *
+ * \param pool the job pool to destroy.
+ *
+ * \threadsafety Don't call this while other threads are still submitting
+ *               jobs to the pool.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobPool(SDL_JobPool *pool);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
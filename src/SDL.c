@@ -702,6 +702,7 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitJobs();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
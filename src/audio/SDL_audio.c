@@ -272,6 +272,7 @@ static void UpdateAudioStreamFormatsPhysical(SDL_AudioDevice *device)
             SDL_AudioSpec *streamspec = recording ? &stream->src_spec : &stream->dst_spec;
             int **streamchmap = recording ? &stream->src_chmap : &stream->dst_chmap;
             SDL_LockMutex(stream->lock);
+            DrainAudioStreamRing(stream);  // anything already in the ring was put in the old format.
             SDL_copyp(streamspec, &spec);
             SetAudioStreamChannelMap(stream, streamspec, streamchmap, device->chmap, device->spec.channels, -1);  // this should be fast for normal cases, though!
             SDL_UnlockMutex(stream->lock);
@@ -1158,9 +1159,7 @@ void SDL_AudioThreadFinalize(SDL_AudioDevice *device)
 
 static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
 {
-    if (!SDL_MixAudio((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, buffer_size, 1.0f)) {
-        SDL_assert(!"This shouldn't happen.");
-    }
+    MixAudioF32(dst, src, buffer_size / sizeof (float), 1.0f);
 }
 
 
@@ -1251,16 +1250,23 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
+                    if (SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
+                        // the usual case: the stream mixes its output straight into the mix buffer, without a trip through work_buffer.
+                        if (SDL_MixAudioStreamDataAdjustGain(stream, mix_buffer, work_buffer_size, logdev->gain) < 0) {
+                            failed = true;  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                            break;
+                        }
+                        continue;
+                    }
+
                     const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = true;
                         break;
                     } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
-                        if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
-                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
-                                         device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
-                        }
+                        // the audio stream's chmap has been explicitly changed, so do a final swizzle to device layout.
+                        ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
+                                     device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
                         MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
                 }
@@ -1402,6 +1408,9 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
                     if (!SDL_PutAudioStreamData(stream, final_buf, br)) {
+                        if (stream->ring) {
+                            continue;  // the app isn't keeping up with the stream's input ring; drop this buffer like a hardware overrun would.
+                        }
                         // oh crud, we probably ran out of memory. This is possibly an overreaction to kill the audio device, but it's likely the whole thing is going down in a moment anyhow.
                         failed = true;
                         break;
@@ -448,6 +448,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
+    result->resample_quality = SDL_AUDIO_RESAMPLE_MEDIUM;
     result->queue = SDL_CreateAudioQueue(8192);
 
     if (!result->queue) {
@@ -599,6 +600,9 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
 
     SDL_LockMutex(stream->lock);
 
+    // anything still in the input ring was put in the old format.
+    DrainAudioStreamRing(stream);
+
     // quietly refuse to change the format of the end currently bound to a device.
     if (stream->bound_device) {
         if (stream->bound_device->physical_device->recording) {
@@ -639,6 +643,8 @@ bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamRing(stream);  // anything still in the input ring was put with the old channel map.
+
     if (channels != spec->channels) {
         result = SDL_SetError("Wrong number of channels");
     } else if (!*stream_chmap && !chmap) {
@@ -782,6 +788,38 @@ bool SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
     return true;
 }
 
+bool SDL_GetAudioStreamResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality *quality)
+{
+    CHECK_PARAM(!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    CHECK_PARAM(!quality) {
+        return SDL_InvalidParamError("quality");
+    }
+
+    SDL_LockMutex(stream->lock);
+    *quality = stream->resample_quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return true;
+}
+
+bool SDL_SetAudioStreamResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality)
+{
+    CHECK_PARAM(!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    CHECK_PARAM(quality != SDL_AUDIO_RESAMPLE_LINEAR && quality != SDL_AUDIO_RESAMPLE_MEDIUM && quality != SDL_AUDIO_RESAMPLE_HIGH) {
+        return SDL_InvalidParamError("quality");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->resample_quality = quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return true;
+}
+
 static bool CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == SDL_AUDIO_UNKNOWN) {
@@ -798,6 +836,9 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
 {
     SDL_AudioTrack *track = NULL;
 
+    // keep anything the ring producer already put ahead of this.
+    DrainAudioStreamRing(stream);
+
     if (callback) {
         track = SDL_CreateAudioTrack(stream->queue, spec, chmap, (Uint8 *)buf, len, len, callback, userdata);
         if (!track) {
@@ -825,6 +866,107 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
     return retval;
 }
 
+// the queue releases the ring in order, so everything up to the end of this piece can be reused.
+static void SDLCALL ReleaseAudioStreamRing(void *userdata, const void *buf, int len)
+{
+    SDL_AudioStream *stream = (SDL_AudioStream *)userdata;
+
+    if (len == 0) {
+        return;  // a track that was already read to the end.
+    }
+
+    const Uint32 tail = SDL_GetAtomicU32(&stream->ring_tail);
+    const Uint32 end = (Uint32)((const Uint8 *)buf - stream->ring) + (Uint32)len;
+
+    SDL_MemoryBarrierRelease();  // finish reading the ring before the producer can reuse that space.
+    SDL_SetAtomicU32(&stream->ring_tail, tail + ((end - tail - 1) & (stream->ring_size - 1)) + 1);
+}
+
+// this is the producer side of the input ring, and runs without `stream->lock`.
+static bool PutAudioStreamRing(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const int framesize = SDL_AUDIO_FRAMESIZE(stream->src_spec);
+    if (framesize == 0) {
+        return SDL_SetError("Stream has no source format");
+    } else if ((len % framesize) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    const Uint32 head = SDL_GetAtomicU32(&stream->ring_head);
+    const Uint32 tail = SDL_GetAtomicU32(&stream->ring_tail);
+    SDL_MemoryBarrierAcquire();  // don't write into space the consumer might still be reading.
+
+    if ((Uint32)len > stream->ring_size - (head - tail)) {
+        return SDL_SetError("Audio stream ring buffer is full");
+    }
+
+    const Uint32 offset = head & (stream->ring_size - 1);
+    const Uint32 first = SDL_min((Uint32)len, stream->ring_size - offset);
+    SDL_memcpy(stream->ring + offset, buf, first);
+    SDL_memcpy(stream->ring, (const Uint8 *)buf + first, len - first);
+
+    SDL_MemoryBarrierRelease();  // the consumer must see the data before it sees the new head.
+    SDL_SetAtomicU32(&stream->ring_head, head + (Uint32)len);
+
+    return true;
+}
+
+bool SDL_SetAudioStreamRingBuffer(SDL_AudioStream *stream, int len)
+{
+    CHECK_PARAM(!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    CHECK_PARAM(len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+    if (len > 0x40000000) {
+        return SDL_SetError("Audio stream ring buffer is too large");
+    }
+
+    // The head and tail are free running byte counts that wrap at 2^32, so the
+    // size has to divide 2^32 for them to keep mapping to the same offsets.
+    if (len > 0) {
+        len = SDL_powerof2(len);
+    }
+
+    bool result = true;
+
+    SDL_LockMutex(stream->lock);
+
+    if (stream->bound_device && stream->bound_device->physical_device->recording) {
+        result = SDL_SetError("Can't change the ring buffer of a stream bound to a recording device");
+    } else {
+        DrainAudioStreamRing(stream);
+
+        if (stream->ring && (SDL_GetAtomicU32(&stream->ring_head) != stream->ring_queued)) {
+            result = false;  // couldn't move everything into the queue, the audio queue set the error.
+        } else if ((Uint32)len != stream->ring_size) {
+            Uint8 *ring = NULL;
+            if (len > 0) {
+                ring = (Uint8 *)SDL_malloc(len);
+            }
+
+            if (len > 0 && !ring) {
+                result = false;
+            } else if (stream->ring && !SDL_CopyAudioQueueTracks(stream->queue, ReleaseAudioStreamRing)) {
+                SDL_free(ring);  // the queue still points into the old ring for anything that hasn't been read yet.
+                result = false;
+            } else {
+                SDL_free(stream->ring);
+                stream->ring = ring;
+                stream->ring_size = (Uint32)len;
+                SDL_SetAtomicU32(&stream->ring_head, 0);
+                SDL_SetAtomicU32(&stream->ring_tail, 0);
+                stream->ring_queued = 0;
+            }
+        }
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return result;
+}
+
 static bool PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void *userdata)
 {
 #if DEBUG_AUDIOSTREAM
@@ -871,6 +1013,11 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return true; // nothing to do.
     }
 
+    // With an input ring, this is a single copy into preallocated memory, and never touches the stream lock.
+    if (stream->ring) {
+        return PutAudioStreamRing(stream, buf, len);
+    }
+
     // When copying in large amounts of data, try and do as much work as possible
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
@@ -1084,6 +1231,7 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    DrainAudioStreamRing(stream);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
@@ -1145,7 +1293,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1188,6 +1336,65 @@ static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, Sint64 *out
     return output_frames;
 }
 
+void DrainAudioStreamRing(SDL_AudioStream *stream)
+{
+    if (!stream->ring) {
+        return;
+    }
+
+    const Uint32 head = SDL_GetAtomicU32(&stream->ring_head);
+    SDL_MemoryBarrierAcquire();  // see the producer's writes to the ring before we read them.
+    Uint32 tail = stream->ring_queued;
+    const Uint32 framesize = (Uint32)SDL_AUDIO_FRAMESIZE(stream->src_spec);
+
+    if (head == tail || framesize == 0) {
+        return;
+    }
+
+    // (SDL_GetAudioStreamAvailable would drain the ring itself, so count frames directly for the put callback.)
+    const bool notify = stream->put_callback && (stream->dst_spec.format != SDL_AUDIO_UNKNOWN);
+    const Sint64 prev_available = notify ? GetAudioStreamAvailableFrames(stream, NULL) : 0;
+
+    // The queue reads straight out of the ring, and hands the space back as it finishes with each piece.
+    // The ring wraps at most once, so this is one or two contiguous pieces, plus a frame split by the wrap.
+    while (tail != head) {
+        const Uint32 offset = tail & (stream->ring_size - 1);
+        const Uint32 len = SDL_min(head - tail, stream->ring_size - offset);
+        const Uint32 whole = len - (len % framesize);
+        if (whole > 0) {
+            SDL_AudioTrack *track = SDL_CreateAudioTrack(stream->queue, &stream->src_spec, stream->src_chmap, stream->ring + offset, whole, whole, ReleaseAudioStreamRing, stream);
+            if (!track) {
+                break;  // out of memory; leave the rest in the ring and try again next time.
+            }
+            SDL_AddTrackToAudioQueue(stream->queue, track);
+            tail += whole;
+        } else {
+            // tracks can't hold part of a frame, so copy the one split by the wrap.
+            Uint8 frame[SDL_MAX_CHANNELMAP_CHANNELS * sizeof(float)];
+            SDL_assert(framesize <= sizeof(frame));
+            SDL_memcpy(frame, stream->ring + offset, len);
+            SDL_memcpy(frame + len, stream->ring, framesize - len);
+            if (!SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, frame, framesize)) {
+                break;
+            }
+            // its space comes back with the next piece, or right away if everything before it was already released.
+            if (SDL_GetAtomicU32(&stream->ring_tail) == tail) {
+                SDL_MemoryBarrierRelease();
+                SDL_SetAtomicU32(&stream->ring_tail, tail + framesize);
+            }
+            tail += framesize;
+        }
+    }
+
+    stream->ring_queued = tail;
+
+    if (notify) {
+        const Sint64 newframes = GetAudioStreamAvailableFrames(stream, NULL) - prev_available;
+        const int newavail = (int) SDL_min(newframes * SDL_AUDIO_FRAMESIZE(stream->dst_spec), SDL_INT_MAX);
+        stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
+    }
+}
+
 static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spec, int **out_chmap, bool *out_flushed)
 {
     void *iter = SDL_BeginAudioQueueIter(stream->queue);
@@ -1204,7 +1411,8 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spe
 
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
-static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain)
+// If `accumulate` is true, the output (which must be float32) is mixed into `buf` instead of replacing it.
+static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain, bool accumulate)
 {
     const SDL_AudioSpec *src_spec = &stream->input_spec;
     const SDL_AudioSpec *dst_spec = &stream->dst_spec;
@@ -1225,10 +1433,31 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 
     SDL_assert(output_frames > 0);
 
+    SDL_assert(!accumulate || (dst_format == SDL_AUDIO_F32));
+
     // Not resampling? It's an easy conversion (and maybe not even that!)
     if (resample_rate == 0) {
         Uint8 *work_buffer = NULL;
 
+        if (accumulate) {
+            work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
+
+            if (!work_buffer) {
+                return false;
+            }
+
+            // If no conversion is needed, this mixes straight out of the queue, and the gain is applied while mixing.
+            // Otherwise (including a swizzle for the queued track's channel map) it's converted into the work buffer.
+            const Uint8 *output_buffer = SDL_ReadFromAudioQueue(stream->queue, NULL, dst_format, dst_channels, dst_map, 0, output_frames, 0, work_buffer, 1.0f);
+
+            if (!output_buffer) {
+                return SDL_SetError("Not enough data in queue");
+            }
+
+            MixAudioF32((float *)buf, (const float *)output_buffer, output_frames * dst_channels, gain);
+            return true;
+        }
+
         // Ensure we have enough scratch space for any conversions
         if ((src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f)) {
             work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
@@ -1252,7 +1481,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1281,7 +1510,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // Check if we can resample directly into the output buffer.
     // Note, this is just to avoid extra copies.
     // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-    if ((dst_format != resample_format) || (dst_channels != resample_channels)) {
+    if (accumulate || (dst_format != resample_format) || (dst_channels != resample_channels)) {
         // Allocate space for converting the resampled output to the destination format
         int resample_convert_bytes = output_frames * max_frame_size;
         work_buffer_capacity = SDL_max(work_buffer_capacity, resample_convert_bytes);
@@ -1325,7 +1554,20 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     SDL_ResampleAudio(resample_channels,
                   (const float *)input_buffer, input_frames,
                   (float *)resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_quality);
+
+    if (accumulate) {
+        const float *output_buffer = (const float *)resample_buffer;
+
+        // Swizzle or change the channel count, if necessary, using the start of the work buffer (the input data is no longer needed).
+        if ((dst_channels != resample_channels) || dst_map) {
+            ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, work_buffer, dst_format, dst_channels, dst_map, NULL, 1.0f);
+            output_buffer = (const float *)work_buffer;
+        }
+
+        MixAudioF32((float *)buf, output_buffer, output_frames * dst_channels, postresample_gain);
+        return true;
+    }
 
     // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
@@ -1333,8 +1575,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     return true;
 }
 
-// get converted/resampled data from the stream
-int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+static int GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, bool accumulate)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
@@ -1364,8 +1605,14 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
     if (!CheckAudioStreamIsFullySetup(stream)) {
         SDL_UnlockMutex(stream->lock);
         return -1;
+    } else if (accumulate && (stream->dst_spec.format != SDL_AUDIO_F32)) {
+        SDL_UnlockMutex(stream->lock);
+        SDL_SetError("Can only mix float32 audio");
+        return -1;
     }
 
+    DrainAudioStreamRing(stream);
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
@@ -1391,6 +1638,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+        DrainAudioStreamRing(stream);  // in case the callback put into the ring.
     }
 
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
@@ -1428,7 +1676,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain)) {
+        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain, accumulate)) {
             total = total ? total : -1;
             break;
         }
@@ -1436,6 +1684,10 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total += output_frames * dst_frame_size;
     }
 
+    if (stream->ring) {
+        SDL_ReleaseReadAudioQueueData(stream->queue, ReleaseAudioStreamRing);  // let the producer reuse what was just read.
+    }
+
     SDL_UnlockMutex(stream->lock);
 
 #if DEBUG_AUDIOSTREAM
@@ -1445,6 +1697,18 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
     return total;
 }
 
+// get converted/resampled data from the stream
+int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+{
+    return GetAudioStreamDataAdjustGain(stream, voidbuf, len, extra_gain, false);
+}
+
+// get converted/resampled data from the stream, and mix it into `buf` instead of overwriting it
+int SDL_MixAudioStreamDataAdjustGain(SDL_AudioStream *stream, float *buf, int len, float extra_gain)
+{
+    return GetAudioStreamDataAdjustGain(stream, buf, len, extra_gain, true);
+}
+
 int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 {
     return SDL_GetAudioStreamDataAdjustGain(stream, voidbuf, len, 1.0f);
@@ -1465,6 +1729,8 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    DrainAudioStreamRing(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1486,6 +1752,8 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamRing(stream);
+
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1503,6 +1771,11 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
     SDL_LockMutex(stream->lock);
 
     SDL_ClearAudioQueue(stream->queue);
+    if (stream->ring) {
+        // drop whatever the producer has put so far.
+        stream->ring_queued = SDL_GetAtomicU32(&stream->ring_head);
+        SDL_SetAtomicU32(&stream->ring_tail, stream->ring_queued);
+    }
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
     stream->resample_offset = 0;
@@ -1532,7 +1805,8 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_aligned_free(stream->work_buffer);
-    SDL_DestroyAudioQueue(stream->queue);
+    SDL_DestroyAudioQueue(stream->queue);  // this releases anything still pointing into the ring.
+    SDL_free(stream->ring);
     SDL_DestroyMutex(stream->lock);
 
     SDL_free(stream);
@@ -305,6 +305,36 @@ void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track)
     queue->tail = track;
 }
 
+static void SDLCALL FreeCopiedAudioBuffer(void *userdata, const void *buf, int len)
+{
+    SDL_free((void *)buf);
+}
+
+bool SDL_CopyAudioQueueTracks(SDL_AudioQueue *queue, SDL_ReleaseAudioBufferCallback callback)
+{
+    // Go from the head, so the original buffers are released in the same order as they would have been.
+    for (SDL_AudioTrack *track = queue->head; track; track = track->next) {
+        if (track->callback != callback) {
+            continue;
+        }
+
+        // Copy what was already read too, since the resampler can still look back into it.
+        Uint8 *data = (Uint8 *)SDL_malloc(track->capacity);
+
+        if (!data) {
+            return false;
+        }
+
+        SDL_memcpy(data, track->data, track->tail);
+        track->callback(track->userdata, track->data, (int)track->capacity);
+        track->data = data;
+        track->callback = FreeCopiedAudioBuffer;
+        track->userdata = NULL;
+    }
+
+    return true;
+}
+
 static size_t WriteToAudioTrack(SDL_AudioTrack *track, const Uint8 *data, size_t len)
 {
     if (track->flushed || track->tail >= track->capacity) {
@@ -486,6 +516,24 @@ static const Uint8 *ReadFromAudioQueue(SDL_AudioQueue *queue, Uint8 *data, size_
     return data;
 }
 
+void SDL_ReleaseReadAudioQueueData(SDL_AudioQueue *queue, SDL_ReleaseAudioBufferCallback callback)
+{
+    SDL_AudioTrack *track = queue->head;
+
+    if (!track || track->callback != callback || track->head == 0) {
+        return;
+    }
+
+    // The resampler can still look back into what was read, so keep it in the history like moving past the track would.
+    UpdateAudioQueueHistory(queue, track->data, track->head);
+    track->callback(track->userdata, track->data, (int)track->head);
+
+    track->data += track->head;
+    track->tail -= track->head;
+    track->capacity -= track->head;
+    track->head = 0;
+}
+
 static const Uint8 *PeekIntoAudioQueueFuture(SDL_AudioQueue *queue, Uint8 *data, size_t len)
 {
     SDL_AudioTrack *track = queue->head;
@@ -550,7 +598,10 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
 
     const bool convert = (src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f);
 
-    if (convert && !dst) {
+    // The track's own channel map decides if a swizzle is needed, it may differ from the stream's current one.
+    const bool swizzle = !convert && !SDL_AudioChannelMapsEqual(src_channels, src_map, dst_map);
+
+    if ((convert || swizzle) && !dst) {
         // The user didn't ask for the data to be copied, but we need to convert it, so store it in the scratch buffer
         dst = scratch;
     }
@@ -59,6 +59,12 @@ extern SDL_AudioTrack *SDL_CreateAudioTrack(SDL_AudioQueue *queue,
 // REQUIRES: `track != NULL`
 extern void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track);
 
+// Give every track released with `callback` its own copy of its data, and release the original buffers
+extern bool SDL_CopyAudioQueueTracks(SDL_AudioQueue *queue, SDL_ReleaseAudioBufferCallback callback);
+
+// Release the part of the head track's buffer that has already been read, if it is released with `callback`
+extern void SDL_ReleaseReadAudioQueueData(SDL_AudioQueue *queue, SDL_ReleaseAudioBufferCallback callback);
+
 // Iterate over the tracks in the queue
 extern void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue);
 
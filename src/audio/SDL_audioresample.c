@@ -48,6 +48,21 @@
 #define RESAMPLER_FILTER_INTERP_BITS        (32 - RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_INTERP_RANGE       (1 << RESAMPLER_FILTER_INTERP_BITS)
 
+// SDL_AUDIO_RESAMPLE_HIGH uses a longer, finer grained version of the same filter.
+// RESAMPLER_HQ_SAMPLES_PER_FRAME is a multiple of 8, so AVX2 can take 8 taps at a time.
+#define RESAMPLER_HQ_ZERO_CROSSINGS            16
+#define RESAMPLER_HQ_SAMPLES_PER_FRAME         (RESAMPLER_HQ_ZERO_CROSSINGS * 2)
+#define RESAMPLER_HQ_BITS_PER_ZERO_CROSSING    5
+#define RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_HQ_BITS_PER_ZERO_CROSSING)
+#define RESAMPLER_HQ_FILTER_INTERP_BITS        (32 - RESAMPLER_HQ_BITS_PER_ZERO_CROSSING)
+#define RESAMPLER_HQ_FILTER_INTERP_RANGE       (1 << RESAMPLER_HQ_FILTER_INTERP_BITS)
+
+// SDL_AUDIO_RESAMPLE_LINEAR only looks at the two input frames around each output frame.
+#define RESAMPLER_LINEAR_PADDING_FRAMES 2
+
+// The history has to cover the widest filter, in case a stream changes quality later.
+#define RESAMPLER_MAX_HISTORY_FRAMES (RESAMPLER_HQ_ZERO_CROSSINGS + 1)
+
 // ResampleFrame is just a vector/matrix/matrix multiplication.
 // It performs cubic interpolation of the filter, then multiplies that with the input.
 // dst = [1, frac, frac^2, frac^3] * filter * src
@@ -261,6 +276,69 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 }
 
+#ifdef SDL_AVX2_INTRINSICS
+// Mono and stereo take exactly three SSE vectors of taps, which AVX2 can't improve on,
+// so only 5.1 and 7.1 get AVX2 kernels here. They do a whole frame per tap instead of
+// splitting it into groups of 4 channels plus leftovers.
+typedef union Scales
+{
+    __m128 v128[RESAMPLER_SAMPLES_PER_FRAME / 4];
+    float v[RESAMPLER_SAMPLES_PER_FRAME];
+} Scales;
+
+static void SDL_TARGETING("sse") GetScales_SSE(Scales *scales, const Cubic *filter, float frac)
+{
+    const __m128 frac1 = _mm_set1_ps(frac);
+    const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+    const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+    int i;
+
+    // Transposed in SetupAudioResampler
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME / 4; ++i, filter += 4) {
+        __m128 out = _mm_load_ps(filter[0].v);
+        out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v));
+        out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v));
+        out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v));
+        scales->v128[i] = out;
+    }
+}
+
+static void SDL_TARGETING("avx2") ResampleFrame_5_1_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    Scales scales;
+    int i;
+
+    GetScales_SSE(&scales, filter, frac);
+
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i += 2, src += 12) {
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_maskload_ps(src + 0, mask), _mm256_broadcast_ss(&scales.v[i])));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_maskload_ps(src + 6, mask), _mm256_broadcast_ss(&scales.v[i + 1])));
+    }
+
+    _mm256_maskstore_ps(dst, mask, _mm256_add_ps(out0, out1));
+}
+
+static void SDL_TARGETING("avx2") ResampleFrame_7_1_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    Scales scales;
+    int i;
+
+    GetScales_SSE(&scales, filter, frac);
+
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; i += 2, src += 16) {
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_loadu_ps(src + 0), _mm256_broadcast_ss(&scales.v[i])));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_loadu_ps(src + 8), _mm256_broadcast_ss(&scales.v[i + 1])));
+    }
+
+    _mm256_storeu_ps(dst, _mm256_add_ps(out0, out1));
+}
+#endif
+
 #undef sdl_madd_ps
 #endif
 
@@ -395,6 +473,392 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
 }
 #endif
 
+static void ResampleFrameHQ_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    const float frac2 = frac * frac;
+    const float frac3 = frac * frac2;
+
+    int i, chan;
+    float scales[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++i, ++filter) {
+        scales[i] = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
+    }
+
+    for (chan = 0; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++i) {
+            out += src[i * chans + chan] * scales[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+#define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
+
+// The filter scales for one output frame, 4 taps per vector
+typedef union HQScales
+{
+    __m128 v128[RESAMPLER_HQ_SAMPLES_PER_FRAME / 4];
+    float v[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+} HQScales;
+
+static void SDL_TARGETING("sse") GetHQScales_SSE(HQScales *scales, const Cubic *filter, float frac)
+{
+    const __m128 frac1 = _mm_set1_ps(frac);
+    const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+    const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+    int i;
+
+    // Transposed in SetupAudioResampler
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, filter += 4) {
+        __m128 out = _mm_load_ps(filter[0].v);
+        out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v));
+        out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v));
+        out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v));
+        scales->v128[i] = out;
+    }
+}
+
+static void SDL_TARGETING("sse") ResampleFrameHQ_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    HQScales scales;
+    int i;
+
+    GetHQScales_SSE(&scales, filter, frac);
+
+    if (chans == 2) {
+        __m128 out0 = _mm_setzero_ps();
+        __m128 out1 = _mm_setzero_ps();
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, src += 8) {
+            const __m128 f = scales.v128[i];
+            out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 0), _mm_unpacklo_ps(f, f));
+            out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 4), _mm_unpackhi_ps(f, f));
+        }
+
+        __m128 out = _mm_add_ps(out0, out1);
+        out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+        _mm_storel_pi((__m64 *)dst, out);
+        return;
+    }
+
+    if (chans == 1) {
+        __m128 out = _mm_setzero_ps();
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, src += 4) {
+            out = sdl_madd_ps(out, scales.v128[i], _mm_loadu_ps(src));
+        }
+
+        __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
+        out = _mm_add_ps(out, shuf);
+        out = _mm_add_ss(out, _mm_movehl_ps(shuf, out));
+        _mm_store_ss(dst, out);
+        return;
+    }
+
+    int chan = 0;
+
+    // Process 4 channels at once
+    for (; chan + 4 <= chans; chan += 4) {
+        const float *in = &src[chan];
+        __m128 out0 = _mm_setzero_ps();
+        __m128 out1 = _mm_setzero_ps();
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 2, in += chans + chans) {
+            out0 = sdl_madd_ps(out0, _mm_loadu_ps(in), _mm_load1_ps(&scales.v[i]));
+            out1 = sdl_madd_ps(out1, _mm_loadu_ps(in + chans), _mm_load1_ps(&scales.v[i + 1]));
+        }
+
+        _mm_storeu_ps(&dst[chan], _mm_add_ps(out0, out1));
+    }
+
+    // Whatever is left (at most 3 channels) is done one at a time
+    for (; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++i) {
+            out += src[i * chans + chan] * scales.v[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+// The AVX2 kernels cover the channel counts that fill a whole 256-bit register (or nearly),
+// everything else stays on the SSE kernel.
+static void SDL_TARGETING("avx2") ResampleFrameHQ_Mono_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    HQScales scales;
+    int i;
+
+    GetHQScales_SSE(&scales, filter, frac);
+
+    __m256 out = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 8) {
+        out = _mm256_add_ps(out, _mm256_mul_ps(_mm256_loadu_ps(&scales.v[i]), _mm256_loadu_ps(src + i)));
+    }
+
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    _mm_store_ss(dst, sum);
+}
+
+static void SDL_TARGETING("avx2") ResampleFrameHQ_Stereo_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    HQScales scales;
+    int i;
+
+    GetHQScales_SSE(&scales, filter, frac);
+
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 8, src += 16) {
+        // Duplicate each scale, so they line up with interleaved left/right samples
+        const __m256 f = _mm256_loadu_ps(&scales.v[i]);
+        const __m256 lo = _mm256_unpacklo_ps(f, f);
+        const __m256 hi = _mm256_unpackhi_ps(f, f);
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_loadu_ps(src + 0), _mm256_permute2f128_ps(lo, hi, 0x20)));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_loadu_ps(src + 8), _mm256_permute2f128_ps(lo, hi, 0x31)));
+    }
+
+    const __m256 out = _mm256_add_ps(out0, out1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi((__m64 *)dst, sum);
+}
+
+static void SDL_TARGETING("avx2") ResampleFrameHQ_5_1_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    HQScales scales;
+    int i;
+
+    GetHQScales_SSE(&scales, filter, frac);
+
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 2, src += 12) {
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_maskload_ps(src + 0, mask), _mm256_broadcast_ss(&scales.v[i])));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_maskload_ps(src + 6, mask), _mm256_broadcast_ss(&scales.v[i + 1])));
+    }
+
+    _mm256_maskstore_ps(dst, mask, _mm256_add_ps(out0, out1));
+}
+
+static void SDL_TARGETING("avx2") ResampleFrameHQ_7_1_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    HQScales scales;
+    int i;
+
+    GetHQScales_SSE(&scales, filter, frac);
+
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 2, src += 16) {
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_loadu_ps(src + 0), _mm256_broadcast_ss(&scales.v[i])));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_loadu_ps(src + 8), _mm256_broadcast_ss(&scales.v[i + 1])));
+    }
+
+    _mm256_storeu_ps(dst, _mm256_add_ps(out0, out1));
+}
+#endif
+
+#undef sdl_madd_ps
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void ResampleFrameHQ_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    const float32x4_t frac1 = vdupq_n_f32(frac);
+    const float32x4_t frac2 = vmulq_f32(frac1, frac1);
+    const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+    float32x4_t f[RESAMPLER_HQ_SAMPLES_PER_FRAME / 4];
+    float scales[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i;
+
+    // Transposed in SetupAudioResampler
+    for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, filter += 4) {
+        f[i] = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3);
+        vst1q_f32(&scales[i * 4], f[i]);
+    }
+
+    if (chans == 2) {
+        float32x4_t out0 = vdupq_n_f32(0);
+        float32x4_t out1 = vdupq_n_f32(0);
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, src += 8) {
+            const float32x4x2_t g = vzipq_f32(f[i], f[i]);
+            out0 = vmlaq_f32(out0, vld1q_f32(src + 0), g.val[0]);
+            out1 = vmlaq_f32(out1, vld1q_f32(src + 4), g.val[1]);
+        }
+
+        out0 = vaddq_f32(out0, out1);
+        vst1_f32(dst, vadd_f32(vget_low_f32(out0), vget_high_f32(out0)));
+        return;
+    }
+
+    if (chans == 1) {
+        float32x4_t out = vdupq_n_f32(0);
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME / 4; ++i, src += 4) {
+            out = vmlaq_f32(out, f[i], vld1q_f32(src));
+        }
+
+        float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
+        sum = vpadd_f32(sum, sum);
+        vst1_lane_f32(dst, sum, 0);
+        return;
+    }
+
+    int chan = 0;
+
+    // Process 4 channels at once
+    for (; chan + 4 <= chans; chan += 4) {
+        const float *in = &src[chan];
+        float32x4_t out0 = vdupq_n_f32(0);
+        float32x4_t out1 = vdupq_n_f32(0);
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; i += 2, in += chans + chans) {
+            out0 = vmlaq_n_f32(out0, vld1q_f32(in), scales[i]);
+            out1 = vmlaq_n_f32(out1, vld1q_f32(in + chans), scales[i + 1]);
+        }
+
+        vst1q_f32(&dst[chan], vaddq_f32(out0, out1));
+    }
+
+    // Whatever is left (at most 3 channels) is done one at a time
+    for (; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++i) {
+            out += src[i * chans + chan] * scales[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+#endif
+
+// Linear interpolation is cheap enough that a function call per frame would dominate, so these do the whole buffer.
+typedef void (*ResampleLinearFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans);
+
+#define LINEAR_FRAC(srcpos) ((float)(Uint32)((srcpos) & 0xFFFFFFFF) * (1.0f / 4294967296.0f))
+
+static void ResampleLinear_Generic(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float *b = a + chans;
+        const float frac = LINEAR_FRAC(srcpos);
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = a[chan] + ((b[chan] - a[chan]) * frac);
+        }
+    }
+}
+
+static void ResampleLinear_Mono(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32)];
+        dst[i] = a[0] + ((a[1] - a[0]) * LINEAR_FRAC(srcpos));
+    }
+}
+
+static void ResampleLinear_Stereo(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += 2) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * 2];
+        const float frac = LINEAR_FRAC(srcpos);
+        dst[0] = a[0] + ((a[2] - a[0]) * frac);
+        dst[1] = a[1] + ((a[3] - a[1]) * frac);
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") ResampleLinear_SSE(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float *b = a + chans;
+        const float frac = LINEAR_FRAC(srcpos);
+        const __m128 frac4 = _mm_set1_ps(frac);
+
+        for (chan = 0; chan + 4 <= chans; chan += 4) {
+            const __m128 va = _mm_loadu_ps(a + chan);
+            _mm_storeu_ps(dst + chan, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + chan), va), frac4)));
+        }
+
+        for (; chan < chans; ++chan) {
+            dst[chan] = a[chan] + ((b[chan] - a[chan]) * frac);
+        }
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") ResampleLinear_5_1_AVX2(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += 6) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * 6];
+        const __m256 va = _mm256_maskload_ps(a, mask);
+        const __m256 vb = _mm256_maskload_ps(a + 6, mask);
+        _mm256_maskstore_ps(dst, mask, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), _mm256_set1_ps(LINEAR_FRAC(srcpos)))));
+    }
+}
+
+static void SDL_TARGETING("avx2") ResampleLinear_7_1_AVX2(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += 8) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * 8];
+        const __m256 va = _mm256_loadu_ps(a);
+        const __m256 vb = _mm256_loadu_ps(a + 8);
+        _mm256_storeu_ps(dst, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), _mm256_set1_ps(LINEAR_FRAC(srcpos)))));
+    }
+}
+#endif
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void ResampleLinear_NEON(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *a = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float *b = a + chans;
+        const float frac = LINEAR_FRAC(srcpos);
+
+        for (chan = 0; chan + 4 <= chans; chan += 4) {
+            const float32x4_t va = vld1q_f32(a + chan);
+            vst1q_f32(dst + chan, vmlaq_n_f32(va, vsubq_f32(vld1q_f32(b + chan), va), frac));
+        }
+
+        for (; chan < chans; ++chan) {
+            dst[chan] = a[chan] + ((b[chan] - a[chan]) * frac);
+        }
+    }
+}
+#endif
+
 // Calculate the cubic equation which passes through all four points.
 // https://en.wikipedia.org/wiki/Ordinary_least_squares
 // https://en.wikipedia.org/wiki/Polynomial_regression
@@ -452,36 +916,44 @@ static float Sinc(const float *table, int x, int y)
 }
 
 static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+static Cubic ResamplerFilterHQ[RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_HQ_SAMPLES_PER_FRAME];
 
-static void GenerateResamplerFilter(void)
+// `coeffs` is `samples_per_zero_crossing` rows of `zero_crossings * 2` polynomials.
+static void GenerateResamplerFilter(Cubic *coeffs, int zero_crossings, int samples_per_zero_crossing, float dB)
 {
     enum
     {
-        // Generate samples at 3x the target resolution, so that we have samples at [0, 1/3, 2/3, 1] of each position
-        TABLE_SAMPLES_PER_ZERO_CROSSING = RESAMPLER_SAMPLES_PER_ZERO_CROSSING * 3,
-        TABLE_SIZE = RESAMPLER_ZERO_CROSSINGS * TABLE_SAMPLES_PER_ZERO_CROSSING,
+        // Big enough for the largest filter
+        MAX_TABLE_SAMPLES_PER_ZERO_CROSSING = RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING * 3,
+        MAX_TABLE_SIZE = RESAMPLER_HQ_ZERO_CROSSINGS * MAX_TABLE_SAMPLES_PER_ZERO_CROSSING,
     };
 
+    // Generate samples at 3x the target resolution, so that we have samples at [0, 1/3, 2/3, 1] of each position
+    const int table_samples_per_zero_crossing = samples_per_zero_crossing * 3;
+    const int table_size = zero_crossings * table_samples_per_zero_crossing;
+    const int samples_per_frame = zero_crossings * 2;
+
     // if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab.
-    const float dB = 80.0f;
     const float beta = 0.1102f * (dB - 8.7f);
     const float bessel_beta = BesselI0(beta);
-    const float lensqr = TABLE_SIZE * TABLE_SIZE;
+    const float lensqr = (float)table_size * table_size;
 
     int i, j;
 
-    float sinc[TABLE_SAMPLES_PER_ZERO_CROSSING];
-    SincTable(sinc, TABLE_SAMPLES_PER_ZERO_CROSSING);
+    SDL_assert(table_size <= MAX_TABLE_SIZE);
+
+    float sinc[MAX_TABLE_SAMPLES_PER_ZERO_CROSSING];
+    SincTable(sinc, table_samples_per_zero_crossing);
 
     // Generate one wing of the filter
     // https://en.wikipedia.org/wiki/Kaiser_window
     // https://en.wikipedia.org/wiki/Whittaker%E2%80%93Shannon_interpolation_formula
-    float filter[TABLE_SIZE + 1];
+    float filter[MAX_TABLE_SIZE + 1];
     filter[0] = 1.0f;
 
-    for (i = 1; i <= TABLE_SIZE; ++i) {
-        float b = BesselI0(beta * SDL_sqrtf((lensqr - (i * i)) / lensqr)) / bessel_beta;
-        float s = Sinc(sinc, i, TABLE_SAMPLES_PER_ZERO_CROSSING);
+    for (i = 1; i <= table_size; ++i) {
+        float b = BesselI0(beta * SDL_sqrtf((lensqr - ((float)i * i)) / lensqr)) / bessel_beta;
+        float s = Sinc(sinc, i, table_samples_per_zero_crossing);
         filter[i] = b * s;
     }
 
@@ -492,19 +964,19 @@ static void GenerateResamplerFilter(void)
     // For the left wing, this means interpolating "forwards" (away from the center)
     // For the right wing, this means interpolating "backwards" (towards the center)
     //
-    // The center of the filter is at the end of the left wing (RESAMPLER_ZERO_CROSSINGS - 1)
+    // The center of the filter is at the end of the left wing (zero_crossings - 1)
     // The left wing is the filter, but reversed
     // The right wing is the filter, but offset by 1
     //
     // Since the right wing is offset by 1, this just means we interpolate backwards
     // between the same points, instead of forwards
     // interp(p[n], p[n+1], t) = interp(p[n+1], p[n+1-1], 1 - t) = interp(p[n+1], p[n], 1 - t)
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
-        for (j = 0; j < RESAMPLER_ZERO_CROSSINGS; ++j) {
-            const float *ys = &filter[((j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING) + i) * 3];
+    for (i = 0; i < samples_per_zero_crossing; ++i) {
+        for (j = 0; j < zero_crossings; ++j) {
+            const float *ys = &filter[((j * samples_per_zero_crossing) + i) * 3];
 
-            Cubic *fwd = &ResamplerFilter[i][RESAMPLER_ZERO_CROSSINGS - j - 1];
-            Cubic *rev = &ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING - i - 1][RESAMPLER_ZERO_CROSSINGS + j];
+            Cubic *fwd = &coeffs[(i * samples_per_frame) + zero_crossings - j - 1];
+            Cubic *rev = &coeffs[((samples_per_zero_crossing - i - 1) * samples_per_frame) + zero_crossings + j];
 
             // Calculate the cubic equation of the 4 points
             CubicLeastSquares(fwd, ys[0], ys[1], ys[2], ys[3]);
@@ -515,6 +987,8 @@ static void GenerateResamplerFilter(void)
 
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
+static ResampleFrameFunc ResampleFrameHQ[8];
+static ResampleLinearFunc ResampleLinear[8];
 
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
@@ -535,13 +1009,36 @@ static void SetupAudioResampler(void)
     int i, j;
     bool transpose = false;
 
-    GenerateResamplerFilter();
+    GenerateResamplerFilter(&ResamplerFilter[0][0], RESAMPLER_ZERO_CROSSINGS, RESAMPLER_SAMPLES_PER_ZERO_CROSSING, 80.0f);
+    GenerateResamplerFilter(&ResamplerFilterHQ[0][0], RESAMPLER_HQ_ZERO_CROSSINGS, RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING, 110.0f);
+
+    for (i = 0; i < 8; ++i) {
+        ResampleLinear[i] = ResampleLinear_Generic;
+    }
+    ResampleLinear[0] = ResampleLinear_Mono;
+    ResampleLinear[1] = ResampleLinear_Stereo;
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
+            ResampleFrameHQ[i] = ResampleFrameHQ_Generic_SSE;
+        }
+        for (i = 2; i < 8; ++i) {
+            ResampleLinear[i] = ResampleLinear_SSE;
         }
+#ifdef SDL_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            ResampleFrame[5] = ResampleFrame_5_1_AVX2;
+            ResampleFrame[7] = ResampleFrame_7_1_AVX2;
+            ResampleFrameHQ[0] = ResampleFrameHQ_Mono_AVX2;
+            ResampleFrameHQ[1] = ResampleFrameHQ_Stereo_AVX2;
+            ResampleFrameHQ[5] = ResampleFrameHQ_5_1_AVX2;
+            ResampleFrameHQ[7] = ResampleFrameHQ_7_1_AVX2;
+            ResampleLinear[5] = ResampleLinear_5_1_AVX2;
+            ResampleLinear[7] = ResampleLinear_7_1_AVX2;
+        }
+#endif
         transpose = true;
     } else
 #endif
@@ -549,6 +1046,10 @@ static void SetupAudioResampler(void)
     if (SDL_HasNEON()) {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_NEON;
+            ResampleFrameHQ[i] = ResampleFrameHQ_Generic_NEON;
+        }
+        for (i = 2; i < 8; ++i) {
+            ResampleLinear[i] = ResampleLinear_NEON;
         }
         transpose = true;
     } else
@@ -556,6 +1057,7 @@ static void SetupAudioResampler(void)
     {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic;
+            ResampleFrameHQ[i] = ResampleFrameHQ_Generic;
         }
 
         ResampleFrame[0] = ResampleFrame_Mono;
@@ -569,6 +1071,11 @@ static void SetupAudioResampler(void)
                 Transpose4x4(&ResamplerFilter[i][j]);
             }
         }
+        for (i = 0; i < RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING; ++i) {
+            for (j = 0; j + 4 <= RESAMPLER_HQ_SAMPLES_PER_FRAME; j += 4) {
+                Transpose4x4(&ResamplerFilterHQ[i][j]);
+            }
+        }
     }
 }
 
@@ -608,14 +1115,22 @@ int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
 
-    return RESAMPLER_MAX_PADDING_FRAMES;
+    return RESAMPLER_MAX_HISTORY_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    } else if (quality == SDL_AUDIO_RESAMPLE_LINEAR) {
+        return RESAMPLER_LINEAR_PADDING_FRAMES;
+    } else if (quality == SDL_AUDIO_RESAMPLE_HIGH) {
+        return RESAMPLER_HQ_ZERO_CROSSINGS + 1;
+    }
+
+    return RESAMPLER_MAX_PADDING_FRAMES;
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -676,30 +1191,57 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
 }
 
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality)
 {
     int i;
     Sint64 srcpos = *inout_resample_offset;
-    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
 
     SDL_assert(resample_rate > 0);
 
-    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+    if (quality == SDL_AUDIO_RESAMPLE_LINEAR) {
+        SDL_assert(outframes <= 0 || (((srcpos >> 32) >= -1) && (((srcpos + (outframes - 1) * resample_rate) >> 32) < inframes)));
+
+        ResampleLinear[chans - 1](src, dst, outframes, srcpos, resample_rate, chans);
+        srcpos += outframes * resample_rate;
+    } else if (quality == SDL_AUDIO_RESAMPLE_HIGH) {
+        ResampleFrameFunc resample_frame = ResampleFrameHQ[chans - 1];
+
+        src -= (RESAMPLER_HQ_ZERO_CROSSINGS - 1) * chans;
 
-    for (i = 0; i < outframes; ++i) {
-        int srcindex = (int)(Sint32)(srcpos >> 32);
-        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
-        srcpos += resample_rate;
+        for (i = 0; i < outframes; ++i) {
+            int srcindex = (int)(Sint32)(srcpos >> 32);
+            Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+            srcpos += resample_rate;
 
-        SDL_assert(srcindex >= -1 && srcindex < inframes);
+            SDL_assert(srcindex >= -1 && srcindex < inframes);
 
-        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
-        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+            const Cubic *filter = ResamplerFilterHQ[srcfraction >> RESAMPLER_HQ_FILTER_INTERP_BITS];
+            const float frac = (float)(srcfraction & (RESAMPLER_HQ_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_HQ_FILTER_INTERP_RANGE);
 
-        const float *frame = &src[srcindex * chans];
-        resample_frame(frame, dst, filter, frac, chans);
+            resample_frame(&src[srcindex * chans], dst, filter, frac, chans);
 
-        dst += chans;
+            dst += chans;
+        }
+    } else {
+        ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
+
+        src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+
+        for (i = 0; i < outframes; ++i) {
+            int srcindex = (int)(Sint32)(srcpos >> 32);
+            Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+            srcpos += resample_rate;
+
+            SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+            const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+            const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+
+            const float *frame = &src[srcindex * chans];
+            resample_frame(frame, dst, filter, frac, chans);
+
+            dst += chans;
+        }
     }
 
     *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
@@ -530,6 +530,277 @@ static void SDL_TARGETING("ssse3") SDL_Convert_Swap32_SSSE3(Uint32 *dst, const U
 }
 #endif
 
+// Same as CONVERT_16_FWD/CONVERT_16_REV, 32 samples at a time with dst aligned for AVX
+#define CONVERT_32_FWD(CVT1, CVT32)                          \
+    int i = 0;                                               \
+    if (num_samples >= 32) {                                 \
+        while ((uintptr_t)(&dst[i]) & 31) { CVT1  ++i;     } \
+        while ((i + 32) <= num_samples)   { CVT32 i += 32; } \
+    }                                                        \
+    while (i < num_samples)               { CVT1  ++i;     }
+
+#define CONVERT_32_REV(CVT1, CVT32)                          \
+    int i = num_samples;                                     \
+    if (i >= 32) {                                           \
+        while ((uintptr_t)(&dst[i]) & 31) { --i;     CVT1  } \
+        while (i >= 32)                   { i -= 32; CVT32 } \
+    }                                                        \
+    while (i > 0)                         { --i;     CVT1  }
+
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+// These use the same tricks as the SSE2 converters, and give the same results
+static void SDL_TARGETING("avx2") SDL_Convert_S8_to_F32_AVX2(float *dst, const Sint8 *src, int num_samples)
+{
+    const __m128i flipper = _mm_set1_epi8(-0x80);
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0f);
+    const __m128 offset1 = _mm_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S8", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint8)src[i] ^ 0x47800080u)), offset1));
+    }, {
+        const __m128i bytes0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
+        const __m128i bytes1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 16]), flipper);
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes0), caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes0, 8)), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes1, 8)), caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_U8_to_F32_AVX2(float *dst, const Uint8 *src, int num_samples)
+{
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0f);
+    const __m128 offset1 = _mm_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("U8", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint8)src[i] ^ 0x47800000u)), offset1));
+    }, {
+        const __m128i bytes0 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes0), caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes0, 8)), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes1, 8)), caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S16_to_F32_AVX2(float *dst, const Sint16 *src, int num_samples)
+{
+    const __m128i flipper = _mm_set1_epi16(-0x8000);
+    const __m256i caster = _mm256_set1_epi32(0x43800000 /* f2i(256.0) */);
+    const __m256 offset = _mm256_set1_ps(-257.0f);
+    const __m128 offset1 = _mm_set1_ps(-257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint16)src[i] ^ 0x43808000u)), offset1));
+    }, {
+        const __m128i shorts0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
+        const __m128i shorts1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 8]), flipper);
+        const __m128i shorts2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 16]), flipper);
+        const __m128i shorts3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 24]), flipper);
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu16_epi32(shorts0), caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu16_epi32(shorts1), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu16_epi32(shorts2), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu16_epi32(shorts3), caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S32_to_F32_AVX2(float *dst, const Sint32 *src, int num_samples)
+{
+    const __m256 scaler = _mm256_set1_ps(DIVBY2147483648);
+    const __m128 scaler1 = _mm_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX2)");
+
+    CONVERT_32_FWD({
+        _mm_store_ss(&dst[i], _mm_mul_ss(_mm_cvt_si2ss(_mm_setzero_ps(), src[i]), scaler1));
+    }, {
+        const __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        const __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);
+
+        _mm256_store_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints0), scaler));
+        _mm256_store_ps(&dst[i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), scaler));
+        _mm256_store_ps(&dst[i + 16], _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), scaler));
+        _mm256_store_ps(&dst[i + 24], _mm256_mul_ps(_mm256_cvtepi32_ps(ints3), scaler));
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S8_AVX2(Sint8 *dst, const float *src, int num_samples)
+{
+    const __m256 offset = _mm256_set1_ps(98304.0f);
+    const __m128 offset1 = _mm_set1_ps(98304.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S8 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128i ints = _mm_castps_si128(_mm_add_ss(_mm_load_ss(&src[i]), offset1));
+        dst[i] = (Sint8)(_mm_cvtsi128_si32(_mm_packs_epi16(ints, ints)) & 0xFF);
+    }, {
+        const __m256i ints0 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i]), offset));
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 8]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 16]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 24]), offset));
+
+        const __m256i shorts0 = _mm256_and_si256(_mm256_packs_epi16(ints0, ints1), mask);
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packs_epi16(ints2, ints3), mask);
+
+        // Packing works within 128-bit lanes, put the samples back in order
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts0, shorts1), order);
+
+        _mm256_store_si256((__m256i *)&dst[i], bytes);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_U8_AVX2(Uint8 *dst, const float *src, int num_samples)
+{
+    const __m256 offset = _mm256_set1_ps(98305.0f);
+    const __m128 offset1 = _mm_set1_ps(98305.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "U8 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128i ints = _mm_castps_si128(_mm_add_ss(_mm_load_ss(&src[i]), offset1));
+        dst[i] = (Uint8)(_mm_cvtsi128_si32(_mm_packus_epi16(ints, ints)) & 0xFF);
+    }, {
+        const __m256i ints0 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i]), offset));
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 8]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 16]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 24]), offset));
+
+        const __m256i shorts0 = _mm256_and_si256(_mm256_packus_epi16(ints0, ints1), mask);
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packus_epi16(ints2, ints3), mask);
+
+        // Packing works within 128-bit lanes, put the samples back in order
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts0, shorts1), order);
+
+        _mm256_store_si256((__m256i *)&dst[i], bytes);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S16_AVX2(Sint16 *dst, const float *src, int num_samples)
+{
+    const __m256 offset = _mm256_set1_ps(257.0f);
+    const __m128 offset1 = _mm_set1_ps(257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128i ints = _mm_sub_epi32(_mm_castps_si128(_mm_add_ss(_mm_load_ss(&src[i]), offset1)), _mm_castps_si128(offset1));
+        dst[i] = (Sint16)(_mm_cvtsi128_si32(_mm_packs_epi32(ints, ints)) & 0xFFFF);
+    }, {
+        const __m256i ints0 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints1 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 8]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints2 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 16]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints3 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[i + 24]), offset)), _mm256_castps_si256(offset));
+
+        // Packing works within 128-bit lanes, put the samples back in order
+        const __m256i shorts0 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints0, ints1), _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256i shorts1 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints2, ints3), _MM_SHUFFLE(3, 1, 2, 0));
+
+        _mm256_store_si256((__m256i *)&dst[i], shorts0);
+        _mm256_store_si256((__m256i *)&dst[i + 16], shorts1);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S32_AVX2(Sint32 *dst, const float *src, int num_samples)
+{
+    const __m256 limit = _mm256_set1_ps(2147483648.0f);
+    const __m128 limit1 = _mm_set1_ps(2147483648.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128 floats = _mm_load_ss(&src[i]);
+        const __m128 values = _mm_mul_ss(floats, limit1);
+        const __m128i ints = _mm_xor_si128(_mm_cvttps_epi32(values), _mm_castps_si128(_mm_cmpge_ss(values, limit1)));
+        dst[i] = (Sint32)_mm_cvtsi128_si32(ints);
+    }, {
+        const __m256 values0 = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), limit);
+        const __m256 values1 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), limit);
+        const __m256 values2 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), limit);
+        const __m256 values3 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), limit);
+
+        const __m256i ints0 = _mm256_xor_si256(_mm256_cvttps_epi32(values0), _mm256_castps_si256(_mm256_cmp_ps(values0, limit, _CMP_GE_OS)));
+        const __m256i ints1 = _mm256_xor_si256(_mm256_cvttps_epi32(values1), _mm256_castps_si256(_mm256_cmp_ps(values1, limit, _CMP_GE_OS)));
+        const __m256i ints2 = _mm256_xor_si256(_mm256_cvttps_epi32(values2), _mm256_castps_si256(_mm256_cmp_ps(values2, limit, _CMP_GE_OS)));
+        const __m256i ints3 = _mm256_xor_si256(_mm256_cvttps_epi32(values3), _mm256_castps_si256(_mm256_cmp_ps(values3, limit, _CMP_GE_OS)));
+
+        _mm256_store_si256((__m256i *)&dst[i], ints0);
+        _mm256_store_si256((__m256i *)&dst[i + 8], ints1);
+        _mm256_store_si256((__m256i *)&dst[i + 16], ints2);
+        _mm256_store_si256((__m256i *)&dst[i + 24], ints3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap16_AVX2(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap16(src[i]);
+    }, {
+        const __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+
+        _mm256_store_si256((__m256i *)&dst[i], _mm256_shuffle_epi8(ints0, shuffle));
+        _mm256_store_si256((__m256i *)&dst[i + 16], _mm256_shuffle_epi8(ints1, shuffle));
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap32_AVX2(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    const __m256i shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap32(src[i]);
+    }, {
+        const __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        const __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);
+
+        _mm256_store_si256((__m256i *)&dst[i], _mm256_shuffle_epi8(ints0, shuffle));
+        _mm256_store_si256((__m256i *)&dst[i + 8], _mm256_shuffle_epi8(ints1, shuffle));
+        _mm256_store_si256((__m256i *)&dst[i + 16], _mm256_shuffle_epi8(ints2, shuffle));
+        _mm256_store_si256((__m256i *)&dst[i + 24], _mm256_shuffle_epi8(ints3, shuffle));
+    })
+}
+#endif
+
 #ifdef SDL_NEON_INTRINSICS
 
 // C99 requires that all code modifying floating point environment should
@@ -830,8 +1101,107 @@ static void SDL_Convert_Swap32_NEON(Uint32 *dst, const Uint32 *src, int num_samp
 
 #endif
 
+// Mixers: dst[i] = clamp(dst[i] + (src[i] * gain), -1.0, 1.0)
+// These give the same results as SDL_MixAudio() with SDL_AUDIO_F32.
+
+static void SDL_Mix_F32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        const float sample = dst[i] + (src[i] * gain);
+        if (sample > 1.0f) {
+            dst[i] = 1.0f;
+        } else if (sample < -1.0f) {
+            dst[i] = -1.0f;
+        } else {
+            dst[i] = sample;
+        }
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") SDL_Mix_F32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    // The argument order of min/max makes NaN pass through unchanged, like the scalar version.
+    const __m128 gains = _mm_set1_ps(gain);
+    const __m128 upper = _mm_set1_ps(1.0f);
+    const __m128 lower = _mm_set1_ps(-1.0f);
+
+    CONVERT_16_FWD({
+        const __m128 sample = _mm_add_ss(_mm_load_ss(&dst[i]), _mm_mul_ss(_mm_load_ss(&src[i]), gains));
+        _mm_store_ss(&dst[i], _mm_min_ss(upper, _mm_max_ss(lower, sample)));
+    }, {
+        const __m128 samples0 = _mm_add_ps(_mm_load_ps(&dst[i]), _mm_mul_ps(_mm_loadu_ps(&src[i]), gains));
+        const __m128 samples1 = _mm_add_ps(_mm_load_ps(&dst[i + 4]), _mm_mul_ps(_mm_loadu_ps(&src[i + 4]), gains));
+        const __m128 samples2 = _mm_add_ps(_mm_load_ps(&dst[i + 8]), _mm_mul_ps(_mm_loadu_ps(&src[i + 8]), gains));
+        const __m128 samples3 = _mm_add_ps(_mm_load_ps(&dst[i + 12]), _mm_mul_ps(_mm_loadu_ps(&src[i + 12]), gains));
+
+        _mm_store_ps(&dst[i], _mm_min_ps(upper, _mm_max_ps(lower, samples0)));
+        _mm_store_ps(&dst[i + 4], _mm_min_ps(upper, _mm_max_ps(lower, samples1)));
+        _mm_store_ps(&dst[i + 8], _mm_min_ps(upper, _mm_max_ps(lower, samples2)));
+        _mm_store_ps(&dst[i + 12], _mm_min_ps(upper, _mm_max_ps(lower, samples3)));
+    })
+}
+#endif
+
+#ifdef SDL_AVX_INTRINSICS
+static void SDL_TARGETING("avx") SDL_Mix_F32_AVX(float *dst, const float *src, int num_samples, float gain)
+{
+    // The argument order of min/max makes NaN pass through unchanged, like the scalar version.
+    const __m256 gains = _mm256_set1_ps(gain);
+    const __m256 upper = _mm256_set1_ps(1.0f);
+    const __m256 lower = _mm256_set1_ps(-1.0f);
+    const __m128 gains1 = _mm_set1_ps(gain);
+    const __m128 upper1 = _mm_set1_ps(1.0f);
+    const __m128 lower1 = _mm_set1_ps(-1.0f);
+
+    CONVERT_32_FWD({
+        const __m128 sample = _mm_add_ss(_mm_load_ss(&dst[i]), _mm_mul_ss(_mm_load_ss(&src[i]), gains1));
+        _mm_store_ss(&dst[i], _mm_min_ss(upper1, _mm_max_ss(lower1, sample)));
+    }, {
+        const __m256 samples0 = _mm256_add_ps(_mm256_load_ps(&dst[i]), _mm256_mul_ps(_mm256_loadu_ps(&src[i]), gains));
+        const __m256 samples1 = _mm256_add_ps(_mm256_load_ps(&dst[i + 8]), _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), gains));
+        const __m256 samples2 = _mm256_add_ps(_mm256_load_ps(&dst[i + 16]), _mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), gains));
+        const __m256 samples3 = _mm256_add_ps(_mm256_load_ps(&dst[i + 24]), _mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), gains));
+
+        _mm256_store_ps(&dst[i], _mm256_min_ps(upper, _mm256_max_ps(lower, samples0)));
+        _mm256_store_ps(&dst[i + 8], _mm256_min_ps(upper, _mm256_max_ps(lower, samples1)));
+        _mm256_store_ps(&dst[i + 16], _mm256_min_ps(upper, _mm256_max_ps(lower, samples2)));
+        _mm256_store_ps(&dst[i + 24], _mm256_min_ps(upper, _mm256_max_ps(lower, samples3)));
+    })
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_Mix_F32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    const float32x4_t gains = vdupq_n_f32(gain);
+    const float32x4_t upper = vdupq_n_f32(1.0f);
+    const float32x4_t lower = vdupq_n_f32(-1.0f);
+
+    // vmla isn't fused, so this rounds the same way as the scalar version. Unlike SSE, NEON min/max propagate NaN either way.
+    CONVERT_16_FWD({
+        const float32x2_t sample = vmla_f32(vld1_dup_f32(&dst[i]), vld1_dup_f32(&src[i]), vget_low_f32(gains));
+        vst1_lane_f32(&dst[i], vmin_f32(vget_low_f32(upper), vmax_f32(vget_low_f32(lower), sample)), 0);
+    }, {
+        const float32x4_t samples0 = vmlaq_f32(vld1q_f32(&dst[i]), vld1q_f32(&src[i]), gains);
+        const float32x4_t samples1 = vmlaq_f32(vld1q_f32(&dst[i + 4]), vld1q_f32(&src[i + 4]), gains);
+        const float32x4_t samples2 = vmlaq_f32(vld1q_f32(&dst[i + 8]), vld1q_f32(&src[i + 8]), gains);
+        const float32x4_t samples3 = vmlaq_f32(vld1q_f32(&dst[i + 12]), vld1q_f32(&src[i + 12]), gains);
+
+        vst1q_f32(&dst[i], vminq_f32(upper, vmaxq_f32(lower, samples0)));
+        vst1q_f32(&dst[i + 4], vminq_f32(upper, vmaxq_f32(lower, samples1)));
+        vst1q_f32(&dst[i + 8], vminq_f32(upper, vmaxq_f32(lower, samples2)));
+        vst1q_f32(&dst[i + 12], vminq_f32(upper, vmaxq_f32(lower, samples3)));
+    })
+}
+#endif
+
 #undef CONVERT_16_FWD
 #undef CONVERT_16_REV
+#undef CONVERT_32_FWD
+#undef CONVERT_32_REV
 
 // Function pointers set to a CPU-specific implementation.
 static void (*SDL_Convert_S8_to_F32)(float *dst, const Sint8 *src, int num_samples) = NULL;
@@ -846,6 +1216,8 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16 *dst, const Uint16 *src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32 *dst, const Uint32 *src, int num_samples) = NULL;
 
+static void (*SDL_Mix_F32)(float *dst, const float *src, int num_samples, float gain) = NULL;
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -929,6 +1301,11 @@ void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bit
     }
 }
 
+void MixAudioF32(float *dst, const float *src, int num_samples, float gain)
+{
+    SDL_Mix_F32(dst, src, num_samples, gain);
+}
+
 void SDL_ChooseAudioConverters(void)
 {
     static bool converters_chosen = false;
@@ -940,6 +1317,11 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_Swap16 = SDL_Convert_Swap16_##fntype; \
     SDL_Convert_Swap32 = SDL_Convert_Swap32_##fntype;
 
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
 #ifdef SDL_SSE4_1_INTRINSICS
     if (SDL_HasSSE41()) {
         SET_CONVERTER_FUNCS(SSSE3);
@@ -966,6 +1348,11 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_##fntype; \
     SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
 
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
 #ifdef SDL_SSE2_INTRINSICS
     if (SDL_HasSSE2()) {
         SET_CONVERTER_FUNCS(SSE2);
@@ -982,5 +1369,24 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+#ifdef SDL_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        SDL_Mix_F32 = SDL_Mix_F32_AVX;
+    } else
+#endif
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_Mix_F32 = SDL_Mix_F32_SSE;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_Mix_F32 = SDL_Mix_F32_NEON;
+    } else
+#endif
+    {
+        SDL_Mix_F32 = SDL_Mix_F32_Scalar;
+    }
+
     converters_chosen = true;
 }
@@ -94,6 +94,13 @@ bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 l
         return true;
     }
 
+    // native float32 is the common case, and it has SIMD versions.
+    if (format == SDL_AUDIO_F32) {
+        SDL_ChooseAudioConverters();
+        MixAudioF32((float *)dst, (const float *)src, (int)(len / 4), fvolume);
+        return true;
+    }
+
     switch (format) {
 
     case SDL_AUDIO_U8:
@@ -114,6 +114,9 @@ extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SD
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bitsize);
 
+// Adds `src * gain` to `dst`, clamping the result to [-1.0, 1.0].
+extern void MixAudioF32(float *dst, const float *src, int num_samples, float gain);
+
 extern bool SDL_ChannelMapIsDefault(const int *map, int channels);
 extern bool SDL_ChannelMapIsBogus(const int *map, int channels);
 
@@ -142,9 +145,15 @@ extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 // This just lets audio playback apply logical device gain at the same time as audiostream gain, so it's one multiplication instead of thousands.
 extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain);
 
+// Same as SDL_GetAudioStreamDataAdjustGain, but mixes the (float32) output into `buf` instead of overwriting it, which saves the device thread a pass over each stream's data.
+extern int SDL_MixAudioStreamDataAdjustGain(SDL_AudioStream *stream, float *buf, int len, float extra_gain);
+
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
 
+// Queues anything waiting in the stream's input ring, in the current input format, without copying it out of the ring. You must hold `stream->lock`.
+extern void DrainAudioStreamRing(SDL_AudioStream *stream);
+
 
 typedef struct SDL_AudioDriverImpl
 {
@@ -217,9 +226,19 @@ struct SDL_AudioStream
     int *dst_chmap;
     float freq_ratio;
     float gain;
+    SDL_AudioResampleQuality resample_quality;
 
     struct SDL_AudioQueue *queue;
 
+    // Optional input ring (SDL_SetAudioStreamRingBuffer). One thread puts into it without the stream lock;
+    //  whoever holds the lock adds it to `queue` as tracks that point into the ring, and the space is handed back
+    //  when those tracks are released. The positions are running byte counts that wrap at 2^32.
+    Uint8 *ring;
+    Uint32 ring_size;  // always a power of two.
+    SDL_AtomicU32 ring_head;  // bytes written so far, only advanced by the producer.
+    SDL_AtomicU32 ring_tail;  // bytes released so far, only advanced with the stream lock held.
+    Uint32 ring_queued;  // bytes added to `queue` so far, only used with the stream lock held.
+
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
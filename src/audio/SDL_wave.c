@@ -1159,94 +1159,53 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
-{
 #ifdef SDL_WAVE_LAW_LUT
-    const Sint16 alaw_lut[256] = {
-        -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
-        -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
-        -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
-        -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
-        -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
-        -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
-        -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
-        -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
-        5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
-        2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
-        20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
-        10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
-        328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
-        72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
-        1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
-        656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
-    };
-    const Sint16 mulaw_lut[256] = {
-        -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
-        -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
-        -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
-        -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
-        -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
-        -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
-        -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
-        -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
-        31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
-        15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
-        7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
-        3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
-        1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
-        844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
-        356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
-        112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
-    };
+static const Sint16 alaw_lut[256] = {
+    -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
+    -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
+    -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
+    -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
+    -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
+    -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
+    -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
+    -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
+    5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
+    2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
+    20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
+    10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
+    328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
+    72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
+    1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
+    656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
+};
+static const Sint16 mulaw_lut[256] = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
+    -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
+    -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
+    -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
+    -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
+    -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
+    -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
+    -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
+    31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
+    15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
+    7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
+    3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
+    1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
+    844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
+    356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
+    112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
+};
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+/* Expands `count` companded samples to 16 bits. This works backwards, so `src`
+ * and `dst` can point to the same memory.
+ */
+static bool LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t count)
+{
+    size_t i = count;
 
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1250,64 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+    Sint16 *dst;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    dst = (Sint16 *)src;
+
+    /* Expanding in-place. `format` will inform the caller about the byte
+     * order.
+     */
+    if (!LAW_DecodeSamples(file->format.encoding, src, dst, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1357,33 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+// Shifts `sample_count` 24-bit samples to 32 bits, in-place. `ptr` must have room for the expanded samples.
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    // work from end to start, since we're expanding in-place.
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1411,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1770,7 +1791,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads and checks the headers of the WAVE file and initializes the decoder.
+ * On success, file->chunk describes the data chunk (without reading it) and
+ * `spec` is set to the format of the decoded audio.
+ */
+static bool WaveLoadHeaders(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1990,9 +2015,70 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
-    // Process data chunk.
+    // The data chunk is read (or streamed) by the caller.
     *chunk = datachunk;
 
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Has been shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    // The end position is used to leave the data source after the WAVE file.
+    if (RIFFlengthknown) {
+        file->endposition = RIFFend;
+    } else {
+        file->endposition = lastchunkpos;
+    }
+
+    return true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    SDL_AudioSpec wavespec;
+
+    if (!WaveLoadHeaders(src, file, &wavespec)) {
+        return false;
+    }
+
+    // Process data chunk.
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result < 0) {
@@ -2036,51 +2122,10 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
-    }
+    SDL_copyp(spec, &wavespec);
 
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = file->endposition;
 
     return true;
 }
@@ -2161,3 +2206,300 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+// Number of sample frames decoded at a time for the formats that don't have blocks.
+#define WAVE_STREAM_FRAMES 4096
+
+// Name of the audio stream property that owns the decoder.
+#define WAVE_STREAM_PROPERTY "SDL.audiostream.wave.decoder"
+
+// Decoder state for SDL_CreateAudioStreamFromWAV_IO.
+typedef struct WaveStream
+{
+    SDL_IOStream *src;
+    bool closeio;
+    WaveFile file;
+    SDL_AudioSpec spec;        // Format of the decoded audio.
+    Sint64 position;           // Position of the next unread byte of the data chunk in the data source.
+    Uint64 bytesleft;          // Number of bytes of the data chunk that weren't read yet.
+    Sint64 framesleft;         // Number of sample frames still to be decoded (formats without blocks).
+    size_t inputframesize;     // Size of a sample frame in the data chunk (formats without blocks).
+    Uint8 *input;              // One ADPCM block, or WAVE_STREAM_FRAMES sample frames which are decoded in-place.
+    size_t inputsize;
+    Sint16 *output;            // The decoded samples of one ADPCM block.
+    ADPCM_DecoderState state;
+    MS_ADPCM_ChannelState mscstate[2];
+    Sint8 *imacstate;
+    bool done;
+} WaveStream;
+
+static void WaveStreamFree(WaveStream *ws)
+{
+    if (ws->closeio) {
+        SDL_CloseIO(ws->src);
+    }
+    WaveFreeChunkData(&ws->file.chunk);
+    SDL_free(ws->file.decoderdata);
+    SDL_free(ws->input);
+    SDL_free(ws->output);
+    SDL_free(ws->imacstate);
+    SDL_free(ws);
+}
+
+static void SDLCALL CleanupWaveStream(void *userdata, void *value)
+{
+    WaveStreamFree((WaveStream *)value);
+}
+
+static bool WaveStreamInit(WaveStream *ws)
+{
+    WaveFile *file = &ws->file;
+    WaveFormat *format = &file->format;
+    ADPCM_DecoderState *state = &ws->state;
+    size_t outputsize;
+
+    ws->position = file->chunk.position;
+    ws->bytesleft = file->chunk.length;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->blockheadersize = (size_t)state->channels * (format->encoding == MS_ADPCM_CODE ? 7 : 4);
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = state->channels * sizeof(Sint16);
+        state->ddata = file->decoderdata;
+        state->framestotal = file->sampleframes;
+        state->framesleft = state->framestotal;
+
+        if (format->encoding == MS_ADPCM_CODE) {
+            state->cstate = ws->mscstate;
+        } else {
+            ws->imacstate = (Sint8 *)SDL_calloc(state->channels, sizeof(Sint8));
+            if (!ws->imacstate) {
+                return false;
+            }
+            state->cstate = ws->imacstate;
+        }
+
+        outputsize = state->samplesperblock;
+        if (SafeMult(&outputsize, state->framesize)) {
+            return SDL_SetError("WAVE file too big");
+        }
+        state->output.size = outputsize / sizeof(Sint16);
+        ws->output = (Sint16 *)SDL_calloc(1, outputsize);
+        ws->inputsize = state->blocksize;
+        break;
+
+    default:
+        if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            ws->inputframesize = format->channels;
+        } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            ws->inputframesize = (size_t)format->channels * 3;
+        } else {
+            ws->inputframesize = SDL_AUDIO_FRAMESIZE(ws->spec);
+        }
+
+        // Same amount of data as SDL_LoadWAV_IO would return, in whole sample frames.
+        ws->framesleft = (file->sampleframes * format->blockalign) / ws->inputframesize;
+        ws->inputsize = WAVE_STREAM_FRAMES * (size_t)SDL_AUDIO_FRAMESIZE(ws->spec);
+        break;
+    }
+
+    ws->input = (Uint8 *)SDL_malloc(ws->inputsize ? ws->inputsize : 1);
+    if (!ws->input || (state->channels && !ws->output)) {
+        return false;
+    }
+
+    return true;
+}
+
+static size_t WaveStreamRead(WaveStream *ws, void *buf, size_t length)
+{
+    size_t result;
+
+    if (length > ws->bytesleft) {
+        length = (size_t)ws->bytesleft;
+    }
+
+    if (length == 0 || SDL_SeekIO(ws->src, ws->position, SDL_IO_SEEK_SET) != ws->position) {
+        return 0;
+    }
+
+    result = SDL_ReadIO(ws->src, buf, length);
+    ws->position += result;
+    ws->bytesleft -= result;
+    return result;
+}
+
+/* Decodes the next ADPCM block, or the next few sample frames, into the audio
+ * stream. Returns the number of bytes that were put into the stream, or -1 at
+ * the end of the data.
+ */
+static int WaveStreamDecode(WaveStream *ws, SDL_AudioStream *stream)
+{
+    WaveFile *file = &ws->file;
+    WaveFormat *format = &file->format;
+    ADPCM_DecoderState *state = &ws->state;
+    int outputsize = 0;
+    bool result = true;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        if (state->framesleft <= 0 || ws->bytesleft < state->blockheadersize) {
+            return -1;
+        }
+
+        state->block.data = ws->input;
+        state->block.size = WaveStreamRead(ws, ws->input, state->blocksize);
+        state->block.pos = 0;
+        if (state->block.size < state->blockheadersize) {
+            return -1;
+        }
+
+        state->output.data = ws->output;
+        state->output.pos = 0;
+
+        if (format->encoding == MS_ADPCM_CODE) {
+            if (!MS_ADPCM_DecodeBlockHeader(state)) {
+                return -1;
+            }
+            result = MS_ADPCM_DecodeBlockData(state);
+        } else {
+            if (!IMA_ADPCM_DecodeBlockHeader(state)) {
+                return -1;
+            }
+            result = IMA_ADPCM_DecodeBlockData(state);
+        }
+
+        if (!result) {
+            // Truncated block. Same rules as the ADPCM decoders above.
+            if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+                return -1;
+            } else if (file->trunchint != TruncDropFrame) {
+                state->output.pos -= state->output.pos % (state->samplesperblock * state->channels);
+            }
+        }
+        outputsize = (int)(state->output.pos * sizeof(Sint16));
+        if (outputsize > 0 && !SDL_PutAudioStreamData(stream, ws->output, outputsize)) {
+            return -1;
+        }
+        return result ? outputsize : -1;
+
+    default:
+    {
+        const size_t frames = (size_t)SDL_min(ws->framesleft, WAVE_STREAM_FRAMES);
+        const size_t length = frames * ws->inputframesize;
+        size_t framesread;
+
+        if (frames == 0) {
+            return -1;
+        }
+
+        framesread = WaveStreamRead(ws, ws->input, length) / ws->inputframesize;
+        if (framesread < frames) {
+            // Truncated data. Keep the complete sample frames.
+            result = false;
+        }
+        ws->framesleft -= framesread;
+
+        if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            if (!LAW_DecodeSamples(format->encoding, ws->input, (Sint16 *)ws->input, framesread * format->channels)) {
+                return -1;
+            }
+        } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(ws->input, framesread * format->channels);
+        }
+
+        outputsize = (int)framesread * SDL_AUDIO_FRAMESIZE(ws->spec);
+        if (outputsize > 0 && !SDL_PutAudioStreamData(stream, ws->input, outputsize)) {
+            return -1;
+        }
+        return result ? outputsize : -1;
+    }
+    }
+}
+
+static void SDLCALL WaveStreamGetCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *ws = (WaveStream *)userdata;
+
+    while (!ws->done && additional_amount > 0) {
+        const int amount = WaveStreamDecode(ws, stream);
+        if (amount < 0) {
+            // Let the stream play out whatever is still buffered for resampling.
+            ws->done = true;
+            SDL_FlushAudioStream(stream);
+        } else {
+            additional_amount -= amount;
+        }
+    }
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamFromWAV_IO(SDL_IOStream *src, bool closeio, const SDL_AudioSpec *dst_spec)
+{
+    WaveStream *ws = NULL;
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+
+    CHECK_PARAM(!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+
+    ws = (WaveStream *)SDL_calloc(1, sizeof(*ws));
+    if (!ws) {
+        goto failed;
+    }
+    ws->src = src;
+    ws->closeio = closeio;
+    ws->file.riffhint = WaveGetRiffSizeHint();
+    ws->file.trunchint = WaveGetTruncationHint();
+    ws->file.facthint = WaveGetFactChunkHint();
+
+    if (!WaveLoadHeaders(src, &ws->file, &ws->spec) || !WaveStreamInit(ws)) {
+        goto failed;
+    }
+
+    stream = SDL_CreateAudioStream(&ws->spec, dst_spec ? dst_spec : &ws->spec);
+    if (!stream) {
+        goto failed;
+    }
+
+    // The stream owns the decoder from here on. This cleans up on failure, too.
+    props = SDL_GetAudioStreamProperties(stream);
+    if (!props) {
+        goto failed;
+    }
+    if (!SDL_SetPointerPropertyWithCleanup(props, WAVE_STREAM_PROPERTY, ws, CleanupWaveStream, NULL)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    if (!SDL_SetAudioStreamGetCallback(stream, WaveStreamGetCallback, ws)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    return stream;
+
+failed:
+    SDL_DestroyAudioStream(stream);
+    if (ws) {
+        WaveStreamFree(ws);
+    } else if (closeio) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamFromWAV(const char *path, const SDL_AudioSpec *dst_spec)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(path, "rb");
+    if (!stream) {
+        return NULL;
+    }
+    return SDL_CreateAudioStreamFromWAV_IO(stream, true, dst_spec);
+}
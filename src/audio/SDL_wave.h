@@ -145,6 +145,8 @@ typedef struct WaveFile
 
     void *decoderdata; // Some decoders require extra data for a state.
 
+    Sint64 endposition; // Position in the data source right after the WAVE file.
+
     WaveRiffSizeHint riffhint;
     WaveTruncationHint trunchint;
     WaveFactChunkHint facthint;
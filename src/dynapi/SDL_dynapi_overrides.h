@@ -1297,3 +1297,32 @@
 #define SDL_LoadSurface_IO SDL_LoadSurface_IO_REAL
 #define SDL_LoadSurface SDL_LoadSurface_REAL
 #define SDL_SetWindowFillDocument SDL_SetWindowFillDocument_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetCoalescedEventCount SDL_GetCoalescedEventCount_REAL
+#define SDL_CreateJobPool SDL_CreateJobPool_REAL
+#define SDL_GetJobPoolThreadCount SDL_GetJobPoolThreadCount_REAL
+#define SDL_CreateJobGroup SDL_CreateJobGroup_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJobGroup SDL_WaitJobGroup_REAL
+#define SDL_DestroyJobGroup SDL_DestroyJobGroup_REAL
+#define SDL_DestroyJobPool SDL_DestroyJobPool_REAL
+#define SDL_CreateAudioStreamFromWAV_IO SDL_CreateAudioStreamFromWAV_IO_REAL
+#define SDL_CreateAudioStreamFromWAV SDL_CreateAudioStreamFromWAV_REAL
+#define SDL_CreateAsyncIOQueueWithProperties SDL_CreateAsyncIOQueueWithProperties_REAL
+#define SDL_BeginAsyncIOBatch SDL_BeginAsyncIOBatch_REAL
+#define SDL_SubmitAsyncIOBatch SDL_SubmitAsyncIOBatch_REAL
+#define SDL_RegisterAsyncIOBuffers SDL_RegisterAsyncIOBuffers_REAL
+#define SDL_GetAsyncIOQueueStats SDL_GetAsyncIOQueueStats_REAL
+#define SDL_CreateBufferedIO SDL_CreateBufferedIO_REAL
+#define SDL_OpenPackStorage SDL_OpenPackStorage_REAL
+#define SDL_ReadStorageFileAsync SDL_ReadStorageFileAsync_REAL
+#define SDL_WriteStorageFileAsync SDL_WriteStorageFileAsync_REAL
+#define SDL_CreateDirectoryCache SDL_CreateDirectoryCache_REAL
+#define SDL_GlobDirectoryCache SDL_GlobDirectoryCache_REAL
+#define SDL_InvalidateDirectoryCache SDL_InvalidateDirectoryCache_REAL
+#define SDL_DestroyDirectoryCache SDL_DestroyDirectoryCache_REAL
+#define SDL_CreateStorageDirectoryCache SDL_CreateStorageDirectoryCache_REAL
+#define SDL_SetAudioStreamRingBuffer SDL_SetAudioStreamRingBuffer_REAL
+#define SDL_GetAudioStreamResampleQuality SDL_GetAudioStreamResampleQuality_REAL
+#define SDL_SetAudioStreamResampleQuality SDL_SetAudioStreamResampleQuality_REAL
+#define SDL_GetRenderCommandStats SDL_GetRenderCommandStats_REAL
@@ -1305,3 +1305,32 @@ SDL_DYNAPI_PROC(SDL_Surface*,SDL_RotateSurface,(SDL_Surface *a,float b),(a,b),re
 SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadSurface_IO,(SDL_IOStream *a,bool b),(a,b),return)
 SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadSurface,(const char *a),(a),return)
 SDL_DYNAPI_PROC(bool,SDL_SetWindowFillDocument,(SDL_Window *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_PollEvents,(SDL_Event *a,int b),(a,b),return)
+SDL_DYNAPI_PROC(Uint64,SDL_GetCoalescedEventCount,(void),(),return)
+SDL_DYNAPI_PROC(SDL_JobPool*,SDL_CreateJobPool,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetJobPoolThreadCount,(SDL_JobPool *a),(a),return)
+SDL_DYNAPI_PROC(SDL_JobGroup*,SDL_CreateJobGroup,(SDL_JobPool *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJob,(SDL_JobPool *a,SDL_JobGroup *b,SDL_JobFunction c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobPool,(SDL_JobPool *a),(a),)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamFromWAV_IO,(SDL_IOStream *a,bool b,const SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamFromWAV,(const char *a,const SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AsyncIOQueue*,SDL_CreateAsyncIOQueueWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_BeginAsyncIOBatch,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitAsyncIOBatch,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_RegisterAsyncIOBuffers,(SDL_AsyncIOQueue *a,void * const*b,const size_t *c,int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_GetAsyncIOQueueStats,(SDL_AsyncIOQueue *a,SDL_AsyncIOQueueStats *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_IOStream*,SDL_CreateBufferedIO,(SDL_IOStream *a,size_t b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_Storage*,SDL_OpenPackStorage,(const char *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_ReadStorageFileAsync,(SDL_Storage *a,const char *b,SDL_AsyncIOQueue *c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_WriteStorageFileAsync,(SDL_Storage *a,const char *b,const void *c,Uint64 d,SDL_AsyncIOQueue *e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(SDL_DirectoryCache*,SDL_CreateDirectoryCache,(const char *a),(a),return)
+SDL_DYNAPI_PROC(char**,SDL_GlobDirectoryCache,(SDL_DirectoryCache *a,const char *b,SDL_GlobFlags c,int *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_InvalidateDirectoryCache,(SDL_DirectoryCache *a,const char *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyDirectoryCache,(SDL_DirectoryCache *a),(a),)
+SDL_DYNAPI_PROC(SDL_DirectoryCache*,SDL_CreateStorageDirectoryCache,(SDL_Storage *a,const char *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamRingBuffer,(SDL_AudioStream *a,int b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetAudioStreamResampleQuality,(SDL_AudioStream *a,SDL_AudioResampleQuality *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamResampleQuality,(SDL_AudioStream *a,SDL_AudioResampleQuality b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetRenderCommandStats,(SDL_Renderer *a,SDL_RenderCommandStats *b),(a,b),return)
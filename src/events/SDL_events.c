@@ -126,20 +126,47 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
+/* Temporary memory is carved out of per-thread arena chunks. Each allocation
+   starts with an SDL_TemporaryMemory header that links it into the owning
+   thread's list or an event, so handing out memory never calls malloc once a
+   chunk is available. A chunk is reference counted by its live allocations
+   (plus one while it's a thread's current chunk), so allocations can move to
+   another thread with their event and the chunk is freed when the last one
+   goes away. A thread's current chunk is reset in bulk once all of its
+   allocations have been freed. */
+#define SDL_TEMPORARY_MEMORY_CHUNK_SIZE (16 * 1024)
+#define SDL_TEMPORARY_MEMORY_ALIGNMENT  16
+#define SDL_TEMPORARY_MEMORY_ALIGN(size) (((size) + (SDL_TEMPORARY_MEMORY_ALIGNMENT - 1)) & ~(size_t)(SDL_TEMPORARY_MEMORY_ALIGNMENT - 1))
+
+typedef struct SDL_TemporaryMemoryChunk
+{
+    SDL_AtomicInt refcount;
+    size_t size;
+    size_t used;
+} SDL_TemporaryMemoryChunk;
+
 typedef struct SDL_TemporaryMemory
 {
     void *memory;
+    size_t size;
+    SDL_TemporaryMemoryChunk *chunk;
     struct SDL_TemporaryMemory *prev;
     struct SDL_TemporaryMemory *next;
 } SDL_TemporaryMemory;
 
+#define SDL_TEMPORARY_MEMORY_CHUNK_HEADER_SIZE  SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemoryChunk))
+#define SDL_TEMPORARY_MEMORY_HEADER_SIZE        SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemory))
+
 typedef struct SDL_TemporaryMemoryState
 {
     SDL_TemporaryMemory *head;
     SDL_TemporaryMemory *tail;
+    SDL_TemporaryMemoryChunk *chunk;
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
+static SDL_AtomicInt SDL_temporary_memory_bytes;
+static SDL_AtomicInt SDL_temporary_memory_high_water;
 
 typedef struct SDL_EventEntry
 {
@@ -155,17 +182,73 @@ static struct
     bool active;
     SDL_AtomicInt count;
     int max_events_seen;
+    Uint64 coalesced;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+} SDL_EventQ = { NULL, false, { 0 }, 0, 0, NULL, NULL, NULL };
+
+/* An optional bounded multi-producer ring that lets threads add events without
+   taking SDL_EventQ.lock. The consumer side always runs with the queue locked,
+   and moves completed slots onto the end of the linked list before the list is
+   examined, so ordering and SDL_PeepEvents() filtering are unchanged. */
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicU32 sequence;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
+typedef struct SDL_EventRing
+{
+    Uint32 mask;
+    SDL_AtomicU32 enqueue_pos;
+    SDL_AtomicU32 dequeue_pos;
+    SDL_EventRingSlot slots[1];
+} SDL_EventRing;
+
+static void *SDL_event_ring;
+static SDL_AtomicInt SDL_event_ring_users;
+
+static void SDL_SetEventRing(SDL_EventRing *ring);
+
+
+static SDL_TemporaryMemoryChunk *SDL_CreateTemporaryMemoryChunk(size_t size)
+{
+    SDL_TemporaryMemoryChunk *chunk;
+    int bytes, high_water;
+
+    chunk = (SDL_TemporaryMemoryChunk *)SDL_malloc(SDL_TEMPORARY_MEMORY_CHUNK_HEADER_SIZE + size);
+    if (!chunk) {
+        return NULL;
+    }
+    SDL_SetAtomicInt(&chunk->refcount, 0);
+    chunk->size = size;
+    chunk->used = 0;
 
+    bytes = SDL_AddAtomicInt(&SDL_temporary_memory_bytes, (int)size) + (int)size;
+    do {
+        high_water = SDL_GetAtomicInt(&SDL_temporary_memory_high_water);
+    } while (bytes > high_water && !SDL_CompareAndSwapAtomicInt(&SDL_temporary_memory_high_water, high_water, bytes));
+
+    return chunk;
+}
+
+static void SDL_ReleaseTemporaryMemoryChunk(SDL_TemporaryMemoryChunk *chunk)
+{
+    if (SDL_AtomicDecRef(&chunk->refcount)) {
+        SDL_AddAtomicInt(&SDL_temporary_memory_bytes, -(int)chunk->size);
+        SDL_free(chunk);
+    }
+}
 
 static void SDL_CleanupTemporaryMemory(void *data)
 {
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    if (state->chunk) {
+        SDL_ReleaseTemporaryMemoryChunk(state->chunk);
+    }
     SDL_free(state);
 }
 
@@ -238,12 +321,9 @@ static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_
     entry->next = NULL;
 }
 
-static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
+static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemory *entry)
 {
-    if (free_data) {
-        SDL_free(entry->memory);
-    }
-    SDL_free(entry);
+    SDL_ReleaseTemporaryMemoryChunk(entry->chunk);
 }
 
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
@@ -330,59 +410,66 @@ static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
     event->memory = NULL;
 }
 
-static void *SDL_FreeLater(void *memory)
+void *SDL_AllocateTemporaryMemory(size_t size)
 {
     SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemoryChunk *chunk;
+    SDL_TemporaryMemory *entry;
+    size_t needed;
 
-    if (memory == NULL) {
+    if (size > (SDL_MAX_SINT32 - SDL_TEMPORARY_MEMORY_HEADER_SIZE - SDL_TEMPORARY_MEMORY_CHUNK_HEADER_SIZE)) {
+        SDL_OutOfMemory();
         return NULL;
     }
-
-    // Make sure we're not adding this to the list twice
-    //SDL_assert(!SDL_ClaimTemporaryMemory(memory));
+    needed = SDL_TEMPORARY_MEMORY_HEADER_SIZE + SDL_TEMPORARY_MEMORY_ALIGN(size);
 
     state = SDL_GetTemporaryMemoryState(true);
     if (!state) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed.
+        return NULL;
     }
 
-    SDL_TemporaryMemory *entry = (SDL_TemporaryMemory *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
+    chunk = state->chunk;
+    if (!chunk || (chunk->size - chunk->used) < needed) {
+        if (needed > SDL_TEMPORARY_MEMORY_CHUNK_SIZE / 4) {
+            // Large allocations get a chunk of their own
+            chunk = SDL_CreateTemporaryMemoryChunk(needed);
+            if (!chunk) {
+                return NULL;
+            }
+        } else {
+            chunk = SDL_CreateTemporaryMemoryChunk(SDL_TEMPORARY_MEMORY_CHUNK_SIZE);
+            if (!chunk) {
+                return NULL;
+            }
+            if (state->chunk) {
+                SDL_ReleaseTemporaryMemoryChunk(state->chunk);
+            }
+            SDL_AtomicIncRef(&chunk->refcount);
+            state->chunk = chunk;
+        }
     }
 
-    entry->memory = memory;
+    entry = (SDL_TemporaryMemory *)((Uint8 *)chunk + SDL_TEMPORARY_MEMORY_CHUNK_HEADER_SIZE + chunk->used);
+    chunk->used += needed;
+    SDL_AtomicIncRef(&chunk->refcount);
 
+    entry->memory = (Uint8 *)entry + SDL_TEMPORARY_MEMORY_HEADER_SIZE;
+    entry->size = size;
+    entry->chunk = chunk;
     SDL_LinkTemporaryMemoryEntry(state, entry);
 
-    return memory;
-}
-
-void *SDL_AllocateTemporaryMemory(size_t size)
-{
-    return SDL_FreeLater(SDL_malloc(size));
+    return entry->memory;
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
-    }
-    return NULL;
-}
-
-void *SDL_ClaimTemporaryMemory(const void *mem)
-{
-    SDL_TemporaryMemoryState *state;
-
-    state = SDL_GetTemporaryMemoryState(false);
-    if (state && mem) {
-        SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
-        if (entry) {
-            SDL_UnlinkTemporaryMemoryEntry(state, entry);
-            SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
+        const size_t len = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateTemporaryMemory(len);
+        if (copy) {
+            SDL_memcpy(copy, string, len);
         }
+        return copy;
     }
     return NULL;
 }
@@ -400,7 +487,12 @@ void SDL_FreeTemporaryMemory(void)
         SDL_TemporaryMemory *entry = state->head;
 
         SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        SDL_FreeTemporaryMemoryEntry(state, entry, true);
+        SDL_FreeTemporaryMemoryEntry(entry);
+    }
+
+    // If nothing else references our current chunk, start over from the beginning of it
+    if (state->chunk && SDL_GetAtomicInt(&state->chunk->refcount) == 1) {
+        state->chunk->used = 0;
     }
 }
 
@@ -431,6 +523,13 @@ static void SDLCALL SDL_PollSentinelChanged(void *userdata, const char *name, co
     SDL_SetEventEnabled(SDL_EVENT_POLL_SENTINEL, SDL_GetStringBoolean(hint, true));
 }
 
+static bool SDL_coalesce_motion = false;
+
+static void SDLCALL SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_coalesce_motion = SDL_GetStringBoolean(hint, false);
+}
+
 /**
  * Verbosity of logged events as defined in SDL_HINT_EVENT_LOGGING:
  *  - 0: (default) no logging
@@ -957,9 +1056,16 @@ void SDL_StopEventLoop(void)
 
     SDL_EventQ.active = false;
 
+    // Move anything still in the lock-free ring onto the queue so it's cleaned up below
+    SDL_SetEventRing(NULL);
+
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
                 SDL_EventQ.max_events_seen);
+        SDL_Log("SDL EVENT QUEUE: Coalesced motion events: %" SDL_PRIu64,
+                SDL_EventQ.coalesced);
+        SDL_Log("SDL EVENT QUEUE: Temporary memory high-water mark: %d bytes",
+                SDL_GetAtomicInt(&SDL_temporary_memory_high_water));
     }
 
     // Clean out EventQ
@@ -977,6 +1083,7 @@ void SDL_StopEventLoop(void)
 
     SDL_SetAtomicInt(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
+    SDL_EventQ.coalesced = 0;
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -1039,6 +1146,73 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
+// Merge a motion event into the matching one at the end of the queue -- called with the queue locked
+static bool SDL_CoalesceEvent(const SDL_Event *event)
+{
+    SDL_Event *last;
+
+    if (!SDL_EventQ.tail || SDL_EventQ.tail->event.type != event->type) {
+        return false;
+    }
+    last = &SDL_EventQ.tail->event;
+
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        if (last->motion.windowID != event->motion.windowID ||
+            last->motion.which != event->motion.which ||
+            last->motion.state != event->motion.state) {
+            return false;
+        } else {
+            const float xrel = last->motion.xrel + event->motion.xrel;
+            const float yrel = last->motion.yrel + event->motion.yrel;
+            SDL_copyp(last, event);
+            last->motion.xrel = xrel;
+            last->motion.yrel = yrel;
+        }
+        break;
+    case SDL_EVENT_FINGER_MOTION:
+        if (last->tfinger.windowID != event->tfinger.windowID ||
+            last->tfinger.touchID != event->tfinger.touchID ||
+            last->tfinger.fingerID != event->tfinger.fingerID) {
+            return false;
+        } else {
+            const float dx = last->tfinger.dx + event->tfinger.dx;
+            const float dy = last->tfinger.dy + event->tfinger.dy;
+            SDL_copyp(last, event);
+            last->tfinger.dx = dx;
+            last->tfinger.dy = dy;
+        }
+        break;
+    case SDL_EVENT_PEN_MOTION:
+        if (last->pmotion.windowID != event->pmotion.windowID ||
+            last->pmotion.which != event->pmotion.which ||
+            last->pmotion.pen_state != event->pmotion.pen_state) {
+            return false;
+        }
+        SDL_copyp(last, event);
+        break;
+    case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        if (last->jaxis.which != event->jaxis.which ||
+            last->jaxis.axis != event->jaxis.axis) {
+            return false;
+        }
+        SDL_copyp(last, event);
+        break;
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        if (last->gaxis.which != event->gaxis.which ||
+            last->gaxis.axis != event->gaxis.axis) {
+            return false;
+        }
+        SDL_copyp(last, event);
+        break;
+    default:
+        return false;
+    }
+
+    ++SDL_EventQ.coalesced;
+    return true;
+}
+
 // Add an event to the event queue -- called with the queue locked
 static int SDL_AddEvent(SDL_Event *event)
 {
@@ -1046,6 +1220,14 @@ static int SDL_AddEvent(SDL_Event *event)
     const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
     int final_count;
 
+    if (SDL_coalesce_motion && SDL_CoalesceEvent(event)) {
+        if (SDL_EventLoggingVerbosity > 0) {
+            SDL_LogEvent(event);
+        }
+        ++SDL_last_event_id;
+        return 1;
+    }
+
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
@@ -1126,6 +1308,191 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
     SDL_AddAtomicInt(&SDL_EventQ.count, -1);
 }
 
+static SDL_EventRing *SDL_CreateEventRing(int size)
+{
+    SDL_EventRing *ring;
+    Uint32 capacity = 2;
+    Uint32 i;
+
+    while (capacity < (Uint32)size && capacity < SDL_MAX_QUEUED_EVENTS) {
+        capacity <<= 1;
+    }
+
+    ring = (SDL_EventRing *)SDL_malloc(sizeof(*ring) + (capacity - 1) * sizeof(SDL_EventRingSlot));
+    if (!ring) {
+        return NULL;
+    }
+    ring->mask = capacity - 1;
+    SDL_SetAtomicU32(&ring->enqueue_pos, 0);
+    SDL_SetAtomicU32(&ring->dequeue_pos, 0);
+    for (i = 0; i < capacity; ++i) {
+        SDL_SetAtomicU32(&ring->slots[i].sequence, i);
+    }
+    return ring;
+}
+
+// Events that own temporary memory must be linked to it on the thread that pushed them
+static bool SDL_EventRingAcceptsEvent(Uint32 type)
+{
+    switch (type) {
+    case SDL_EVENT_POLL_SENTINEL:
+    case SDL_EVENT_TEXT_EDITING:
+    case SDL_EVENT_TEXT_EDITING_CANDIDATES:
+    case SDL_EVENT_TEXT_INPUT:
+    case SDL_EVENT_DROP_BEGIN:
+    case SDL_EVENT_DROP_FILE:
+    case SDL_EVENT_DROP_TEXT:
+    case SDL_EVENT_DROP_COMPLETE:
+    case SDL_EVENT_DROP_POSITION:
+    case SDL_EVENT_CLIPBOARD_UPDATE:
+    case SDL2_SYSWMEVENT:
+        return false;
+    default:
+        return true;
+    }
+}
+
+// Claim a slot and copy the event into it, returns false if the ring is full
+static bool SDL_PushEventRing(SDL_EventRing *ring, const SDL_Event *event)
+{
+    SDL_EventRingSlot *slot;
+    Uint32 pos = SDL_GetAtomicU32(&ring->enqueue_pos);
+
+    for (;;) {
+        slot = &ring->slots[pos & ring->mask];
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&slot->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&ring->enqueue_pos, pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        }
+        pos = SDL_GetAtomicU32(&ring->enqueue_pos);
+    }
+
+    SDL_copyp(&slot->event, event);
+    SDL_SetAtomicU32(&slot->sequence, pos + 1);
+    return true;
+}
+
+// Add as many events as possible without locking, returns the number added
+static int SDL_AddEventsLockFree(const SDL_Event *events, int numevents)
+{
+    SDL_EventRing *ring;
+    int added = 0;
+
+    SDL_AddAtomicInt(&SDL_event_ring_users, 1);
+    ring = (SDL_EventRing *)SDL_GetAtomicPointer(&SDL_event_ring);
+    if (ring && SDL_EventQ.active) {
+        for (; added < numevents; ++added) {
+            const SDL_Event *event = &events[added];
+            const Uint32 pending = SDL_GetAtomicU32(&ring->enqueue_pos) - SDL_GetAtomicU32(&ring->dequeue_pos);
+
+            if (!SDL_EventRingAcceptsEvent(event->type)) {
+                break;
+            }
+            if (SDL_GetAtomicInt(&SDL_EventQ.count) + (int)pending >= SDL_MAX_QUEUED_EVENTS) {
+                break;  // let the locked path report the error
+            }
+            if (!SDL_PushEventRing(ring, event)) {
+                break;
+            }
+        }
+    }
+    SDL_AddAtomicInt(&SDL_event_ring_users, -1);
+
+    return added;
+}
+
+/* Move completed ring slots onto the event queue. Returns false if an event
+   couldn't be added; it stays in the ring and is retried by the next drain.
+   -- called with the queue locked */
+static bool SDL_DrainEventRingInternal(SDL_EventRing *ring)
+{
+    for (;;) {
+        const Uint32 pos = SDL_GetAtomicU32(&ring->dequeue_pos);
+        SDL_EventRingSlot *slot = &ring->slots[pos & ring->mask];
+
+        // Stop at the first slot that is empty or still being written
+        if (SDL_GetAtomicU32(&slot->sequence) != pos + 1) {
+            return true;
+        }
+        if (!SDL_AddEvent(&slot->event)) {
+            return false;
+        }
+        SDL_SetAtomicU32(&slot->sequence, pos + ring->mask + 1);
+        SDL_SetAtomicU32(&ring->dequeue_pos, pos + 1);
+    }
+}
+
+static bool SDL_DrainEventRing(void)
+{
+    SDL_EventRing *ring = (SDL_EventRing *)SDL_GetAtomicPointer(&SDL_event_ring);
+    if (ring) {
+        return SDL_DrainEventRingInternal(ring);
+    }
+    return true;
+}
+
+/* Wait until every ring slot claimed so far has been written, so the next drain
+   moves all of them onto the event queue. This keeps a thread's events in order
+   when it falls back to the locked path. Producers never need the queue lock to
+   finish a slot, so this must be called without it. */
+static void SDL_WaitForEventRing(void)
+{
+    SDL_EventRing *ring;
+
+    SDL_AddAtomicInt(&SDL_event_ring_users, 1);
+    ring = (SDL_EventRing *)SDL_GetAtomicPointer(&SDL_event_ring);
+    if (ring) {
+        const Uint32 end = SDL_GetAtomicU32(&ring->enqueue_pos);
+        Uint32 pos = SDL_GetAtomicU32(&ring->dequeue_pos);
+
+        for (; (Sint32)(end - pos) > 0; ++pos) {
+            SDL_EventRingSlot *slot = &ring->slots[pos & ring->mask];
+
+            // Done when the slot is written, or another thread already drained it
+            while (SDL_GetAtomicU32(&slot->sequence) != pos + 1 &&
+                   (Sint32)(SDL_GetAtomicU32(&ring->dequeue_pos) - pos) <= 0) {
+                SDL_Delay(0);
+            }
+        }
+    }
+    SDL_AddAtomicInt(&SDL_event_ring_users, -1);
+}
+
+// Replace the current ring, flushing the old one -- called with the queue locked
+static void SDL_SetEventRing(SDL_EventRing *ring)
+{
+    SDL_EventRing *old = (SDL_EventRing *)SDL_SetAtomicPointer(&SDL_event_ring, ring);
+    if (old) {
+        // Wait for any producers that might still be writing into the old ring
+        while (SDL_GetAtomicInt(&SDL_event_ring_users) > 0) {
+            SDL_CPUPauseInstruction();
+        }
+        if (!SDL_DrainEventRingInternal(old)) {
+            const Uint32 dropped = SDL_GetAtomicU32(&old->enqueue_pos) - SDL_GetAtomicU32(&old->dequeue_pos);
+            SDL_SetError("Dropped %u events that were pushed through the event ring", (unsigned int)dropped);
+        }
+        SDL_free(old);
+    }
+}
+
+static void SDLCALL SDL_EventQueueRingSizeChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    const int size = hint ? SDL_atoi(hint) : 0;
+    SDL_EventRing *ring = NULL;
+
+    if (size > 0) {
+        ring = SDL_CreateEventRing(size);  // if this fails we just use the locked path
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    SDL_SetEventRing(ring);
+    SDL_UnlockMutex(SDL_EventQ.lock);
+}
+
 static void SDL_SendWakeupEvent(void)
 {
 #ifdef SDL_PLATFORM_ANDROID
@@ -1150,9 +1517,21 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
 {
     int i, used, sentinels_expected = 0;
 
-    // Lock the event queue
-    used = 0;
+    if (action == SDL_ADDEVENT && events && numevents > 0) {
+        used = SDL_AddEventsLockFree(events, numevents);
+        if (used == numevents) {
+            SDL_SendWakeupEvent();
+            return used;
+        }
+        events += used;
+        numevents -= used;
+        // Anything this thread pushed through the ring must be queued first
+        SDL_WaitForEventRing();
+    } else {
+        used = 0;
+    }
 
+    // Lock the event queue
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
@@ -1162,7 +1541,8 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                 SDL_SetError("The event system has been shut down");
             }
             SDL_UnlockMutex(SDL_EventQ.lock);
-            return -1;
+            // Events already added through the ring still count, like a partial add below
+            return (used > 0) ? used : -1;
         }
         if (action == SDL_ADDEVENT) {
             CHECK_PARAM(!events) {
@@ -1170,13 +1550,18 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                 SDL_InvalidParamError("events");
                 return -1;
             }
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+            // If the ring couldn't be drained, adding more now would put them out of order
+            if (SDL_DrainEventRing()) {
+                for (i = 0; i < numevents; ++i) {
+                    used += SDL_AddEvent(&events[i]);
+                }
             }
         } else {
             SDL_EventEntry *entry, *next;
             Uint32 type;
 
+            SDL_DrainEventRing();
+
             for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
                 next = entry->next;
                 type = entry->event.type;
@@ -1221,6 +1606,20 @@ int SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
     return SDL_PeepEventsInternal(events, numevents, action, minType, maxType, false);
 }
 
+Uint64 SDL_GetCoalescedEventCount(void)
+{
+    Uint64 coalesced;
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        SDL_DrainEventRing();
+        coalesced = SDL_EventQ.coalesced;
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return coalesced;
+}
+
 bool SDL_HasEvent(Uint32 type)
 {
     return SDL_HasEvents(type, type);
@@ -1233,6 +1632,7 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         if (SDL_EventQ.active) {
+            SDL_DrainEventRing();
             for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -1273,6 +1673,7 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -1550,6 +1951,77 @@ bool SDL_PollEvent(SDL_Event *event)
     return SDL_WaitEventTimeoutNS(event, 0);
 }
 
+int SDL_PollEvents(SDL_Event *events, int numevents)
+{
+    SDL_EventEntry *entry, *first, *last = NULL;
+    int used = 0, removed = 0;
+
+    CHECK_PARAM(!events && numevents > 0) {
+        SDL_InvalidParamError("events");
+        return -1;
+    }
+    CHECK_PARAM(numevents < 0) {
+        SDL_InvalidParamError("numevents");
+        return -1;
+    }
+
+    // If there isn't a poll sentinel event pending, pump events and add one
+    if (SDL_GetAtomicInt(&SDL_sentinel_pending) == 0) {
+        SDL_PumpEventsInternal(true);
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (!SDL_EventQ.active) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            SDL_SetError("The event system has been shut down");
+            return -1;
+        }
+        SDL_DrainEventRing();
+
+        // Copy out a run of events from the head of the queue
+        first = SDL_EventQ.head;
+        for (entry = first; entry; entry = entry->next) {
+            /* Check this first, so a buffer that fills right at the end of the
+               cycle leaves the sentinel queued and the next call returns 0. */
+            if (used == numevents) {
+                break;
+            }
+            if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
+                const bool end_of_cycle = (SDL_AddAtomicInt(&SDL_sentinel_pending, -1) == 1);
+                last = entry;
+                ++removed;
+                if (end_of_cycle) {
+                    break;
+                }
+                continue;  // Skip it, there's another one pending
+            }
+            SDL_TransferTemporaryMemoryFromEvent(entry);
+            SDL_copyp(&events[used], &entry->event);
+            ++used;
+            last = entry;
+            ++removed;
+        }
+
+        // Move the whole run onto the free list at once
+        if (last) {
+            SDL_EventQ.head = last->next;
+            if (SDL_EventQ.head) {
+                SDL_EventQ.head->prev = NULL;
+            } else {
+                SDL_EventQ.tail = NULL;
+            }
+            last->next = SDL_EventQ.free;
+            SDL_EventQ.free = first;
+            SDL_assert(SDL_GetAtomicInt(&SDL_EventQ.count) >= removed);
+            SDL_AddAtomicInt(&SDL_EventQ.count, -removed);
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return used;
+}
+
 #ifndef SDL_PLATFORM_ANDROID
 
 static Sint64 SDL_events_get_polling_interval(void)
@@ -1827,6 +2299,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing();
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1874,6 +2347,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -2024,12 +2498,15 @@ bool SDL_InitEvents(void)
     SDL_AddHintCallback(SDL_HINT_AUTO_UPDATE_SENSORS, SDL_AutoUpdateSensorsChanged, NULL);
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     SDL_InitMainThreadCallbacks();
     if (!SDL_StartEventLoop()) {
+        SDL_RemoveHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
         SDL_RemoveHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return false;
     }
+    SDL_AddHintCallback(SDL_HINT_EVENT_QUEUE_RING_SIZE, SDL_EventQueueRingSizeChanged, NULL);
 
     SDL_InitQuit();
 
@@ -2039,9 +2516,11 @@ bool SDL_InitEvents(void)
 void SDL_QuitEvents(void)
 {
     SDL_QuitQuit();
+    SDL_RemoveHintCallback(SDL_HINT_EVENT_QUEUE_RING_SIZE, SDL_EventQueueRingSizeChanged, NULL);
     SDL_StopEventLoop();
     SDL_QuitMainThreadCallbacks();
     SDL_RemoveHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_RemoveHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_RemoveHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #ifndef SDL_JOYSTICK_DISABLED
     SDL_RemoveHintCallback(SDL_HINT_AUTO_UPDATE_JOYSTICKS, SDL_AutoUpdateJoysticksChanged, NULL);
@@ -0,0 +1,733 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_internal.h"
+
+#include "SDL_sysfilesystem.h"
+#include "../SDL_hashtable.h"
+
+#ifdef HAVE_INOTIFY
+#include <fcntl.h>
+#include <limits.h> // For the definition of NAME_MAX
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// A directory cache keeps the listing of every directory a glob has walked
+// through, so later globs over the same tree only have to match names in
+// memory. Directories are listed lazily, the first time a glob needs them,
+// and are listed again after they've been invalidated. On Linux, inotify
+// invalidates directories as they change; everywhere else the app has to
+// call SDL_InvalidateDirectoryCache() when it knows something changed.
+
+typedef struct DirCacheNode DirCacheNode;
+
+typedef struct DirCacheEntry
+{
+    char *name;
+    char *folded;        // casefolded name, made the first time a case-insensitive glob needs it.
+    SDL_PathType type;   // SDL_PATHTYPE_NONE until a glob needs to know if this is a directory.
+    DirCacheNode *node;  // the listing of this directory, once we've descended into it.
+} DirCacheEntry;
+
+struct DirCacheNode
+{
+    char *path;              // the path we hand to the enumerator.
+    char *dirname;           // what the enumerator prepends to names in this directory, if we've seen it.
+    DirCacheEntry *entries;  // sorted by name, with SDL_strcmp.
+    int num_entries;
+    bool valid;              // false if the listing needs to be read again.
+    int watch;               // inotify watch descriptor, or -1.
+};
+
+struct SDL_DirectoryCache
+{
+    SDL_Mutex *lock;
+    SDL_GlobEnumeratorFunc enumerator;
+    SDL_GlobGetPathInfoFunc getpathinfo;
+    void *fsuserdata;
+    DirCacheNode *root;
+#ifdef HAVE_INOTIFY
+    int inotify_fd;
+    SDL_HashTable *watches;  // watch descriptor -> DirCacheWatch
+#endif
+};
+
+#ifdef HAVE_INOTIFY
+// The same directory reached through symlinks gets the same watch descriptor,
+// so every node watching it is listed here, and the watch is removed when the
+// last of them goes away.
+typedef struct DirCacheWatch
+{
+    int watch;
+    DirCacheNode **nodes;
+    int num_nodes;
+    int capacity;
+} DirCacheWatch;
+#endif
+
+// A glob pattern, split up so literal path components can be looked up
+// directly instead of matching every name in their directory.
+typedef struct CompiledGlob
+{
+    const char *pattern;    // the whole pattern, casefolded if needed, or NULL to match everything.
+    char *folded;
+    char **segments;        // each '/'-separated component, or NULL for ones with wildcards.
+    int num_segments;
+    bool caseinsensitive;
+} CompiledGlob;
+
+typedef struct DirCacheGlobData
+{
+    SDL_DirectoryCache *cache;
+    const CompiledGlob *glob;
+    SDL_IOStream *string_stream;
+    int num_entries;
+} DirCacheGlobData;
+
+typedef struct DirCacheListing
+{
+    DirCacheNode *node;
+    DirCacheEntry *entries;
+    int num_entries;
+    int capacity;
+} DirCacheListing;
+
+static void FreeDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node);
+#ifdef HAVE_INOTIFY
+static void UnwatchDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node);
+#endif
+
+static void FreeDirCacheEntries(SDL_DirectoryCache *cache, DirCacheEntry *entries, int num_entries)
+{
+    for (int i = 0; i < num_entries; i++) {
+        SDL_free(entries[i].name);
+        SDL_free(entries[i].folded);
+        FreeDirCacheNode(cache, entries[i].node);
+    }
+    SDL_free(entries);
+}
+
+static void FreeDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node)
+{
+    if (!node) {
+        return;
+    }
+
+#ifdef HAVE_INOTIFY
+    UnwatchDirCacheNode(cache, node);
+#endif
+
+    FreeDirCacheEntries(cache, node->entries, node->num_entries);
+    SDL_free(node->dirname);
+    SDL_free(node->path);
+    SDL_free(node);
+}
+
+static DirCacheNode *CreateDirCacheNode(const char *path)
+{
+    DirCacheNode *node = (DirCacheNode *)SDL_calloc(1, sizeof(*node));
+    if (!node) {
+        return NULL;
+    }
+    node->path = SDL_strdup(path);
+    if (!node->path) {
+        SDL_free(node);
+        return NULL;
+    }
+    node->watch = -1;
+    return node;
+}
+
+static void InvalidateDirCacheNode(DirCacheNode *node, bool recursive)
+{
+    node->valid = false;
+    if (recursive) {
+        for (int i = 0; i < node->num_entries; i++) {
+            if (node->entries[i].node) {
+                InvalidateDirCacheNode(node->entries[i].node, true);
+            }
+        }
+    }
+}
+
+#ifdef HAVE_INOTIFY
+#ifdef HAVE_INOTIFY_INIT1
+static int SDL_inotify_init1(void)
+{
+    return inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+}
+#else
+static int SDL_inotify_init1(void)
+{
+    int fd = inotify_init();
+    if (fd < 0) {
+        return -1;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+#endif
+
+static void FreeDirCacheWatch(DirCacheWatch *watch)
+{
+    for (int i = 0; i < watch->num_nodes; i++) {
+        watch->nodes[i]->watch = -1;
+    }
+    SDL_free(watch->nodes);
+    SDL_free(watch);
+}
+
+static void WatchDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node)
+{
+    const Uint32 mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+    DirCacheWatch *watch = NULL;
+
+    if (cache->inotify_fd < 0 || node->watch >= 0) {
+        return;
+    }
+
+    const int wd = inotify_add_watch(cache->inotify_fd, node->path, mask);
+    if (wd < 0) {
+        return;  // we'll just have to rely on the app to invalidate this one.
+    }
+
+    if (!SDL_FindInHashTable(cache->watches, (const void *)(uintptr_t)wd, (const void **)&watch)) {
+        watch = (DirCacheWatch *)SDL_calloc(1, sizeof(*watch));
+        if (!watch) {
+            inotify_rm_watch(cache->inotify_fd, wd);
+            return;
+        }
+        watch->watch = wd;
+        if (!SDL_InsertIntoHashTable(cache->watches, (const void *)(uintptr_t)wd, watch, false)) {
+            SDL_free(watch);
+            inotify_rm_watch(cache->inotify_fd, wd);
+            return;
+        }
+    }
+
+    if (watch->num_nodes >= watch->capacity) {
+        const int capacity = watch->capacity ? (watch->capacity * 2) : 2;
+        DirCacheNode **nodes = (DirCacheNode **)SDL_realloc(watch->nodes, capacity * sizeof(*nodes));
+        if (!nodes) {
+            if (watch->num_nodes == 0) {
+                SDL_RemoveFromHashTable(cache->watches, (const void *)(uintptr_t)wd);
+                FreeDirCacheWatch(watch);
+                inotify_rm_watch(cache->inotify_fd, wd);
+            }
+            return;
+        }
+        watch->nodes = nodes;
+        watch->capacity = capacity;
+    }
+    watch->nodes[watch->num_nodes++] = node;
+    node->watch = wd;
+}
+
+static void UnwatchDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node)
+{
+    DirCacheWatch *watch = NULL;
+
+    if (node->watch < 0) {
+        return;
+    }
+    if (SDL_FindInHashTable(cache->watches, (const void *)(uintptr_t)node->watch, (const void **)&watch)) {
+        for (int i = 0; i < watch->num_nodes; i++) {
+            if (watch->nodes[i] == node) {
+                watch->nodes[i] = watch->nodes[--watch->num_nodes];
+                break;
+            }
+        }
+        if (watch->num_nodes == 0) {  // nobody else is looking at this directory.
+            SDL_RemoveFromHashTable(cache->watches, (const void *)(uintptr_t)watch->watch);
+            inotify_rm_watch(cache->inotify_fd, watch->watch);
+            FreeDirCacheWatch(watch);
+        }
+    }
+    node->watch = -1;
+}
+
+static void ProcessDirCacheEvents(SDL_DirectoryCache *cache)
+{
+    if (cache->inotify_fd < 0) {
+        return;
+    }
+
+    union
+    {
+        struct inotify_event event;
+        char storage[4096];
+        char enough_for_inotify[sizeof(struct inotify_event) + NAME_MAX + 1];
+    } buf;
+
+    for (;;) {
+        const ssize_t bytes = read(cache->inotify_fd, &buf, sizeof(buf));
+        if (bytes <= 0) {
+            break;  // EAGAIN, nothing else pending.
+        }
+
+        size_t offset = 0;
+        while (offset + sizeof(struct inotify_event) <= (size_t)bytes) {
+            struct inotify_event event;
+            SDL_memcpy(&event, &buf.storage[offset], sizeof(event));
+            offset += sizeof(struct inotify_event) + event.len;
+
+            if (event.mask & IN_Q_OVERFLOW) {
+                InvalidateDirCacheNode(cache->root, true);  // we lost track of what changed.
+                continue;
+            }
+
+            DirCacheWatch *watch = NULL;
+            if (!SDL_FindInHashTable(cache->watches, (const void *)(uintptr_t)event.wd, (const void **)&watch)) {
+                continue;  // probably a watch we already removed.
+            }
+
+            for (int i = 0; i < watch->num_nodes; i++) {
+                watch->nodes[i]->valid = false;
+            }
+            if (event.mask & IN_IGNORED) {  // the kernel dropped this watch, because the directory is gone.
+                SDL_RemoveFromHashTable(cache->watches, (const void *)(uintptr_t)event.wd);
+                FreeDirCacheWatch(watch);
+            }
+        }
+    }
+}
+#endif // HAVE_INOTIFY
+
+static int SDLCALL CompareDirCacheEntries(const void *a, const void *b)
+{
+    return SDL_strcmp(((const DirCacheEntry *)a)->name, ((const DirCacheEntry *)b)->name);
+}
+
+static SDL_EnumerationResult SDLCALL DirCacheListCallback(void *userdata, const char *dirname, const char *fname)
+{
+    DirCacheListing *listing = (DirCacheListing *)userdata;
+
+    if (!listing->node->dirname) {
+        listing->node->dirname = SDL_strdup(dirname);
+        if (!listing->node->dirname) {
+            return SDL_ENUM_FAILURE;
+        }
+    }
+
+    if (listing->num_entries >= listing->capacity) {
+        const int capacity = listing->capacity ? (listing->capacity * 2) : 16;
+        DirCacheEntry *entries = (DirCacheEntry *)SDL_realloc(listing->entries, capacity * sizeof(*entries));
+        if (!entries) {
+            return SDL_ENUM_FAILURE;
+        }
+        listing->entries = entries;
+        listing->capacity = capacity;
+    }
+
+    DirCacheEntry *entry = &listing->entries[listing->num_entries];
+    SDL_zerop(entry);
+    entry->name = SDL_strdup(fname);
+    if (!entry->name) {
+        return SDL_ENUM_FAILURE;
+    }
+    listing->num_entries++;
+    return SDL_ENUM_CONTINUE;
+}
+
+// (Re)read a directory's listing. Subdirectories that are still there keep their own cached listings.
+static bool RefreshDirCacheNode(SDL_DirectoryCache *cache, DirCacheNode *node)
+{
+    DirCacheListing listing;
+    SDL_zero(listing);
+    listing.node = node;
+
+#ifdef HAVE_INOTIFY
+    WatchDirCacheNode(cache, node);  // start watching before we read, so we can't miss a change in between.
+#endif
+
+    if (!cache->enumerator(node->path, DirCacheListCallback, &listing, cache->fsuserdata)) {
+        FreeDirCacheEntries(cache, listing.entries, listing.num_entries);
+        return false;
+    }
+
+    if (listing.num_entries > 1) {
+        SDL_qsort(listing.entries, listing.num_entries, sizeof(*listing.entries), CompareDirCacheEntries);
+    }
+
+    // both lists are sorted, so walk them together to move the subdirectory listings over.
+    int old = 0;
+    for (int i = 0; i < listing.num_entries; i++) {
+        DirCacheEntry *entry = &listing.entries[i];
+        int cmp = 1;
+        while (old < node->num_entries && (cmp = SDL_strcmp(node->entries[old].name, entry->name)) < 0) {
+            old++;
+        }
+        if (old < node->num_entries && cmp == 0) {
+            // the type isn't carried over, since this might be a new file or directory with the same name.
+            entry->node = node->entries[old].node;
+            entry->folded = node->entries[old].folded;
+            node->entries[old].node = NULL;
+            node->entries[old].folded = NULL;
+            old++;
+        }
+    }
+
+    FreeDirCacheEntries(cache, node->entries, node->num_entries);  // anything left in here was deleted.
+    node->entries = listing.entries;
+    node->num_entries = listing.num_entries;
+    node->valid = true;
+    return true;
+}
+
+static bool CompileGlob(CompiledGlob *glob, const char *pattern, SDL_GlobFlags flags)
+{
+    SDL_zerop(glob);
+    if (!pattern) {
+        return true;  // matches everything, nothing to compile.
+    }
+
+    glob->caseinsensitive = ((flags & SDL_GLOB_CASEINSENSITIVE) != 0);
+    if (glob->caseinsensitive) {
+        glob->folded = SDL_InternalCaseFoldString(pattern);
+        if (!glob->folded) {
+            return false;
+        }
+        pattern = glob->folded;
+    }
+    glob->pattern = pattern;
+
+    int num_segments = 1;
+    for (const char *ptr = pattern; *ptr; ptr++) {
+        if (*ptr == '/') {
+            num_segments++;
+        }
+    }
+
+    glob->segments = (char **)SDL_calloc(num_segments, sizeof(char *));
+    if (!glob->segments) {
+        SDL_free(glob->folded);
+        return false;
+    }
+    glob->num_segments = num_segments;
+
+    const char *start = pattern;
+    for (int i = 0; i < num_segments; i++) {
+        const char *end = SDL_strchr(start, '/');
+        const size_t len = end ? (size_t)(end - start) : SDL_strlen(start);
+        bool literal = true;
+        for (size_t j = 0; j < len; j++) {
+            if (start[j] == '*' || start[j] == '?') {
+                literal = false;
+                break;
+            }
+        }
+        if (literal) {
+            glob->segments[i] = SDL_strndup(start, len);  // if this fails, we just match this one the slow way.
+        }
+        start = end ? (end + 1) : (start + len);
+    }
+    return true;
+}
+
+static void FreeCompiledGlob(CompiledGlob *glob)
+{
+    for (int i = 0; i < glob->num_segments; i++) {
+        SDL_free(glob->segments[i]);
+    }
+    SDL_free(glob->segments);
+    SDL_free(glob->folded);
+}
+
+static bool GlobDirCacheNode(DirCacheGlobData *data, DirCacheNode *node, const char *relpath, const char *foldedpath, int depth);
+
+static bool GlobDirCacheEntry(DirCacheGlobData *data, DirCacheNode *node, DirCacheEntry *entry, const char *relpath, const char *foldedpath, int depth)
+{
+    SDL_DirectoryCache *cache = data->cache;
+    const CompiledGlob *glob = data->glob;
+    bool result = false;
+
+    if (glob->caseinsensitive && !entry->folded) {
+        entry->folded = SDL_InternalCaseFoldString(entry->name);
+        if (!entry->folded) {
+            return false;
+        }
+    }
+
+    char *path = NULL;
+    char *folded = NULL;
+    if (SDL_asprintf(&path, "%s%s", relpath, entry->name) < 0) {
+        return false;
+    }
+    if (glob->caseinsensitive && SDL_asprintf(&folded, "%s%s", foldedpath, entry->folded) < 0) {
+        goto done;
+    }
+
+    bool matched_to_dir = false;
+    const bool matched = SDL_InternalGlobMatch(glob->pattern, folded ? folded : path, &matched_to_dir);
+
+    if (matched) {
+        const size_t slen = SDL_strlen(path) + 1;
+        if (SDL_WriteIO(data->string_stream, path, slen) != slen) {
+            goto done;
+        }
+        data->num_entries++;
+    }
+
+    if (matched_to_dir) {
+        char *fullpath = NULL;
+        if (SDL_asprintf(&fullpath, "%s%s", node->dirname ? node->dirname : "", entry->name) < 0) {
+            goto done;
+        }
+
+        if (entry->type == SDL_PATHTYPE_NONE) {
+            SDL_PathInfo info;
+            entry->type = cache->getpathinfo(fullpath, &info, cache->fsuserdata) ? info.type : SDL_PATHTYPE_OTHER;
+        }
+
+        if (entry->type != SDL_PATHTYPE_DIRECTORY) {
+            FreeDirCacheNode(cache, entry->node);  // this used to be a directory.
+            entry->node = NULL;
+        } else if (!entry->node) {
+            entry->node = CreateDirCacheNode(fullpath);
+        }
+        SDL_free(fullpath);
+
+        if (entry->type == SDL_PATHTYPE_DIRECTORY) {
+            char *subpath = NULL;
+            char *subfolded = NULL;
+            if (!entry->node || SDL_asprintf(&subpath, "%s/", path) < 0) {
+                goto done;
+            }
+            if (folded && SDL_asprintf(&subfolded, "%s/", folded) < 0) {
+                SDL_free(subpath);
+                goto done;
+            }
+            const bool okay = GlobDirCacheNode(data, entry->node, subpath, subfolded ? subfolded : subpath, depth + 1);
+            SDL_free(subfolded);
+            SDL_free(subpath);
+            if (!okay) {
+                goto done;
+            }
+        }
+    }
+
+    result = true;
+
+done:
+    SDL_free(folded);
+    SDL_free(path);
+    return result;
+}
+
+static bool GlobDirCacheNode(DirCacheGlobData *data, DirCacheNode *node, const char *relpath, const char *foldedpath, int depth)
+{
+    const CompiledGlob *glob = data->glob;
+
+    if (!node->valid && !RefreshDirCacheNode(data->cache, node)) {
+        return false;
+    }
+
+    const char *literal = (depth < glob->num_segments) ? glob->segments[depth] : NULL;
+    if (literal && !glob->caseinsensitive) {
+        // only one name in here can possibly match, so look it up instead of trying them all.
+        DirCacheEntry key;
+        SDL_zero(key);
+        key.name = (char *)literal;
+        DirCacheEntry *entry = (DirCacheEntry *)SDL_bsearch(&key, node->entries, node->num_entries, sizeof(*node->entries), CompareDirCacheEntries);
+        return entry ? GlobDirCacheEntry(data, node, entry, relpath, foldedpath, depth) : true;
+    }
+
+    for (int i = 0; i < node->num_entries; i++) {
+        DirCacheEntry *entry = &node->entries[i];
+        if (literal) {  // case-insensitive, so compare folded names, but we can still skip the rest of the work.
+            if (!entry->folded) {
+                entry->folded = SDL_InternalCaseFoldString(entry->name);
+                if (!entry->folded) {
+                    return false;
+                }
+            }
+            if (SDL_strcmp(entry->folded, literal) != 0) {
+                continue;
+            }
+        }
+        if (!GlobDirCacheEntry(data, node, entry, relpath, foldedpath, depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static DirCacheNode *FindDirCacheNode(DirCacheNode *node, const char *path)
+{
+    while (node && *path) {
+        const char *end = SDL_strchr(path, '/');
+        const size_t len = end ? (size_t)(end - path) : SDL_strlen(path);
+        DirCacheNode *child = NULL;
+        for (int i = 0; i < node->num_entries; i++) {
+            const DirCacheEntry *entry = &node->entries[i];
+            if (SDL_strncmp(entry->name, path, len) == 0 && entry->name[len] == '\0') {
+                child = entry->node;
+                break;
+            }
+        }
+        node = child;
+        path += len;
+        while (*path == '/') {
+            path++;
+        }
+    }
+    return node;
+}
+
+SDL_DirectoryCache *SDL_InternalCreateDirectoryCache(const char *path, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata, bool watch)
+{
+    SDL_DirectoryCache *cache = (SDL_DirectoryCache *)SDL_calloc(1, sizeof(*cache));
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->enumerator = enumerator;
+    cache->getpathinfo = getpathinfo;
+    cache->fsuserdata = userdata;
+#ifdef HAVE_INOTIFY
+    cache->inotify_fd = -1;
+#endif
+
+    // if path ends with any slash, chop them off, the same as SDL_InternalGlobDirectory.
+    char *pathcpy = SDL_strdup(path);
+    if (!pathcpy) {
+        SDL_free(cache);
+        return NULL;
+    }
+    size_t pathlen = SDL_strlen(pathcpy);
+    while ((pathlen > 1) && ((pathcpy[pathlen - 1] == '/') || (pathcpy[pathlen - 1] == '\\'))) {
+        pathcpy[--pathlen] = '\0';
+    }
+
+    cache->root = CreateDirCacheNode(pathcpy);
+    SDL_free(pathcpy);
+    cache->lock = SDL_CreateMutex();
+    if (!cache->root || !cache->lock) {
+        SDL_DestroyDirectoryCache(cache);
+        return NULL;
+    }
+
+#ifdef HAVE_INOTIFY
+    if (watch) {
+        cache->watches = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+        if (!cache->watches) {
+            SDL_DestroyDirectoryCache(cache);
+            return NULL;
+        }
+        cache->inotify_fd = SDL_inotify_init1();  // if this fails, the app has to invalidate the cache itself.
+    }
+#endif
+
+    return cache;
+}
+
+SDL_DirectoryCache *SDL_CreateDirectoryCache(const char *path)
+{
+    CHECK_PARAM(!path) {
+        SDL_InvalidParamError("path");
+        return NULL;
+    }
+    return SDL_InternalCreateDirectoryCache(path, SDL_InternalGlobDirectoryEnumerator, SDL_InternalGlobDirectoryGetPathInfo, NULL, true);
+}
+
+char **SDL_GlobDirectoryCache(SDL_DirectoryCache *cache, const char *pattern, SDL_GlobFlags flags, int *count)
+{
+    int dummycount;
+    if (!count) {
+        count = &dummycount;
+    }
+    *count = 0;
+
+    CHECK_PARAM(!cache) {
+        SDL_InvalidParamError("cache");
+        return NULL;
+    }
+
+    CompiledGlob glob;
+    if (!CompileGlob(&glob, pattern, flags)) {
+        return NULL;
+    }
+
+    DirCacheGlobData data;
+    SDL_zero(data);
+    data.cache = cache;
+    data.glob = &glob;
+    data.string_stream = SDL_IOFromDynamicMem();
+    if (!data.string_stream) {
+        FreeCompiledGlob(&glob);
+        return NULL;
+    }
+
+    char **result = NULL;
+    SDL_LockMutex(cache->lock);
+#ifdef HAVE_INOTIFY
+    ProcessDirCacheEvents(cache);
+#endif
+    const bool okay = GlobDirCacheNode(&data, cache->root, "", "", 0);
+    SDL_UnlockMutex(cache->lock);
+
+    if (okay) {
+        result = SDL_InternalCreateGlobList(data.string_stream, data.num_entries);
+        if (result) {
+            *count = data.num_entries;
+        }
+    }
+
+    SDL_CloseIO(data.string_stream);
+    FreeCompiledGlob(&glob);
+    return result;
+}
+
+bool SDL_InvalidateDirectoryCache(SDL_DirectoryCache *cache, const char *path)
+{
+    CHECK_PARAM(!cache) {
+        return SDL_InvalidParamError("cache");
+    }
+
+    SDL_LockMutex(cache->lock);
+    DirCacheNode *node = FindDirCacheNode(cache->root, path ? path : "");
+    if (node) {
+        InvalidateDirCacheNode(node, true);
+    } else {
+        InvalidateDirCacheNode(cache->root, true);  // not a directory we've cached, so we can't be more specific than this.
+    }
+    SDL_UnlockMutex(cache->lock);
+    return true;
+}
+
+void SDL_DestroyDirectoryCache(SDL_DirectoryCache *cache)
+{
+    if (!cache) {
+        return;
+    }
+
+    FreeDirCacheNode(cache, cache->root);
+#ifdef HAVE_INOTIFY
+    if (cache->inotify_fd >= 0) {
+        close(cache->inotify_fd);
+    }
+    SDL_DestroyHashTable(cache->watches);
+#endif
+    SDL_DestroyMutex(cache->lock);
+    SDL_free(cache);
+}
@@ -208,6 +208,11 @@ static bool WildcardMatch(const char *pattern, const char *str, bool *matched_to
     return (pch == '\0');  // survived the whole pattern? That's a match!
 }
 
+bool SDL_InternalGlobMatch(const char *pattern, const char *str, bool *matched_to_dir)
+{
+    return pattern ? WildcardMatch(pattern, str, matched_to_dir) : EverythingMatch(pattern, str, matched_to_dir);
+}
+
 
 // Note that this will currently encode illegal codepoints: UTF-16 surrogates, 0xFFFE, and 0xFFFF.
 // and a codepoint > 0x10FFFF will fail the same as if there wasn't enough memory.
@@ -287,6 +292,11 @@ static char *CaseFoldUtf8String(const char *fname)
     return result;
 }
 
+char *SDL_InternalCaseFoldString(const char *str)
+{
+    return CaseFoldUtf8String(str);
+}
+
 
 typedef struct GlobDirCallbackData
 {
@@ -358,6 +368,28 @@ static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const
     return result;
 }
 
+char **SDL_InternalCreateGlobList(SDL_IOStream *string_stream, int num_entries)
+{
+    const size_t streamlen = (size_t) SDL_GetIOSize(string_stream);
+    const size_t buflen = streamlen + ((num_entries + 1) * sizeof (char *));  // +1 for NULL terminator at end of array.
+    char **result = (char **) SDL_malloc(buflen);
+    if (result) {
+        if (num_entries > 0) {
+            Sint64 iorc = SDL_SeekIO(string_stream, 0, SDL_IO_SEEK_SET);
+            SDL_assert(iorc == 0);  // this should never fail for a memory stream!
+            char *ptr = (char *) (result + (num_entries + 1));
+            iorc = SDL_ReadIO(string_stream, ptr, streamlen);
+            SDL_assert(iorc == (Sint64) streamlen);  // this should never fail for a memory stream!
+            for (int i = 0; i < num_entries; i++) {
+                result[i] = ptr;
+                ptr += SDL_strlen(ptr) + 1;
+            }
+        }
+        result[num_entries] = NULL;  // NULL terminate the list.
+    }
+    return result;
+}
+
 char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata)
 {
     int dummycount;
@@ -445,22 +477,8 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
 
     char **result = NULL;
     if (data.enumerator(path, GlobDirectoryCallback, &data, data.fsuserdata)) {
-        const size_t streamlen = (size_t) SDL_GetIOSize(data.string_stream);
-        const size_t buflen = streamlen + ((data.num_entries + 1) * sizeof (char *));  // +1 for NULL terminator at end of array.
-        result = (char **) SDL_malloc(buflen);
+        result = SDL_InternalCreateGlobList(data.string_stream, data.num_entries);
         if (result) {
-            if (data.num_entries > 0) {
-                Sint64 iorc = SDL_SeekIO(data.string_stream, 0, SDL_IO_SEEK_SET);
-                SDL_assert(iorc == 0);  // this should never fail for a memory stream!
-                char *ptr = (char *) (result + (data.num_entries + 1));
-                iorc = SDL_ReadIO(data.string_stream, ptr, streamlen);
-                SDL_assert(iorc == (Sint64) streamlen);  // this should never fail for a memory stream!
-                for (int i = 0; i < data.num_entries; i++) {
-                    result[i] = ptr;
-                    ptr += SDL_strlen(ptr) + 1;
-                }
-            }
-            result[data.num_entries] = NULL;  // NULL terminate the list.
             *count = data.num_entries;
         }
     }
@@ -472,12 +490,12 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
     return result;
 }
 
-static bool GlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void *userdata)
+bool SDL_InternalGlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void *userdata)
 {
     return SDL_GetPathInfo(path, info);
 }
 
-static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+bool SDL_InternalGlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
 {
     return SDL_EnumerateDirectory(path, cb, cbuserdata);
 }
@@ -485,7 +503,7 @@ static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCall
 char **SDL_GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
 {
     //SDL_Log("SDL_GlobDirectory('%s', '%s') ...", path, pattern);
-    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobDirectoryEnumerator, GlobDirectoryGetPathInfo, NULL);
+    return SDL_InternalGlobDirectory(path, pattern, flags, count, SDL_InternalGlobDirectoryEnumerator, SDL_InternalGlobDirectoryGetPathInfo, NULL);
 }
 
 
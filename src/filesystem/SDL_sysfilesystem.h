@@ -39,5 +39,15 @@ typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryC
 typedef bool (*SDL_GlobGetPathInfoFunc)(const char *path, SDL_PathInfo *info, void *userdata);
 extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata);
 
+// the pieces of SDL_GlobDirectory that SDL_DirectoryCache shares.
+extern bool SDL_InternalGlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
+extern bool SDL_InternalGlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void *userdata);
+extern bool SDL_InternalGlobMatch(const char *pattern, const char *str, bool *matched_to_dir);
+extern char *SDL_InternalCaseFoldString(const char *str);
+extern char **SDL_InternalCreateGlobList(SDL_IOStream *string_stream, int num_entries);
+
+// `watch` asks for the platform's change notifications, if it has any; only use that for real directories.
+extern SDL_DirectoryCache *SDL_InternalCreateDirectoryCache(const char *path, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata, bool watch);
+
 #endif
 
@@ -86,6 +86,31 @@ Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return asyncio->iface.size(asyncio->userdata);
 }
 
+static void TaskStarted(SDL_AsyncIOQueue *queue, int inflight)
+{
+    SDL_LockSpinlock(&queue->stats_lock);
+    queue->stats.tasks_started++;
+    if (inflight > queue->stats.max_tasks_pending) {
+        queue->stats.max_tasks_pending = inflight;
+    }
+    SDL_UnlockSpinlock(&queue->stats_lock);
+}
+
+static void TaskCompleted(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIOQueue *queue = task->queue;
+    const Uint64 end_ns = task->complete_ns ? task->complete_ns : SDL_GetTicksNS();
+    const Uint64 latency = (end_ns > task->start_ns) ? (end_ns - task->start_ns) : 0;
+
+    SDL_LockSpinlock(&queue->stats_lock);
+    queue->stats.tasks_completed++;
+    queue->stats.total_latency_ns += latency;
+    if (latency > queue->stats.max_latency_ns) {
+        queue->stats.max_latency_ns = latency;
+    }
+    SDL_UnlockSpinlock(&queue->stats_lock);
+}
+
 static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
     CHECK_PARAM(!asyncio) {
@@ -110,6 +135,7 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     task->requested_size = size;
     task->app_userdata = userdata;
     task->queue = queue;
+    task->start_ns = SDL_GetTicksNS();
 
     SDL_LockMutex(asyncio->lock);
     if (asyncio->closing) {
@@ -118,9 +144,11 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
         return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
     }
     LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
-    SDL_AddAtomicInt(&queue->tasks_inflight, 1);
+    const int inflight = SDL_AddAtomicInt(&queue->tasks_inflight, 1) + 1;
     SDL_UnlockMutex(asyncio->lock);
 
+    TaskStarted(queue, inflight);
+
     const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
     if (!queued) {
         SDL_AddAtomicInt(&queue->tasks_inflight, -1);
@@ -166,12 +194,13 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
         task->app_userdata = userdata;
         task->queue = queue;
         task->flush = flush;
+        task->start_ns = SDL_GetTicksNS();
 
         asyncio->closing = task;
 
         if (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL) { // no tasks? Queue the close task now.
             LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
-            SDL_AddAtomicInt(&queue->tasks_inflight, 1);
+            TaskStarted(queue, SDL_AddAtomicInt(&queue->tasks_inflight, 1) + 1);
             if (!asyncio->iface.close(asyncio->userdata, task)) {
                 // uhoh, maybe they can try again later...?
                 SDL_AddAtomicInt(&queue->tasks_inflight, -1);
@@ -187,12 +216,12 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
     return (task != NULL);
 }
 
-SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
+SDL_AsyncIOQueue *SDL_CreateAsyncIOQueueWithProperties(SDL_PropertiesID props)
 {
     SDL_AsyncIOQueue *queue = SDL_calloc(1, sizeof (*queue));
     if (queue) {
         SDL_SetAtomicInt(&queue->tasks_inflight, 0);
-        if (!SDL_SYS_CreateAsyncIOQueue(queue)) {
+        if (!SDL_SYS_CreateAsyncIOQueue(queue, props)) {
             SDL_free(queue);
             return NULL;
         }
@@ -200,6 +229,50 @@ SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
     return queue;
 }
 
+SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
+{
+    return SDL_CreateAsyncIOQueueWithProperties(0);
+}
+
+bool SDL_BeginAsyncIOBatch(SDL_AsyncIOQueue *queue)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    if (!queue->iface.begin_batch) {
+        return true;  // tasks just start right away.
+    }
+    return queue->iface.begin_batch(queue->userdata);
+}
+
+bool SDL_SubmitAsyncIOBatch(SDL_AsyncIOQueue *queue)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    if (!queue->iface.submit_batch) {
+        return true;  // tasks already started.
+    }
+    return queue->iface.submit_batch(queue->userdata);
+}
+
+bool SDL_RegisterAsyncIOBuffers(SDL_AsyncIOQueue *queue, void * const *buffers, const size_t *sizes, int num_buffers)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    CHECK_PARAM(num_buffers < 0) {
+        return SDL_InvalidParamError("num_buffers");
+    }
+    CHECK_PARAM(num_buffers > 0 && (!buffers || !sizes)) {
+        return SDL_InvalidParamError(!buffers ? "buffers" : "sizes");
+    }
+    if (!queue->iface.register_buffers) {
+        return true;  // memory is used as-is.
+    }
+    return queue->iface.register_buffers(queue->userdata, buffers, sizes, num_buffers);
+}
+
 static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *outcome)
 {
     if (!task || !outcome) {
@@ -209,7 +282,7 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     SDL_AsyncIO *asyncio = task->asyncio;
 
     SDL_zerop(outcome);
-    outcome->asyncio = asyncio->oneshot ? NULL : asyncio;
+    outcome->asyncio = (!asyncio || asyncio->oneshot || asyncio->saving) ? NULL : asyncio;
     outcome->result = task->result;
     outcome->type = task->type;
     outcome->buffer = task->buffer;
@@ -218,6 +291,19 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     outcome->bytes_transferred = task->result_size;
     outcome->userdata = task->app_userdata;
 
+    if (!asyncio) {  // this came from SDL_InternalQueueAsyncIOResult, there's no file to clean up.
+        TaskCompleted(task);
+        SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
+        SDL_free(task);
+        return true;
+    }
+
+    bool retval = true;
+    if (asyncio->saving && (task->type == SDL_ASYNCIO_TASK_WRITE)) {
+        SDL_copyp(&asyncio->save_outcome, outcome);  // hold this back until the file is closed.
+        retval = false;
+    }
+
     // Take the completed task out of the SDL_AsyncIO that created it.
     SDL_Mutex *lock = asyncio->lock;
     SDL_LockMutex(lock);
@@ -226,7 +312,7 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     SDL_AsyncIOTask *closing = asyncio->closing;
     if (closing && (task != closing) && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) {
         LINKED_LIST_PREPEND(closing, asyncio->tasks, asyncio);
-        SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1);
+        TaskStarted(closing->queue, SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1) + 1);
         const bool async_close_task_was_queued = asyncio->iface.close(asyncio->userdata, closing);
         SDL_assert(async_close_task_was_queued);  // !!! FIXME: if this fails to queue the task, we're leaking resources!
         if (!async_close_task_was_queued) {
@@ -236,28 +322,62 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     SDL_UnlockMutex(lock);
 
     // was this the result of a closing task? Finally destroy the asyncio.
-    bool retval = true;
     if (closing && (task == closing)) {
         if (asyncio->oneshot) {
             retval = false;  // don't send the close task results on to the app, just the read task for these.
+        } else if (asyncio->saving) {
+            // report the write now that it's on disk; a failed flush or close fails the whole save.
+            const SDL_AsyncIOResult close_result = outcome->result;
+            SDL_copyp(outcome, &asyncio->save_outcome);
+            if (outcome->result == SDL_ASYNCIO_COMPLETE) {
+                outcome->result = close_result;
+            }
         }
         asyncio->iface.destroy(asyncio->userdata);
         SDL_DestroyMutex(asyncio->lock);
         SDL_free(asyncio);
     }
 
+    TaskCompleted(task);
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
     SDL_free(task);
 
     return retval;
 }
 
+static SDL_AsyncIOTask *GetReadyTask(SDL_AsyncIOQueue *queue)
+{
+    SDL_AsyncIOTask *task;
+
+    // cheap check before taking the lock, since this list is almost always empty.
+    if (!SDL_GetAtomicPointer((void **) &queue->ready_head)) {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&queue->ready_lock);
+    task = queue->ready_head;
+    if (task) {
+        queue->ready_head = task->queuenext;
+        if (!queue->ready_head) {
+            queue->ready_tail = NULL;
+        }
+        task->queuenext = NULL;
+    }
+    SDL_UnlockSpinlock(&queue->ready_lock);
+    return task;
+}
+
 bool SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
 {
     if (!queue || !outcome) {
         return false;
     }
-    return GetAsyncIOTaskOutcome(queue->iface.get_results(queue->userdata), outcome);
+
+    SDL_AsyncIOTask *task = GetReadyTask(queue);
+    if (!task) {
+        task = queue->iface.get_results(queue->userdata);
+    }
+    return GetAsyncIOTaskOutcome(task, outcome);
 }
 
 bool SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeoutMS)
@@ -265,7 +385,62 @@ bool SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome,
     if (!queue || !outcome) {
         return false;
     }
-    return GetAsyncIOTaskOutcome(queue->iface.wait_results(queue->userdata, timeoutMS), outcome);
+
+    SDL_AsyncIOTask *task = GetReadyTask(queue);
+    if (!task) {
+        task = queue->iface.wait_results(queue->userdata, timeoutMS);
+        if (!task) {
+            task = GetReadyTask(queue);  // we might have been woken up by SDL_InternalQueueAsyncIOResult.
+        }
+    }
+    return GetAsyncIOTaskOutcome(task, outcome);
+}
+
+bool SDL_InternalQueueAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOTaskType type, SDL_AsyncIOResult result, void *buffer, Uint64 requested_size, Uint64 result_size, void *userdata)
+{
+    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+    if (!task) {
+        return false;
+    }
+
+    task->type = type;
+    task->queue = queue;
+    task->buffer = buffer;
+    task->result = result;
+    task->requested_size = requested_size;
+    task->result_size = result_size;
+    task->app_userdata = userdata;
+    task->start_ns = task->complete_ns = SDL_GetTicksNS();
+
+    TaskStarted(queue, SDL_AddAtomicInt(&queue->tasks_inflight, 1) + 1);
+
+    SDL_LockSpinlock(&queue->ready_lock);
+    if (queue->ready_tail) {
+        queue->ready_tail->queuenext = task;
+    } else {
+        queue->ready_head = task;
+    }
+    queue->ready_tail = task;
+    SDL_UnlockSpinlock(&queue->ready_lock);
+
+    queue->iface.signal(queue->userdata);  // wake up anything blocking in SDL_WaitAsyncIOResult.
+    return true;
+}
+
+bool SDL_GetAsyncIOQueueStats(SDL_AsyncIOQueue *queue, SDL_AsyncIOQueueStats *stats)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    CHECK_PARAM(!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_LockSpinlock(&queue->stats_lock);
+    SDL_copyp(stats, &queue->stats);
+    SDL_UnlockSpinlock(&queue->stats_lock);
+    stats->tasks_pending = SDL_GetAtomicInt(&queue->tasks_inflight);
+    return true;
 }
 
 void SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
@@ -280,10 +455,13 @@ void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
     if (queue) {
         // block until any pending tasks complete.
         while (SDL_GetAtomicInt(&queue->tasks_inflight) > 0) {
-            SDL_AsyncIOTask *task = queue->iface.wait_results(queue->userdata, -1);
+            SDL_AsyncIOTask *task = GetReadyTask(queue);
+            if (!task) {
+                task = queue->iface.wait_results(queue->userdata, -1);
+            }
             if (task) {
-                if (task->asyncio->oneshot) {
-                    SDL_free(task->buffer);  // throw away the buffer from SDL_LoadFileAsync that will never be consumed/freed by app.
+                if (!task->asyncio ? (task->type == SDL_ASYNCIO_TASK_READ) : task->asyncio->oneshot) {
+                    SDL_free(task->buffer);  // throw away the buffer from SDL_LoadFileAsync (or a synchronous read) that will never be consumed/freed by app.
                     task->buffer = NULL;
                 }
                 SDL_AsyncIOOutcome outcome;
@@ -335,3 +513,21 @@ bool SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata
     return retval;
 }
 
+
+bool SDL_InternalSaveFileAsync(const char *file, const void *data, Uint64 datasize, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    SDL_AsyncIO *asyncio = SDL_AsyncIOFromFile(file, "w");
+    if (!asyncio) {
+        return false;
+    }
+    asyncio->saving = true;
+
+    static Uint8 empty;  // SDL_WriteAsyncIO wants a buffer even for an empty file.
+    const bool retval = SDL_WriteAsyncIO(asyncio, datasize ? (void *) data : &empty, 0, datasize, queue, userdata);
+    if (!retval) {
+        asyncio->saving = false;
+        asyncio->oneshot = true;  // nothing to report, so swallow the close results too.
+    }
+    SDL_CloseAsyncIO(asyncio, retval, queue, userdata);  // flush if we're keeping the data, so the outcome means it's on disk.
+    return retval;
+}
@@ -26,5 +26,13 @@
 // Shutdown any still-existing Async I/O. Note that there is no Init function, as it inits on-demand!
 extern void SDL_QuitAsyncIO(void);
 
+// Write `datasize` bytes from `data` to a new file. A single SDL_ASYNCIO_TASK_WRITE outcome is delivered to `queue`
+//  after the file is flushed and closed, with `asyncio` set to NULL. `data` must stay valid until then.
+extern bool SDL_InternalSaveFileAsync(const char *file, const void *data, Uint64 datasize, SDL_AsyncIOQueue *queue, void *userdata);
+
+// Deliver the outcome of work that was done synchronously to `queue`, as if it had been an async task.
+//  As with SDL_LoadFileAsync, the buffer of a SDL_ASYNCIO_TASK_READ belongs to whoever picks up the outcome.
+extern bool SDL_InternalQueueAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOTaskType type, SDL_AsyncIOResult result, void *buffer, Uint64 requested_size, Uint64 result_size, void *userdata);
+
 #endif // SDL_asyncio_c_h_
 
@@ -46,6 +46,18 @@
 
 #include "SDL_iostream_c.h"
 
+// Read-only files can be memory mapped with the "m" mode flag.
+#if defined(SDL_PLATFORM_WINDOWS) || \
+    ((defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)) && \
+     !defined(SDL_PLATFORM_ANDROID) && !defined(SDL_PLATFORM_IOS) && !defined(SDL_PLATFORM_EMSCRIPTEN))
+#define SDL_IOSTREAM_MMAP
+#if !defined(SDL_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#endif
+
 /* This file provides a general interface for SDL to read and write
    data sources.  It can easily be extended to files, memory, etc.
 */
@@ -1196,6 +1208,124 @@ static bool SDLCALL mem_close(void *userdata)
     return true;
 }
 
+#ifdef SDL_IOSTREAM_MMAP
+// Functions to read memory mapped files, these use the memory functions above
+
+static void UnmapFile(void *base, size_t size)
+{
+#ifdef SDL_PLATFORM_WINDOWS
+    UnmapViewOfFile(base);
+#else
+    munmap(base, size);
+#endif
+}
+
+static bool SDLCALL mapped_close(void *userdata)
+{
+    IOStreamMemData *iodata = (IOStreamMemData *) userdata;
+    UnmapFile(iodata->base, (size_t)(iodata->stop - iodata->base));
+    SDL_free(userdata);
+    return true;
+}
+
+static SDL_IOStream *IOFromMappedFile(const char *file)
+{
+    void *base = NULL;
+    size_t size = 0;
+
+#ifdef SDL_PLATFORM_WINDOWS
+    LARGE_INTEGER filesize;
+    HANDLE mapping;
+    HANDLE handle = windows_file_open(file, "rb");
+    if (handle == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    if (!GetFileSizeEx(handle, &filesize) || filesize.QuadPart <= 0 || (Uint64)filesize.QuadPart > SDL_SIZE_MAX) {
+        CloseHandle(handle);
+        return NULL;
+    }
+    size = (size_t)filesize.QuadPart;
+
+    // The view keeps the file open, we don't need the handles after this.
+    mapping = CreateFileMappingW(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (!mapping) {
+        return NULL;
+    }
+    base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!base) {
+        return NULL;
+    }
+#else
+    struct stat st;
+    int flags = O_RDONLY;
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    int fd = open(file, flags);
+    if (fd < 0) {
+        return NULL;
+    }
+    // Empty files, pipes and devices can't be mapped.
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 || (Uint64)st.st_size > SDL_SIZE_MAX) {
+        close(fd);
+        return NULL;
+    }
+    size = (size_t)st.st_size;
+
+    // The mapping keeps the file open, we don't need the descriptor after this.
+    base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+#endif // SDL_PLATFORM_WINDOWS
+
+    IOStreamMemData *iodata = (IOStreamMemData *) SDL_calloc(1, sizeof (*iodata));
+    if (!iodata) {
+        UnmapFile(base, size);
+        return NULL;
+    }
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = mem_size;
+    iface.seek = mem_seek;
+    iface.read = mem_read;
+    // leave iface.write as NULL.
+    iface.close = mapped_close;
+
+    iodata->base = (Uint8 *)base;
+    iodata->here = iodata->base;
+    iodata->stop = iodata->base + size;
+
+    SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        mapped_close(iodata);
+    } else {
+        const SDL_PropertiesID props = SDL_GetIOProperties(iostr);
+        if (props) {
+            iodata->props = props;
+            SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, base);
+            SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, size);
+        }
+    }
+    return iostr;
+}
+#endif // SDL_IOSTREAM_MMAP
+
+const void *SDL_GetIOMemory(SDL_IOStream *context, size_t *size)
+{
+    if (context && context->iface.read == mem_read) {
+        const IOStreamMemData *iodata = (const IOStreamMemData *) context->userdata;
+        *size = (size_t)(iodata->stop - iodata->here);
+        return iodata->here;
+    }
+    *size = 0;
+    return NULL;
+}
+
 // Functions to create SDL_IOStream structures from various data sources
 
 #if defined(HAVE_STDIO_H) && !defined(SDL_PLATFORM_WINDOWS) && !defined(SDL_PLATFORM_AMIGAOS4)
@@ -1225,6 +1355,29 @@ SDL_IOStream *SDL_IOFromFile(const char *file, const char *mode)
         return NULL;
     }
 
+    if (SDL_strchr(mode, 'm')) {
+        // The C runtime doesn't know about "m", strip it before going on.
+        char plain_mode[8];
+        size_t i = 0;
+        for (; *mode && i < sizeof(plain_mode) - 1; ++mode) {
+            if (*mode != 'm') {
+                plain_mode[i++] = *mode;
+            }
+        }
+        plain_mode[i] = '\0';
+
+#ifdef SDL_IOSTREAM_MMAP
+        if (!SDL_strpbrk(plain_mode, "wa+")) {
+            iostr = IOFromMappedFile(file);
+            if (iostr) {
+                return iostr;
+            }
+        }
+#endif
+        // Fall back to regular file access, which also reports any errors.
+        return SDL_IOFromFile(file, plain_mode);
+    }
+
 #ifdef SDL_PLATFORM_ANDROID
 #ifdef HAVE_STDIO_H
     // Try to open the file on the filesystem first
@@ -1547,6 +1700,269 @@ SDL_IOStream *SDL_IOFromDynamicMem(void)
     return iostr;
 }
 
+// Functions to buffer another stream
+
+#define DEFAULT_BUFFERED_IO_SIZE 4096
+
+typedef struct IOStreamBufferedData
+{
+    SDL_IOStream *src;
+    bool closeio;
+    Uint8 *buffer;
+    size_t size;
+    Sint64 offset;  // position in src of buffer[0]
+    size_t pos;     // read position in the buffer
+    size_t len;     // bytes of read data in the buffer
+    size_t dirty;   // bytes of write data in the buffer, never at the same time as read data
+} IOStreamBufferedData;
+
+static bool buffered_flush_writes(IOStreamBufferedData *iodata, SDL_IOStatus *status)
+{
+    if (iodata->dirty > 0) {
+        const size_t written = SDL_WriteIO(iodata->src, iodata->buffer, iodata->dirty);
+        iodata->offset += written;
+        if (written < iodata->dirty) {
+            SDL_memmove(iodata->buffer, iodata->buffer + written, iodata->dirty - written);
+            iodata->dirty -= written;
+            *status = SDL_GetIOStatus(iodata->src);
+            return false;
+        }
+        iodata->dirty = 0;
+    }
+    return true;
+}
+
+// Put src where the caller thinks we are and forget any read data, before going around the buffer.
+static bool buffered_drop_reads(IOStreamBufferedData *iodata)
+{
+    if (iodata->pos < iodata->len) {
+        const Sint64 position = iodata->offset + iodata->pos;
+        if (SDL_SeekIO(iodata->src, position, SDL_IO_SEEK_SET) != position) {
+            return false;
+        }
+    }
+    iodata->offset += iodata->pos;
+    iodata->pos = iodata->len = 0;
+    return true;
+}
+
+static Sint64 SDLCALL buffered_size(void *userdata)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+    SDL_IOStatus status;
+    if (!buffered_flush_writes(iodata, &status)) {
+        return -1;
+    }
+    return SDL_GetIOSize(iodata->src);
+}
+
+static Sint64 SDLCALL buffered_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+    const Sint64 here = iodata->offset + (Sint64)(iodata->dirty ? iodata->dirty : iodata->pos);
+    SDL_IOStatus status;
+    Sint64 target;
+
+    switch (whence) {
+    case SDL_IO_SEEK_SET:
+        target = offset;
+        break;
+    case SDL_IO_SEEK_CUR:
+        target = here + offset;
+        break;
+    case SDL_IO_SEEK_END:
+        target = -1;
+        break;
+    default:
+        SDL_SetError("Unknown value for 'whence'");
+        return -1;
+    }
+
+    // Stay inside the buffer if we can, this is what makes SDL_TellIO() and short skips cheap.
+    if (iodata->dirty && (target == here)) {
+        return here;
+    }
+    if (!iodata->dirty && (target >= iodata->offset) && (target <= iodata->offset + (Sint64)iodata->len)) {
+        iodata->pos = (size_t)(target - iodata->offset);
+        return target;
+    }
+
+    if (!buffered_flush_writes(iodata, &status)) {
+        return -1;
+    }
+    iodata->pos = iodata->len = 0;
+
+    const Sint64 result = (whence == SDL_IO_SEEK_END) ? SDL_SeekIO(iodata->src, offset, SDL_IO_SEEK_END) : SDL_SeekIO(iodata->src, target, SDL_IO_SEEK_SET);
+    if (result >= 0) {
+        iodata->offset = result;
+    } else {
+        // We don't know where src is anymore, find out so the next seek starts from the right place.
+        iodata->offset = SDL_TellIO(iodata->src);
+        if (iodata->offset < 0) {
+            iodata->offset = 0;
+        }
+    }
+    return result;
+}
+
+static size_t SDLCALL buffered_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total = 0;
+
+    if (!buffered_flush_writes(iodata, status)) {
+        return 0;
+    }
+
+    while (size > 0) {
+        size_t avail = iodata->len - iodata->pos;
+        if (avail == 0) {
+            size_t amount;
+
+            iodata->offset += iodata->len;
+            iodata->pos = iodata->len = 0;
+
+            if (size >= iodata->size) {
+                // Big reads skip the buffer
+                amount = SDL_ReadIO(iodata->src, dst, size);
+                iodata->offset += amount;
+                total += amount;
+                if (amount < size) {
+                    *status = SDL_GetIOStatus(iodata->src);
+                }
+                break;
+            }
+
+            amount = SDL_ReadIO(iodata->src, iodata->buffer, iodata->size);
+            iodata->len = amount;
+            if (amount == 0) {
+                *status = SDL_GetIOStatus(iodata->src);
+                break;
+            }
+            avail = amount;
+        }
+
+        const size_t amount = SDL_min(avail, size);
+        SDL_memcpy(dst, iodata->buffer + iodata->pos, amount);
+        iodata->pos += amount;
+        dst += amount;
+        size -= amount;
+        total += amount;
+    }
+    return total;
+}
+
+static size_t SDLCALL buffered_write(void *userdata, const void *ptr, size_t size, SDL_IOStatus *status)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+
+    if (iodata->len > 0 && !buffered_drop_reads(iodata)) {
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    }
+
+    if (iodata->dirty + size > iodata->size) {
+        if (!buffered_flush_writes(iodata, status)) {
+            return 0;
+        }
+    }
+
+    if (size >= iodata->size) {
+        // Big writes skip the buffer
+        const size_t written = SDL_WriteIO(iodata->src, ptr, size);
+        iodata->offset += written;
+        if (written < size) {
+            *status = SDL_GetIOStatus(iodata->src);
+        }
+        return written;
+    }
+
+    SDL_memcpy(iodata->buffer + iodata->dirty, ptr, size);
+    iodata->dirty += size;
+    return size;
+}
+
+static bool SDLCALL buffered_flush(void *userdata, SDL_IOStatus *status)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+    if (!buffered_flush_writes(iodata, status)) {
+        return false;
+    }
+    if (!SDL_FlushIO(iodata->src)) {
+        *status = SDL_GetIOStatus(iodata->src);
+        return false;
+    }
+    return true;
+}
+
+static bool SDLCALL buffered_close(void *userdata)
+{
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) userdata;
+    SDL_IOStatus status;
+    bool result = buffered_flush_writes(iodata, &status);
+    if (iodata->closeio) {
+        result = SDL_CloseIO(iodata->src) && result;
+    } else {
+        result = buffered_drop_reads(iodata) && result;
+    }
+    SDL_free(iodata->buffer);
+    SDL_free(iodata);
+    return result;
+}
+
+SDL_IOStream *SDL_CreateBufferedIO(SDL_IOStream *src, size_t buffer_size, bool closeio)
+{
+    CHECK_PARAM(!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+
+    if (buffer_size == 0) {
+        buffer_size = DEFAULT_BUFFERED_IO_SIZE;
+    }
+
+    IOStreamBufferedData *iodata = (IOStreamBufferedData *) SDL_calloc(1, sizeof (*iodata));
+    if (iodata) {
+        iodata->buffer = (Uint8 *) SDL_malloc(buffer_size);
+    }
+    if (!iodata || !iodata->buffer) {
+        SDL_free(iodata);
+        if (closeio) {
+            SDL_CloseIO(src);
+        }
+        return NULL;
+    }
+    iodata->src = src;
+    iodata->closeio = closeio;
+    iodata->size = buffer_size;
+    iodata->offset = SDL_TellIO(src);
+    if (iodata->offset < 0) {
+        iodata->offset = 0;  // not seekable, we'll only ever read or write forward.
+    }
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = buffered_size;
+    iface.seek = buffered_seek;
+    iface.read = buffered_read;
+    iface.write = buffered_write;
+    iface.flush = buffered_flush;
+    iface.close = buffered_close;
+
+    SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        iface.close(iodata);
+    } else {
+        const SDL_PropertiesID props = SDL_GetIOProperties(iostr);
+        if (props) {
+            SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_BUFFERED_SOURCE_POINTER, src);
+            SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_BUFFERED_SIZE_NUMBER, (Sint64)buffer_size);
+        }
+    }
+    return iostr;
+}
+
 SDL_IOStatus SDL_GetIOStatus(SDL_IOStream *context)
 {
     CHECK_PARAM(!context) {
@@ -1620,7 +2036,8 @@ void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
     for (;;) {
         if (loading_chunks) {
             if ((size_total + FILE_CHUNK_SIZE) > size) {
-                size = (size_total + FILE_CHUNK_SIZE);
+                // Grow geometrically so large streams don't realloc over and over.
+                size = size_total + SDL_max(FILE_CHUNK_SIZE, size_total);
                 if (size >= SDL_SIZE_MAX - 1) {
                     newdata = NULL;
                 } else {
@@ -35,4 +35,10 @@ extern SDL_IOStream *SDL_IOFromFP(FILE *fp, bool autoclose);
 extern SDL_IOStream *SDL_IOFromFD(int fd, bool autoclose);
 #endif
 
+/* Returns the data from the current position to the end of a memory backed
+ * stream (including memory mapped files), so it can be parsed in place, or
+ * NULL if the stream isn't backed by memory.
+ */
+extern const void *SDL_GetIOMemory(SDL_IOStream *context, size_t *size);
+
 #endif // SDL_iostream_c_h_
@@ -80,6 +80,8 @@ struct SDL_AsyncIOTask
     SDL_AsyncIOResult result;
     Uint64 requested_size;
     Uint64 result_size;
+    Uint64 start_ns;     // when the task was started, for the queue statistics.
+    Uint64 complete_ns;  // when the task finished, if the backend knows. Otherwise it's when the result was picked up.
     void *app_userdata;
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -94,6 +96,10 @@ typedef struct SDL_AsyncIOQueueInterface
     SDL_AsyncIOTask * (*wait_results)(void *userdata, Sint32 timeoutMS);
     void (*signal)(void *userdata);
     void (*destroy)(void *userdata);
+    // These are optional, leave them NULL if the backend doesn't support them.
+    bool (*begin_batch)(void *userdata);
+    bool (*submit_batch)(void *userdata);
+    bool (*register_buffers)(void *userdata, void * const *buffers, const size_t *sizes, int num_buffers);
 } SDL_AsyncIOQueueInterface;
 
 struct SDL_AsyncIOQueue
@@ -101,6 +107,11 @@ struct SDL_AsyncIOQueue
     SDL_AsyncIOQueueInterface iface;
     void *userdata;
     SDL_AtomicInt tasks_inflight;
+    SDL_SpinLock stats_lock;
+    SDL_AsyncIOQueueStats stats;  // tasks_pending isn't kept up to date in here, it's tasks_inflight.
+    SDL_SpinLock ready_lock;
+    SDL_AsyncIOTask *ready_head;  // tasks that were finished before they were queued (see SDL_InternalQueueAsyncIOResult). Chained through `queuenext`.
+    SDL_AsyncIOTask *ready_tail;
 };
 
 // this interface is kept per-object, even though generally it's going to decide
@@ -124,20 +135,22 @@ struct SDL_AsyncIO
     SDL_AsyncIOTask tasks;
     SDL_AsyncIOTask *closing;  // The close task, which isn't queued until all pending work for this file is done.
     bool oneshot;  // true if this is a SDL_LoadFileAsync open.
+    bool saving;   // true if this is a SDL_InternalSaveFileAsync open.
+    SDL_AsyncIOOutcome save_outcome;  // the write's outcome, held back until the file is closed, if `saving`.
 };
 
 // This is implemented for various platforms; param validation is done before calling this. Open file, fill in iface and userdata.
 extern bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio);
 
-// This is implemented for various platforms. Call SDL_OpenAsyncIOQueue from in here.
-extern bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue);
+// This is implemented for various platforms. Call SDL_OpenAsyncIOQueue from in here. `props` are the creation properties, and may be 0.
+extern bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue, SDL_PropertiesID props);
 
 // This is called during SDL_QuitAsyncIO, after all tasks have completed and all files are closed, to let the platform clean up global backend details.
 extern void SDL_SYS_QuitAsyncIO(void);
 
 // the "generic" version is always available, since it is almost always needed as a fallback even on platforms that might offer something better.
 extern bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_AsyncIO *asyncio);
-extern bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue);
+extern bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue, SDL_PropertiesID props);
 extern void SDL_SYS_QuitAsyncIO_Generic(void);
 
 #endif
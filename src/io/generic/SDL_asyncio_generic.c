@@ -37,23 +37,44 @@
 #define SDL_ASYNCIO_USE_THREADPOOL 1
 #endif
 
+// a worker that picks up a read or write will also take up to this many more
+// queued tasks for the same file that continue where the previous one ended,
+// and run them all while holding the file lock once.
+#define MAX_MERGED_TASKS 32
+
+// how far down the queue a worker looks for tasks to merge.
+#define MAX_MERGE_SCAN 128
+
+// idle workers quit after this long, unless they are the last one.
+#define WORKER_IDLE_TIMEOUT_MS 5000
+
+// the last worker waits this long before it checks again.
+#define LAST_WORKER_IDLE_TIMEOUT_MS 30000
+
+#define NUM_PRIORITIES (SDL_ASYNCIO_PRIORITY_HIGH + 1)
+
 typedef struct GenericAsyncIOQueueData
 {
     SDL_Mutex *lock;
     SDL_Condition *condition;
     SDL_AsyncIOTask completed_tasks;
+    SDL_AsyncIOQueuePriority priority;
 } GenericAsyncIOQueueData;
 
 typedef struct GenericAsyncIOData
 {
     SDL_Mutex *lock;  // !!! FIXME: we can skip this lock if we have an equivalent of pread/pwrite
     SDL_IOStream *io;
+    bool track_position;  // false for append mode, where writes don't go where we seek.
+    Sint64 position;      // where the stream is now, if known, or -1. Protected by `lock`.
+    bool writing;         // whether the last transfer was a write. Protected by `lock`.
 } GenericAsyncIOData;
 
 static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
 {
     SDL_assert(task->queue);
     GenericAsyncIOQueueData *data = (GenericAsyncIOQueueData *) task->queue->userdata;
+    task->complete_ns = SDL_GetTicksNS();
     SDL_LockMutex(data->lock);
     LINKED_LIST_PREPEND(task, data->completed_tasks, queue);
     SDL_SignalCondition(data->condition);  // wake a thread waiting on the queue.
@@ -62,75 +83,172 @@ static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
 
 // synchronous i/o is offloaded onto the threadpool. This function does the threaded work.
 // This is called directly, without a threadpool, if !SDL_ASYNCIO_USE_THREADPOOL.
-static void SynchronousIO(SDL_AsyncIOTask *task)
+// All the tasks are for the same file; more than one task means they were merged
+// because each one starts where the previous one ends, so we only seek once.
+static void SynchronousIO(SDL_AsyncIOTask **tasks, int num_tasks)
 {
-    SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
-
-    GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
+    GenericAsyncIOData *data = (GenericAsyncIOData *) tasks[0]->asyncio->userdata;
     SDL_IOStream *io = data->io;
-    const size_t size = (size_t) task->requested_size;
-    void *ptr = task->buffer;
+    int i;
 
     // this seek won't work if two tasks are reading from the same file at the same time,
     // so we lock here. This makes multiple reads from a single file serialize, but different
     // files will still run in parallel. An app can also open the same file twice to avoid this.
     SDL_LockMutex(data->lock);
-    if (task->type == SDL_ASYNCIO_TASK_CLOSE) {
-        bool okay = true;
-        if (task->flush) {
-            okay = SDL_FlushIO(data->io);
+    for (i = 0; i < num_tasks; i++) {
+        SDL_AsyncIOTask *task = tasks[i];
+        const size_t size = (size_t) task->requested_size;
+        void *ptr = task->buffer;
+
+        SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
+        SDL_assert(task->asyncio == tasks[0]->asyncio);
+
+        if (task->type == SDL_ASYNCIO_TASK_CLOSE) {
+            bool okay = true;
+            if (task->flush) {
+                okay = SDL_FlushIO(data->io);
+            }
+            okay = SDL_CloseIO(data->io) && okay;
+            task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+            continue;
         }
-        okay = SDL_CloseIO(data->io) && okay;
-        task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
-    } else if (SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0) {
-        task->result = SDL_ASYNCIO_FAILURE;
-    } else {
+
         const bool writing = (task->type == SDL_ASYNCIO_TASK_WRITE);
-        task->result_size = (Uint64) (writing ? SDL_WriteIO(io, ptr, size) : SDL_ReadIO(io, ptr, size));
-        if (task->result_size == task->requested_size) {
-            task->result = SDL_ASYNCIO_COMPLETE;
+        if (writing != data->writing) {
+            // stdio streams need a seek between a write and a following read, and the other way around.
+            data->position = -1;
+            data->writing = writing;
+        }
+
+        if ((data->position != (Sint64) task->offset) && (SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0)) {
+            data->position = -1;
+            task->result = SDL_ASYNCIO_FAILURE;
         } else {
-            if (writing) {
-                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+            task->result_size = (Uint64) (writing ? SDL_WriteIO(io, ptr, size) : SDL_ReadIO(io, ptr, size));
+            if (task->result_size == task->requested_size) {
+                task->result = SDL_ASYNCIO_COMPLETE;
+                data->position = data->track_position ? (Sint64) (task->offset + task->result_size) : -1;
             } else {
-                const SDL_IOStatus status = SDL_GetIOStatus(io);
-                SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
-                SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
-                task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+                data->position = -1;  // don't trust where a short read or write left us.
+                if (writing) {
+                    task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+                } else {
+                    const SDL_IOStatus status = SDL_GetIOStatus(io);
+                    SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
+                    SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
+                    task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+                }
             }
         }
     }
     SDL_UnlockMutex(data->lock);
 
-    AsyncIOTaskComplete(task);
+    for (i = 0; i < num_tasks; i++) {
+        AsyncIOTaskComplete(tasks[i]);
+    }
 }
 
 #if SDL_ASYNCIO_USE_THREADPOOL
 static SDL_InitState threadpool_init;
 static SDL_Mutex *threadpool_lock = NULL;
 static bool stop_threadpool = false;
-static SDL_AsyncIOTask threadpool_tasks;
+static SDL_AsyncIOTask threadpool_tasks[NUM_PRIORITIES];  // one FIFO per queue priority.
+static SDL_AsyncIOTask *threadpool_tails[NUM_PRIORITIES];
+static int threadpool_pending = 0;
 static SDL_Condition *threadpool_condition = NULL;
 static int max_threadpool_threads = 0;
 static int running_threadpool_threads = 0;
 static int idle_threadpool_threads = 0;
 static int threadpool_threads_spun = 0;
 
+static SDL_AsyncIOQueuePriority GetTaskPriority(SDL_AsyncIOTask *task)
+{
+    const GenericAsyncIOQueueData *data = (const GenericAsyncIOQueueData *) task->queue->userdata;
+    return data->priority;
+}
+
+// these must be called with threadpool_lock held.
+static void ThreadpoolAppendTask(SDL_AsyncIOTask *task)
+{
+    const SDL_AsyncIOQueuePriority priority = GetTaskPriority(task);
+    SDL_AsyncIOTask *tail = threadpool_tails[priority];
+    if (tail) {
+        task->threadpoolprev = tail;
+        task->threadpoolnext = NULL;
+        tail->threadpoolnext = task;
+    } else {
+        LINKED_LIST_PREPEND(task, threadpool_tasks[priority], threadpool);
+    }
+    threadpool_tails[priority] = task;
+    threadpool_pending++;
+}
+
+static void ThreadpoolUnlinkTask(SDL_AsyncIOTask *task)
+{
+    const SDL_AsyncIOQueuePriority priority = GetTaskPriority(task);
+    if (threadpool_tails[priority] == task) {
+        SDL_AsyncIOTask *prev = LINKED_LIST_PREV(task, threadpool);
+        threadpool_tails[priority] = (prev == &threadpool_tasks[priority]) ? NULL : prev;
+    }
+    LINKED_LIST_UNLINK(task, threadpool);
+    threadpool_pending--;
+}
+
+static SDL_AsyncIOTask *ThreadpoolNextTask(void)
+{
+    int i;
+    for (i = NUM_PRIORITIES - 1; i >= 0; i--) {
+        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks[i], threadpool);
+        if (task) {
+            return task;
+        }
+    }
+    return NULL;
+}
+
+// pull queued tasks that continue right where the first one ends out of its list.
+static int ThreadpoolMergeTasks(SDL_AsyncIOTask **tasks)
+{
+    const SDL_AsyncIOTask *first = tasks[0];
+    Uint64 next_offset = first->offset + first->requested_size;
+    SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks[GetTaskPriority(tasks[0])], threadpool);
+    int num_tasks = 1;
+    int scanned = 0;
+
+    if (first->type == SDL_ASYNCIO_TASK_CLOSE) {
+        return num_tasks;
+    }
+
+    while (task && (num_tasks < MAX_MERGED_TASKS) && (scanned++ < MAX_MERGE_SCAN)) {
+        SDL_AsyncIOTask *next = LINKED_LIST_NEXT(task, threadpool);
+        if ((task->asyncio == first->asyncio) && (task->type == first->type) && (task->offset == next_offset)) {
+            ThreadpoolUnlinkTask(task);
+            tasks[num_tasks++] = task;
+            next_offset += task->requested_size;
+        }
+        task = next;
+    }
+    return num_tasks;
+}
+
 static int SDLCALL AsyncIOThreadpoolWorker(void *data)
 {
+    SDL_AsyncIOTask *tasks[MAX_MERGED_TASKS];
+
     SDL_LockMutex(threadpool_lock);
 
     while (!stop_threadpool) {
-        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
+        SDL_AsyncIOTask *task = ThreadpoolNextTask();
         if (!task) {
-            // if we go 30 seconds without a new task, terminate unless we're the only thread left.
+            // if we go a while without a new task, terminate unless we're the only thread left.
+            const bool last_thread = (running_threadpool_threads == 1);
             idle_threadpool_threads++;
-            const bool rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, 30000);
+            const bool rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, last_thread ? LAST_WORKER_IDLE_TIMEOUT_MS : WORKER_IDLE_TIMEOUT_MS);
             idle_threadpool_threads--;
 
             if (!rc) {
-                // decide if we have too many idle threads, and if so, quit to let thread pool shrink when not busy.
-                if (idle_threadpool_threads) {
+                // quit to let the thread pool shrink when not busy. A new thread will spin up if the load comes back.
+                if (running_threadpool_threads > 1) {
                     break;
                 }
             }
@@ -138,12 +256,14 @@ static int SDLCALL AsyncIOThreadpoolWorker(void *data)
             continue;
         }
 
-        LINKED_LIST_UNLINK(task, threadpool);
+        ThreadpoolUnlinkTask(task);
+        tasks[0] = task;
+        const int num_tasks = ThreadpoolMergeTasks(tasks);
 
         SDL_UnlockMutex(threadpool_lock);
 
         // bookkeeping is done, so we drop the mutex and fire the work.
-        SynchronousIO(task);
+        SynchronousIO(tasks, num_tasks);
 
         SDL_LockMutex(threadpool_lock);  // take the lock again and see if there's another task (if not, we'll wait on the Condition).
     }
@@ -162,8 +282,8 @@ static int SDLCALL AsyncIOThreadpoolWorker(void *data)
 
 static bool MaybeSpinNewWorkerThread(void)
 {
-    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
-    if ((idle_threadpool_threads == 0) && (running_threadpool_threads < max_threadpool_threads)) {
+    // if there's more work waiting than idle threads to pick it up and the pool of threads isn't maxed out, make a new one.
+    if (((idle_threadpool_threads == 0) || (threadpool_pending > idle_threadpool_threads)) && (running_threadpool_threads < max_threadpool_threads)) {
         char threadname[32];
         SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
         SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, NULL);
@@ -187,7 +307,7 @@ static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
     } else {
-        LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
+        ThreadpoolAppendTask(task);
         MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
 
         // tell idle threads to get to work.
@@ -240,8 +360,8 @@ static void ShutdownThreadpool(void)
 
         // cancel anything that's still pending.
         SDL_AsyncIOTask *task;
-        while ((task = LINKED_LIST_START(threadpool_tasks, threadpool)) != NULL) {
-            LINKED_LIST_UNLINK(task, threadpool);
+        while ((task = ThreadpoolNextTask()) != NULL) {
+            ThreadpoolUnlinkTask(task);
             task->result = SDL_ASYNCIO_CANCELED;
             AsyncIOTaskComplete(task);
         }
@@ -262,7 +382,7 @@ static void ShutdownThreadpool(void)
         SDL_DestroyCondition(threadpool_condition);
         threadpool_condition = NULL;
 
-        max_threadpool_threads = running_threadpool_threads = idle_threadpool_threads = threadpool_threads_spun = 0;
+        max_threadpool_threads = running_threadpool_threads = idle_threadpool_threads = threadpool_threads_spun = threadpool_pending = 0;
 
         stop_threadpool = false;
         SDL_SetInitialized(&threadpool_init, false);
@@ -295,7 +415,7 @@ static bool generic_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *tas
     #if SDL_ASYNCIO_USE_THREADPOOL
     QueueAsyncIOTask(task);
     #else
-    SynchronousIO(task);  // oh well. Get a better platform.
+    SynchronousIO(&task, 1);  // oh well. Get a better platform.
     #endif
     return true;
 }
@@ -309,7 +429,7 @@ static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *ta
     // we can't stop i/o that's in-flight, but we _can_ just refuse to start it if the threadpool hadn't picked it up yet.
     SDL_LockMutex(threadpool_lock);
     if (LINKED_LIST_PREV(task, threadpool) != NULL) {  // still in the queue waiting to be run? Take it out.
-        LINKED_LIST_UNLINK(task, threadpool);
+        ThreadpoolUnlinkTask(task);
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
     }
@@ -361,7 +481,7 @@ static void generic_asyncioqueue_destroy(void *userdata)
     SDL_free(data);
 }
 
-bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
+bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
     #if SDL_ASYNCIO_USE_THREADPOOL
     if (!PrepareThreadpool()) {
@@ -387,6 +507,9 @@ bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
         return false;
     }
 
+    const Sint64 priority = SDL_GetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_PRIORITY_NUMBER, SDL_ASYNCIO_PRIORITY_NORMAL);
+    data->priority = (SDL_AsyncIOQueuePriority) SDL_clamp(priority, SDL_ASYNCIO_PRIORITY_LOW, SDL_ASYNCIO_PRIORITY_HIGH);
+
     static const SDL_AsyncIOQueueInterface SDL_AsyncIOQueue_Generic = {
         generic_asyncioqueue_queue_task,
         generic_asyncioqueue_cancel_task,
@@ -427,6 +550,8 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
         SDL_free(data);
         return false;
     }
+    data->track_position = (SDL_strchr(mode, 'a') == NULL);
+    data->position = data->track_position ? SDL_TellIO(data->io) : -1;
 
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_Generic = {
         generic_asyncio_size,
@@ -455,9 +580,9 @@ bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *as
     return SDL_SYS_AsyncIOFromFile_Generic(file, mode, asyncio);
 }
 
-bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue)
+bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
-    return SDL_SYS_CreateAsyncIOQueue_Generic(queue);
+    return SDL_SYS_CreateAsyncIOQueue_Generic(queue, props);
 }
 
 void SDL_SYS_QuitAsyncIO(void)
@@ -37,7 +37,7 @@
 static SDL_InitState liburing_init;
 
 // We could add a whole bootstrap thing like the audio/video/etc subsystems use, but let's keep this simple for now.
-static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue);
+static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue, SDL_PropertiesID props);
 static void (*QuitAsyncIO)(void);
 static bool (*AsyncIOFromFile)(const char *file, const char *mode, SDL_AsyncIO *asyncio);
 
@@ -57,12 +57,15 @@ SDL_ELF_NOTE_DLOPEN(
 
 #define SDL_LIBURING_FUNCS \
     SDL_LIBURING_FUNC(int, io_uring_queue_init, (unsigned entries, struct io_uring *ring, unsigned flags)) \
+    SDL_LIBURING_FUNC(int, io_uring_queue_init_params, (unsigned entries, struct io_uring *ring, struct io_uring_params *p)) \
     SDL_LIBURING_FUNC(struct io_uring_probe *,io_uring_get_probe,(void)) \
     SDL_LIBURING_FUNC(void, io_uring_free_probe, (struct io_uring_probe *probe)) \
     SDL_LIBURING_FUNC(int, io_uring_opcode_supported, (const struct io_uring_probe *p, int op)) \
     SDL_LIBURING_FUNC(struct io_uring_sqe *, io_uring_get_sqe, (struct io_uring *ring)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_read,(struct io_uring_sqe *sqe, int fd, void *buf, unsigned nbytes, __u64 offset)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_write,(struct io_uring_sqe *sqe, int fd, const void *buf, unsigned nbytes, __u64 offset)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_read_fixed,(struct io_uring_sqe *sqe, int fd, void *buf, unsigned nbytes, __u64 offset, int buf_index)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_write_fixed,(struct io_uring_sqe *sqe, int fd, const void *buf, unsigned nbytes, __u64 offset, int buf_index)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_close, (struct io_uring_sqe *sqe, int fd)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_fsync, (struct io_uring_sqe *sqe, int fd, unsigned fsync_flags)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_cancel, (struct io_uring_sqe *sqe, void *user_data, int flags)) \
@@ -76,6 +79,8 @@ SDL_ELF_NOTE_DLOPEN(
     SDL_LIBURING_FUNC(int, io_uring_wait_cqe_timeout, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr, struct __kernel_timespec *ts)) \
     SDL_LIBURING_FUNC(void, io_uring_cqe_seen, (struct io_uring *ring, struct io_uring_cqe *cqe)) \
     SDL_LIBURING_FUNC(void, io_uring_queue_exit, (struct io_uring *ring)) \
+    SDL_LIBURING_FUNC(int, io_uring_register_buffers, (struct io_uring *ring, const struct iovec *iovecs, unsigned nr_iovecs)) \
+    SDL_LIBURING_FUNC(int, io_uring_unregister_buffers, (struct io_uring *ring)) \
 
 
 #define SDL_LIBURING_FUNC(ret, fn, args) typedef ret (*SDL_fntype_##fn) args;
@@ -90,6 +95,7 @@ typedef struct SDL_LibUringFunctions
 } SDL_LibUringFunctions;
 
 static SDL_LibUringFunctions liburing;
+static bool liburing_have_fixed_ops = false;  // registered buffers need IORING_OP_READ_FIXED and IORING_OP_WRITE_FIXED.
 
 
 typedef struct LibUringAsyncIOQueueData
@@ -98,6 +104,9 @@ typedef struct LibUringAsyncIOQueueData
     SDL_Mutex *cqe_lock;
     struct io_uring ring;
     SDL_AtomicInt num_waiting;
+    int batch_depth;  // protected by sqe_lock. Nothing is submitted while this is > 0.
+    struct iovec *buffers;  // protected by sqe_lock. Registered with io_uring, used by fixed reads/writes.
+    int num_buffers;
 } LibUringAsyncIOQueueData;
 
 
@@ -158,6 +167,8 @@ static bool LoadLibUring(void)
                             break;
                         }
                     }
+                    liburing_have_fixed_ops = io_uring_opcode_supported(probe, IORING_OP_READ_FIXED) &&
+                                              io_uring_opcode_supported(probe, IORING_OP_WRITE_FIXED);
                     liburing.io_uring_free_probe(probe);
                 }
             }
@@ -191,10 +202,40 @@ static Sint64 liburing_asyncio_size(void *userdata)
 static bool liburing_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    if (queuedata->batch_depth > 0) {
+        return true;  // this will go out with everything else in SDL_SubmitAsyncIOBatch.
+    }
     const int rc = liburing.io_uring_submit(&queuedata->ring);
     return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;
 }
 
+// you must hold sqe_lock when calling this!
+static struct io_uring_sqe *GetSQE(LibUringAsyncIOQueueData *queuedata)
+{
+    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    if (!sqe && (queuedata->batch_depth > 0)) {
+        // a batch filled the submission queue; send off what we have so far to make room.
+        if (liburing.io_uring_submit(&queuedata->ring) >= 0) {
+            sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+        }
+    }
+    return sqe;
+}
+
+// you must hold sqe_lock when calling this! Returns the index of the registered buffer that holds all of this memory, or -1.
+static int FindRegisteredBuffer(LibUringAsyncIOQueueData *queuedata, const void *ptr, Uint64 size)
+{
+    const Uint8 *start = (const Uint8 *) ptr;
+    for (int i = 0; i < queuedata->num_buffers; i++) {
+        const Uint8 *base = (const Uint8 *) queuedata->buffers[i].iov_base;
+        const size_t len = queuedata->buffers[i].iov_len;
+        if ((start >= base) && (start <= base + len) && (size <= (Uint64) (size_t) ((base + len) - start))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     SDL_AsyncIOTask *cancel_task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*cancel_task));
@@ -206,7 +247,7 @@ static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *t
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         SDL_UnlockMutex(queuedata->sqe_lock);
         SDL_free(cancel_task);  // oh well, the task can just finish on its own.
@@ -326,13 +367,86 @@ static void liburing_asyncioqueue_signal(void *userdata)
 static void liburing_asyncioqueue_destroy(void *userdata)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
-    liburing.io_uring_queue_exit(&queuedata->ring);
+    liburing.io_uring_queue_exit(&queuedata->ring);  // this unregisters the buffers, too.
     SDL_DestroyMutex(queuedata->sqe_lock);
     SDL_DestroyMutex(queuedata->cqe_lock);
+    SDL_free(queuedata->buffers);
     SDL_free(queuedata);
 }
 
-static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
+static bool liburing_asyncioqueue_begin_batch(void *userdata)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    SDL_LockMutex(queuedata->sqe_lock);
+    queuedata->batch_depth++;
+    SDL_UnlockMutex(queuedata->sqe_lock);
+    return true;
+}
+
+static bool liburing_asyncioqueue_submit_batch(void *userdata)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    bool retval = true;
+
+    SDL_LockMutex(queuedata->sqe_lock);
+    if (queuedata->batch_depth == 0) {
+        retval = SDL_SetError("No batch in progress");
+    } else if (--queuedata->batch_depth == 0) {
+        // everything since the outermost SDL_BeginAsyncIOBatch goes out in one io_uring_enter.
+        const int rc = liburing.io_uring_submit(&queuedata->ring);
+        if (rc < 0) {
+            retval = liburing_SetError("io_uring_submit", rc);
+        }
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+    return retval;
+}
+
+static bool liburing_asyncioqueue_register_buffers(void *userdata, void * const *buffers, const size_t *sizes, int num_buffers)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+
+    if (!liburing_have_fixed_ops) {
+        return true;  // reads and writes will just use the memory as-is.
+    }
+
+    struct iovec *iovecs = NULL;
+    if (num_buffers > 0) {
+        iovecs = (struct iovec *) SDL_calloc(num_buffers, sizeof (*iovecs));
+        if (!iovecs) {
+            return false;
+        }
+        for (int i = 0; i < num_buffers; i++) {
+            iovecs[i].iov_base = buffers[i];
+            iovecs[i].iov_len = sizes[i];
+        }
+    }
+
+    SDL_LockMutex(queuedata->sqe_lock);
+    if (queuedata->num_buffers > 0) {
+        liburing.io_uring_unregister_buffers(&queuedata->ring);
+        SDL_free(queuedata->buffers);
+        queuedata->buffers = NULL;
+        queuedata->num_buffers = 0;
+    }
+
+    bool retval = true;
+    if (num_buffers > 0) {
+        const int rc = liburing.io_uring_register_buffers(&queuedata->ring, iovecs, (unsigned) num_buffers);
+        if (rc < 0) {
+            retval = liburing_SetError("io_uring_register_buffers", rc);
+            SDL_free(iovecs);
+        } else {
+            queuedata->buffers = iovecs;
+            queuedata->num_buffers = num_buffers;
+        }
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+
+    return retval;
+}
+
+static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) SDL_calloc(1, sizeof (*queuedata));
     if (!queuedata) {
@@ -354,8 +468,20 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         return false;
     }
 
-    // !!! FIXME: no idea how large the queue should be. Is 128 overkill or too small?
-    const int rc = liburing.io_uring_queue_init(128, &queuedata->ring, 0);
+    // !!! FIXME: no idea how large the queue should be by default. Is 128 overkill or too small?
+    const unsigned entries = (unsigned) SDL_clamp(SDL_GetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_ENTRIES_NUMBER, 128), 1, 32768);
+    int rc = -EINVAL;
+    if (SDL_GetBooleanProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_SQPOLL_BOOLEAN, false)) {
+        struct io_uring_params params;
+        SDL_zero(params);
+        params.flags = IORING_SETUP_SQPOLL;
+        params.sq_thread_idle = 100;  // milliseconds the kernel thread keeps polling after the last submission.
+        rc = liburing.io_uring_queue_init_params(entries, &queuedata->ring, &params);
+        // this can fail without privileges on older kernels, just use a regular ring then.
+    }
+    if (rc != 0) {
+        rc = liburing.io_uring_queue_init(entries, &queuedata->ring, 0);
+    }
     if (rc != 0) {
         SDL_DestroyMutex(queuedata->sqe_lock);
         SDL_DestroyMutex(queuedata->cqe_lock);
@@ -369,7 +495,10 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         liburing_asyncioqueue_get_results,
         liburing_asyncioqueue_wait_results,
         liburing_asyncioqueue_signal,
-        liburing_asyncioqueue_destroy
+        liburing_asyncioqueue_destroy,
+        liburing_asyncioqueue_begin_batch,
+        liburing_asyncioqueue_submit_batch,
+        liburing_asyncioqueue_register_buffers
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_liburing);
@@ -392,11 +521,16 @@ static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
-        liburing.io_uring_prep_read(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        const int buf_index = FindRegisteredBuffer(queuedata, task->buffer, task->requested_size);
+        if (buf_index >= 0) {
+            liburing.io_uring_prep_read_fixed(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset, buf_index);
+        } else {
+            liburing.io_uring_prep_read(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        }
         liburing.io_uring_sqe_set_data(sqe, task);
         retval = task->queue->iface.queue_task(task->queue->userdata, task);
     }
@@ -418,11 +552,16 @@ static bool liburing_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
-        liburing.io_uring_prep_write(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        const int buf_index = FindRegisteredBuffer(queuedata, task->buffer, task->requested_size);
+        if (buf_index >= 0) {
+            liburing.io_uring_prep_write_fixed(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset, buf_index);
+        } else {
+            liburing.io_uring_prep_write(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        }
         liburing.io_uring_sqe_set_data(sqe, task);
         retval = task->queue->iface.queue_task(task->queue->userdata, task);
     }
@@ -438,13 +577,13 @@ static bool liburing_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
         if (task->flush) {
             struct io_uring_sqe *flush_sqe = sqe;
-            sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // this will be our actual close task.
+            sqe = GetSQE(queuedata);  // this will be our actual close task.
             if (!sqe) {
                 liburing.io_uring_prep_nop(flush_sqe);  // we already have the first sqe, just make it a NOP.
                 liburing.io_uring_sqe_set_data(flush_sqe, NULL);
@@ -534,10 +673,10 @@ static void MaybeInitializeLibUring(void)
     }
 }
 
-bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue)
+bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
     MaybeInitializeLibUring();
-    return CreateAsyncIOQueue(queue);
+    return CreateAsyncIOQueue(queue, props);
 }
 
 bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio)
@@ -37,7 +37,7 @@
 static SDL_InitState ioring_init;
 
 // We could add a whole bootstrap thing like the audio/video/etc subsystems use, but let's keep this simple for now.
-static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue);
+static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue, SDL_PropertiesID props);
 static void (*QuitAsyncIO)(void);
 static bool (*AsyncIOFromFile)(const char *file, const char *mode, SDL_AsyncIO *asyncio);
 
@@ -283,7 +283,7 @@ static void ioring_asyncioqueue_destroy(void *userdata)
     SDL_free(queuedata);
 }
 
-static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
+static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
     WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) SDL_calloc(1, sizeof (*queuedata));
     if (!queuedata) {
@@ -311,10 +311,11 @@ static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
         goto failed;
     }
 
-    // !!! FIXME: no idea how large the queue should be. Is 128 overkill or too small?
+    // !!! FIXME: no idea how large the queue should be by default. Is 128 overkill or too small?
+    const UINT32 entries = (UINT32) SDL_clamp(SDL_GetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_ENTRIES_NUMBER, 128), 1, 32768);
     flags.Required = IORING_CREATE_REQUIRED_FLAGS_NONE;
     flags.Advisory = IORING_CREATE_ADVISORY_FLAGS_NONE;
-    hr = ioring.CreateIoRing(SDL_REQUIRED_IORING_VERSION, flags, 128, 128, &queuedata->ring);
+    hr = ioring.CreateIoRing(SDL_REQUIRED_IORING_VERSION, flags, entries, entries, &queuedata->ring);
     if (FAILED(hr)) {
         WIN_SetErrorFromHRESULT("CreateIoRing", hr);
         goto failed;
@@ -525,10 +526,10 @@ static void MaybeInitializeWinIoRing(void)
     }
 }
 
-bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue)
+bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue, SDL_PropertiesID props)
 {
     MaybeInitializeWinIoRing();
-    return CreateAsyncIOQueue(queue);
+    return CreateAsyncIOQueue(queue, props);
 }
 
 bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio)
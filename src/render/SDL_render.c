@@ -310,6 +310,498 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+// Command queue optimization, see SDL_HINT_RENDER_OPTIMIZE_COMMANDS
+
+#define SDL_RENDER_REORDER_WINDOW 64
+
+static bool IsDrawCommand(SDL_RenderCommandType command)
+{
+    switch (command) {
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    case SDL_RENDERCMD_FILL_RECTS:
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_COPY_EX:
+    case SDL_RENDERCMD_GEOMETRY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Whether the backends would draw these with the same state, the same checks they use to batch draws themselves
+static bool CanBatchDraws(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    if (a->command != b->command ||
+        a->data.draw.texture != b->data.draw.texture ||
+        a->data.draw.blend != b->data.draw.blend ||
+        a->data.draw.texture_address_mode_u != b->data.draw.texture_address_mode_u ||
+        a->data.draw.texture_address_mode_v != b->data.draw.texture_address_mode_v ||
+        a->data.draw.color_scale != b->data.draw.color_scale ||
+        a->data.draw.color.r != b->data.draw.color.r ||
+        a->data.draw.color.g != b->data.draw.color.g ||
+        a->data.draw.color.b != b->data.draw.color.b ||
+        a->data.draw.color.a != b->data.draw.color.a ||
+        a->data.draw.gpu_render_state != b->data.draw.gpu_render_state) {
+        return false;
+    }
+    if (a->data.draw.texture && a->data.draw.texture_scale_mode != b->data.draw.texture_scale_mode) {
+        return false;
+    }
+    return true;
+}
+
+static bool DrawsOverlap(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    const SDL_FRect *r1 = &a->data.draw.bounds;
+    const SDL_FRect *r2 = &b->data.draw.bounds;
+
+    if (r1->w < 0.0f || r2->w < 0.0f) {
+        return true;
+    }
+
+    // Leave a little room for the rounding in the backends
+    return r1->x < r2->x + r2->w + 2.0f && r2->x < r1->x + r1->w + 2.0f &&
+           r1->y < r2->y + r2->h + 2.0f && r2->y < r1->y + r1->h + 2.0f;
+}
+
+// Whether the vertex data of a draw can be moved, which needs its offset to be a position in renderer->vertex_data
+static bool CanMoveDrawVertices(const SDL_RenderCommand *cmd)
+{
+    return cmd->data.draw.vertex_end > cmd->data.draw.vertex_start &&
+           cmd->data.draw.first >= cmd->data.draw.vertex_start &&
+           cmd->data.draw.first < cmd->data.draw.vertex_end;
+}
+
+static void UnionDrawBounds(SDL_FRect *bounds, const SDL_FRect *other)
+{
+    if (bounds->w < 0.0f || other->w < 0.0f) {
+        bounds->w = -1.0f;
+    } else {
+        const float minx = SDL_min(bounds->x, other->x);
+        const float miny = SDL_min(bounds->y, other->y);
+        const float maxx = SDL_max(bounds->x + bounds->w, other->x + other->w);
+        const float maxy = SDL_max(bounds->y + bounds->h, other->y + other->h);
+        bounds->x = minx;
+        bounds->y = miny;
+        bounds->w = maxx - minx;
+        bounds->h = maxy - miny;
+    }
+}
+
+static void SetDrawBoundsFromPoints(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const float *xy, int xy_stride, int num_vertices, float scale_x, float scale_y)
+{
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (!renderer->optimize_commands || num_vertices <= 0) {
+        return;
+    }
+
+    minx = maxx = xy[0];
+    miny = maxy = xy[1];
+    for (i = 1; i < num_vertices; ++i) {
+        const float *pos = (const float *)((const Uint8 *)xy + i * xy_stride);
+        minx = SDL_min(minx, pos[0]);
+        miny = SDL_min(miny, pos[1]);
+        maxx = SDL_max(maxx, pos[0]);
+        maxy = SDL_max(maxy, pos[1]);
+    }
+    minx *= scale_x;
+    maxx *= scale_x;
+    miny *= scale_y;
+    maxy *= scale_y;
+
+    // This also leaves the bounds unknown if any coordinate is NaN
+    if (minx <= maxx && miny <= maxy) {
+        cmd->data.draw.bounds.x = minx;
+        cmd->data.draw.bounds.y = miny;
+        cmd->data.draw.bounds.w = maxx - minx;
+        cmd->data.draw.bounds.h = maxy - miny;
+    }
+}
+
+static void SetDrawBoundsFromRects(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const SDL_FRect *rects, int count)
+{
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (!renderer->optimize_commands || count <= 0) {
+        return;
+    }
+
+    minx = SDL_min(rects[0].x, rects[0].x + rects[0].w);
+    miny = SDL_min(rects[0].y, rects[0].y + rects[0].h);
+    maxx = SDL_max(rects[0].x, rects[0].x + rects[0].w);
+    maxy = SDL_max(rects[0].y, rects[0].y + rects[0].h);
+    for (i = 1; i < count; ++i) {
+        const SDL_FRect *rect = &rects[i];
+        minx = SDL_min(minx, SDL_min(rect->x, rect->x + rect->w));
+        miny = SDL_min(miny, SDL_min(rect->y, rect->y + rect->h));
+        maxx = SDL_max(maxx, SDL_max(rect->x, rect->x + rect->w));
+        maxy = SDL_max(maxy, SDL_max(rect->y, rect->y + rect->h));
+    }
+
+    if (minx <= maxx && miny <= maxy) {
+        cmd->data.draw.bounds.x = minx;
+        cmd->data.draw.bounds.y = miny;
+        cmd->data.draw.bounds.w = maxx - minx;
+        cmd->data.draw.bounds.h = maxy - miny;
+    }
+}
+
+// Drop state changes that nothing reads and the ones that set the value that's already in effect
+static void DropRedundantRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *pending_color = NULL, *pending_viewport = NULL, *pending_cliprect = NULL;
+    const SDL_RenderCommand *color = NULL, *viewport = NULL, *cliprect = NULL;
+    SDL_RenderCommand *cmd, *prev, *next;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+            break;
+
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            if (pending_color) {
+                pending_color->command = SDL_RENDERCMD_NO_OP;
+            }
+            pending_color = cmd;
+            if (color &&
+                SDL_memcmp(&cmd->data.color.color, &color->data.color.color, sizeof(cmd->data.color.color)) == 0 &&
+                cmd->data.color.color_scale == color->data.color.color_scale) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+                pending_color = NULL;
+            }
+            break;
+
+        case SDL_RENDERCMD_SETVIEWPORT:
+            if (pending_viewport) {
+                pending_viewport->command = SDL_RENDERCMD_NO_OP;
+            }
+            pending_viewport = cmd;
+            if (viewport &&
+                SDL_memcmp(&cmd->data.viewport.rect, &viewport->data.viewport.rect, sizeof(cmd->data.viewport.rect)) == 0) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+                pending_viewport = NULL;
+            }
+            break;
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+            if (pending_cliprect) {
+                pending_cliprect->command = SDL_RENDERCMD_NO_OP;
+            }
+            pending_cliprect = cmd;
+            if (cliprect &&
+                cmd->data.cliprect.enabled == cliprect->data.cliprect.enabled &&
+                SDL_memcmp(&cmd->data.cliprect.rect, &cliprect->data.cliprect.rect, sizeof(cmd->data.cliprect.rect)) == 0) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+                pending_cliprect = NULL;
+            }
+            break;
+
+        default:
+            // Everything else might depend on any of the state
+            if (pending_color) {
+                color = pending_color;
+                pending_color = NULL;
+            }
+            if (pending_viewport) {
+                viewport = pending_viewport;
+                pending_viewport = NULL;
+            }
+            if (pending_cliprect) {
+                cliprect = pending_cliprect;
+                pending_cliprect = NULL;
+            }
+            break;
+        }
+    }
+
+    // Unlink the no-ops, including the ones that were queued that way
+    prev = NULL;
+    for (cmd = renderer->render_commands; cmd; cmd = next) {
+        next = cmd->next;
+        if (cmd->command == SDL_RENDERCMD_NO_OP) {
+            if (prev) {
+                prev->next = next;
+            } else {
+                renderer->render_commands = next;
+            }
+            if (renderer->render_commands_tail == cmd) {
+                renderer->render_commands_tail = prev;
+            }
+            cmd->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = cmd;
+        } else {
+            prev = cmd;
+        }
+    }
+}
+
+// A draw in a run that's being reordered, along with the draw color that's in effect for it
+typedef struct SDL_RenderDrawOrder
+{
+    SDL_RenderCommand *cmd;
+    SDL_FColor color;
+    float color_scale;
+} SDL_RenderDrawOrder;
+
+static bool SameDrawOrderColor(const SDL_RenderDrawOrder *a, const SDL_RenderDrawOrder *b)
+{
+    return a->color.r == b->color.r && a->color.g == b->color.g &&
+           a->color.b == b->color.b && a->color.a == b->color.a &&
+           a->color_scale == b->color_scale;
+}
+
+/* Group the draws in a run by texture and state, moving their vertex data along.
+ *
+ * The run starts with a draw color change, and ends with its last draw. The draw
+ * color changes in between are put back where the new order needs them, so every
+ * draw still sees the color it was queued with, and the run ends with the same
+ * color in effect.
+ */
+static int ReorderDrawCommands(SDL_Renderer *renderer, SDL_RenderCommand *prev, SDL_RenderCommand *first, SDL_RenderCommand *last, int count)
+{
+    SDL_RenderDrawOrder *order;
+    SDL_RenderDrawOrder item;
+    SDL_RenderCommand *cmd, *next, *following, *colors = NULL;
+    Uint8 *vertices = (Uint8 *)renderer->vertex_data;
+    size_t start = 0, end = 0, pos;
+    int i, j, num_ordered = 0, num_colors = 0, needed_colors, reordered = 0;
+
+    if (count > renderer->optimize_draws_allocation) {
+        const int new_allocation = SDL_max(count, renderer->optimize_draws_allocation * 2);
+        order = (SDL_RenderDrawOrder *)SDL_realloc(renderer->optimize_draws, new_allocation * sizeof(*order));
+        if (!order) {
+            return 0;
+        }
+        renderer->optimize_draws = order;
+        renderer->optimize_draws_allocation = new_allocation;
+    }
+    order = renderer->optimize_draws;
+
+    SDL_zero(item);
+    next = last->next;
+    for (cmd = first; cmd != next; cmd = cmd->next) {
+        int insert_at;
+
+        if (cmd->command == SDL_RENDERCMD_SETDRAWCOLOR) {
+            item.color = cmd->data.color.color;
+            item.color_scale = cmd->data.color.color_scale;
+            ++num_colors;
+            continue;
+        }
+
+        // The vertex data of the run has to be one block that can be shuffled around
+        if (num_ordered == 0) {
+            start = cmd->data.draw.vertex_start;
+            end = start;
+        }
+        if (cmd->data.draw.vertex_start != end || !CanMoveDrawVertices(cmd)) {
+            return 0;
+        }
+        end = cmd->data.draw.vertex_end;
+
+        item.cmd = cmd;
+        insert_at = num_ordered;
+        for (j = num_ordered - 1; j >= 0 && j >= num_ordered - SDL_RENDER_REORDER_WINDOW; --j) {
+            if (CanBatchDraws(order[j].cmd, cmd) && SameDrawOrderColor(&order[j], &item)) {
+                insert_at = j + 1;
+                break;
+            }
+            if (DrawsOverlap(order[j].cmd, cmd)) {
+                break;
+            }
+        }
+        if (insert_at < num_ordered) {
+            SDL_memmove(&order[insert_at + 1], &order[insert_at], (num_ordered - insert_at) * sizeof(*order));
+            ++reordered;
+        }
+        order[insert_at] = item;
+        ++num_ordered;
+    }
+    SDL_assert(num_ordered == count);
+
+    if (reordered == 0) {
+        return 0;
+    }
+
+    // Moving the vertex data mustn't break the alignment the backend asked for
+    if (renderer->vertex_data_alignment > 1) {
+        pos = start;
+        for (i = 0; i < count; ++i) {
+            cmd = order[i].cmd;
+            if (((pos - cmd->data.draw.vertex_start) % renderer->vertex_data_alignment) != 0) {
+                return 0;
+            }
+            pos += cmd->data.draw.vertex_end - cmd->data.draw.vertex_start;
+        }
+    }
+
+    // See how many color changes the new order needs, the last one restores the color the run ended with
+    needed_colors = 1;
+    for (i = 1; i < count; ++i) {
+        if (!SameDrawOrderColor(&order[i - 1], &order[i])) {
+            ++needed_colors;
+        }
+    }
+    if (!SameDrawOrderColor(&order[count - 1], &item)) {
+        ++needed_colors;
+    }
+
+    // Grouping draws of the same color never needs more color changes, but be safe
+    if (needed_colors > num_colors) {
+        return 0;
+    }
+
+    if (end - start > renderer->optimize_vertex_data_allocation) {
+        void *ptr = SDL_realloc(renderer->optimize_vertex_data, end - start);
+        if (!ptr) {
+            return 0;
+        }
+        renderer->optimize_vertex_data = ptr;
+        renderer->optimize_vertex_data_allocation = end - start;
+    }
+    SDL_memcpy(renderer->optimize_vertex_data, vertices + start, end - start);
+
+    pos = start;
+    for (i = 0; i < count; ++i) {
+        size_t size;
+
+        cmd = order[i].cmd;
+        size = cmd->data.draw.vertex_end - cmd->data.draw.vertex_start;
+        SDL_memcpy(vertices + pos, (Uint8 *)renderer->optimize_vertex_data + (cmd->data.draw.vertex_start - start), size);
+        cmd->data.draw.first = pos + (cmd->data.draw.first - cmd->data.draw.vertex_start);
+        cmd->data.draw.vertex_start = pos;
+        cmd->data.draw.vertex_end = pos + size;
+        pos += size;
+    }
+
+    // Chain the color changes of the run together to reuse them
+    for (cmd = first; cmd != next; cmd = following) {
+        following = cmd->next;
+        if (cmd->command == SDL_RENDERCMD_SETDRAWCOLOR) {
+            cmd->next = colors;
+            colors = cmd;
+        }
+    }
+
+    // Relink the run in the new order, with a color change wherever the color differs
+    cmd = prev;
+    for (i = 0; i < count; ++i) {
+        if (i == 0 || !SameDrawOrderColor(&order[i - 1], &order[i])) {
+            SDL_RenderCommand *color = colors;
+            colors = color->next;
+            color->data.color.color = order[i].color;
+            color->data.color.color_scale = order[i].color_scale;
+            if (cmd) {
+                cmd->next = color;
+            } else {
+                renderer->render_commands = color;
+            }
+            cmd = color;
+        }
+        cmd->next = order[i].cmd;
+        cmd = order[i].cmd;
+    }
+    if (!SameDrawOrderColor(&order[count - 1], &item)) {
+        SDL_RenderCommand *color = colors;
+        colors = color->next;
+        color->data.color.color = item.color;
+        color->data.color.color_scale = item.color_scale;
+        cmd->next = color;
+        cmd = color;
+    }
+    cmd->next = next;
+    if (!next) {
+        renderer->render_commands_tail = cmd;
+    }
+
+    // The color changes that aren't needed anymore go back to the pool
+    while (colors) {
+        cmd = colors;
+        colors = cmd->next;
+        cmd->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = cmd;
+    }
+    return reordered;
+}
+
+// Merge geometry with the geometry right before it, when its vertices directly follow
+static int MergeGeometryCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd, *next;
+    int merged = 0;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        while (cmd->command == SDL_RENDERCMD_GEOMETRY && (next = cmd->next) != NULL &&
+               CanBatchDraws(cmd, next) && CanMoveDrawVertices(cmd) &&
+               next->data.draw.first == cmd->data.draw.vertex_end &&
+               next->data.draw.vertex_start == cmd->data.draw.vertex_end &&
+               cmd->data.draw.count > 0 && next->data.draw.count > 0 &&
+               (cmd->data.draw.vertex_end - cmd->data.draw.first) * next->data.draw.count ==
+                   (next->data.draw.vertex_end - next->data.draw.first) * cmd->data.draw.count) {
+            cmd->data.draw.count += next->data.draw.count;
+            cmd->data.draw.vertex_end = next->data.draw.vertex_end;
+            UnionDrawBounds(&cmd->data.draw.bounds, &next->data.draw.bounds);
+
+            cmd->next = next->next;
+            if (renderer->render_commands_tail == next) {
+                renderer->render_commands_tail = cmd;
+            }
+            next->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = next;
+            ++merged;
+        }
+    }
+    return merged;
+}
+
+static void OptimizeRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommandStats *stats = &renderer->pending_command_stats;
+    SDL_RenderCommand *cmd, *prev = NULL, *run_prev = NULL, *run_first = NULL, *run_last = NULL;
+    int run_count = 0, merged, submitted = 0;
+
+    DropRedundantRenderCommands(renderer);
+
+    // Find the runs of draws and draw color changes, which aren't separated by other state changes or clears
+    for (cmd = renderer->render_commands; cmd; prev = cmd, cmd = cmd->next) {
+        if (cmd->command == SDL_RENDERCMD_SETDRAWCOLOR) {
+            if (!run_first) {
+                run_prev = prev;
+                run_first = cmd;
+                run_last = NULL;
+                run_count = 0;
+            }
+        } else if (IsDrawCommand(cmd->command)) {
+            if (run_first) {
+                run_last = cmd;
+                ++run_count;
+            }
+        } else {
+            if (run_count > 2) {
+                stats->draws_reordered += ReorderDrawCommands(renderer, run_prev, run_first, run_last, run_count);
+            }
+            run_first = NULL;
+            run_count = 0;
+        }
+    }
+    if (run_count > 2) {
+        stats->draws_reordered += ReorderDrawCommands(renderer, run_prev, run_first, run_last, run_count);
+    }
+
+    merged = MergeGeometryCommands(renderer);
+    stats->draws_merged += merged;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        ++submitted;
+    }
+    stats->commands_submitted += submitted;
+    stats->commands_dropped += renderer->render_commands_queued - submitted - merged;
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
     bool result;
@@ -321,6 +813,12 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         return true;
     }
 
+    if (renderer->optimize_commands) {
+        OptimizeRenderCommands(renderer);
+    } else {
+        renderer->pending_command_stats.commands_submitted += renderer->render_commands_queued;
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
 
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
@@ -333,7 +831,10 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         renderer->render_commands = NULL;
     }
     renderer->vertex_data_used = 0;
+    renderer->vertex_data_alignment = 0;
     renderer->render_command_generation++;
+    renderer->pending_command_stats.flushes++;
+    renderer->render_commands_queued = 0;
     renderer->color_queued = false;
     renderer->viewport_queued = false;
     renderer->cliprect_queued = false;
@@ -378,6 +879,18 @@ bool SDL_FlushRenderer(SDL_Renderer *renderer)
     return true;
 }
 
+bool SDL_GetRenderCommandStats(SDL_Renderer *renderer, SDL_RenderCommandStats *stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    CHECK_PARAM(!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    *stats = renderer->command_stats;
+    return true;
+}
+
 void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t alignment, size_t *offset)
 {
     const size_t needed = renderer->vertex_data_used + numbytes + alignment;
@@ -408,6 +921,7 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     }
 
     renderer->vertex_data_used += aligner + numbytes;
+    renderer->vertex_data_alignment = SDL_max(renderer->vertex_data_alignment, alignment);
 
     return ((Uint8 *)renderer->vertex_data) + aligned;
 }
@@ -434,6 +948,8 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    renderer->render_commands_queued++;
+    renderer->pending_command_stats.commands_queued++;
 
     return result;
 }
@@ -602,6 +1118,9 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.gpu_render_state = renderer->gpu_render_state;
+            cmd->data.draw.bounds.w = -1.0f;
+            cmd->data.draw.vertex_start = renderer->vertex_data_used;
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
             if (renderer->gpu_render_state) {
                 renderer->gpu_render_state->last_command_generation = renderer->render_command_generation;
             }
@@ -619,6 +1138,7 @@ static bool QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points,
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
     }
     return result;
 }
@@ -632,6 +1152,7 @@ static bool QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points,
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
     }
     return result;
 }
@@ -705,6 +1226,8 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
                 cmd->command = SDL_RENDERCMD_NO_OP;
             }
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        SetDrawBoundsFromRects(renderer, cmd, rects, count);
     }
     return result;
 }
@@ -772,6 +1295,8 @@ static bool QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        SetDrawBoundsFromRects(renderer, cmd, dstrect, 1);
     }
     return result;
 }
@@ -787,6 +1312,17 @@ static bool QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        if (renderer->optimize_commands) {
+            // Any rotation stays within the circle around the center that touches the farthest corner
+            const float cx = dstrect->x + center->x;
+            const float cy = dstrect->y + center->y;
+            const float dx = SDL_max(SDL_fabsf(center->x), SDL_fabsf(dstrect->w - center->x));
+            const float dy = SDL_max(SDL_fabsf(center->y), SDL_fabsf(dstrect->h - center->y));
+            const float radius = SDL_sqrtf(dx * dx + dy * dy);
+            const float corners[4] = { cx - radius, cy - radius, cx + radius, cy + radius };
+            SetDrawBoundsFromPoints(renderer, cmd, corners, 2 * sizeof(float), 2, scale_x, scale_y);
+        }
     }
     return result;
 }
@@ -814,6 +1350,8 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
+        cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        SetDrawBoundsFromPoints(renderer, cmd, xy, xy_stride, num_vertices, scale_x, scale_y);
     }
     return result;
 }
@@ -1201,6 +1739,8 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         renderer->line_method = SDL_GetRenderLineMethod();
     }
 
+    renderer->optimize_commands = SDL_GetHintBoolean(SDL_HINT_RENDER_OPTIMIZE_COMMANDS, false);
+
     renderer->scale_mode = SDL_SCALEMODE_LINEAR;
 
     renderer->SDR_white_point = 1.0f;
@@ -5597,6 +6137,9 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
 
+    renderer->command_stats = renderer->pending_command_stats;
+    SDL_zero(renderer->pending_command_stats);
+
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
     if (renderer->hidden) {
@@ -5696,6 +6239,8 @@ static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
     renderer->vertex_data_used = 0;
+    renderer->vertex_data_alignment = 0;
+    renderer->render_commands_queued = 0;
 
     while (cmd) {
         SDL_RenderCommand *next = cmd->next;
@@ -5759,6 +6304,14 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_free(renderer->vertex_data);
         renderer->vertex_data = NULL;
     }
+    if (renderer->optimize_vertex_data) {
+        SDL_free(renderer->optimize_vertex_data);
+        renderer->optimize_vertex_data = NULL;
+    }
+    if (renderer->optimize_draws) {
+        SDL_free(renderer->optimize_draws);
+        renderer->optimize_draws = NULL;
+    }
     if (renderer->texture_formats) {
         SDL_free(renderer->texture_formats);
         renderer->texture_formats = NULL;
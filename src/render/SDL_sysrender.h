@@ -194,6 +194,9 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            SDL_FRect bounds;    // the area drawn relative to the viewport, or a negative width if unknown
+            size_t vertex_start; // the range of vertex data allocated while queueing this draw
+            size_t vertex_end;
         } draw;
         struct
         {
@@ -345,6 +348,17 @@ struct SDL_Renderer
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
+    size_t vertex_data_alignment; // the largest alignment asked for since the last flush
+
+    // Command queue optimization, see SDL_HINT_RENDER_OPTIMIZE_COMMANDS
+    bool optimize_commands;
+    int render_commands_queued;
+    struct SDL_RenderDrawOrder *optimize_draws;
+    int optimize_draws_allocation;
+    void *optimize_vertex_data;
+    size_t optimize_vertex_data_allocation;
+    SDL_RenderCommandStats command_stats;
+    SDL_RenderCommandStats pending_command_stats;
 
     // Shaped window support
     bool transparent_window;
@@ -34,6 +34,7 @@
 #include "SDL_triangle.h"
 #include "../../video/SDL_pixels_c.h"
 #include "../../video/SDL_rotate.h"
+#include "../../thread/SDL_thread_c.h"
 
 // SDL surface based renderer implementation
 
@@ -49,6 +50,7 @@ typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    struct SW_TileBatch *batch; // kept between command queues, see SW_GetTileBatch()
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -662,20 +664,20 @@ static bool SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL
     return true;
 }
 
+static void SetTextureState(SDL_Surface *surface, const SDL_RenderCommand *cmd, SDL_Color color)
+{
+    // !!! FIXME: we can probably avoid some of these calls.
+    SDL_SetSurfaceColorMod(surface, color.r, color.g, color.b);
+    SDL_SetSurfaceAlphaMod(surface, color.a);
+    SDL_SetSurfaceBlendMode(surface, cmd->data.draw.blend);
+}
+
 static void PrepTextureForCopy(const SDL_RenderCommand *cmd, SW_DrawStateCache *drawstate)
 {
-    const Uint8 r = drawstate->color.r;
-    const Uint8 g = drawstate->color.g;
-    const Uint8 b = drawstate->color.b;
-    const Uint8 a = drawstate->color.a;
-    const SDL_BlendMode blend = cmd->data.draw.blend;
     SDL_Texture *texture = cmd->data.draw.texture;
     SDL_Surface *surface = (SDL_Surface *)texture->internal;
 
-    // !!! FIXME: we can probably avoid some of these calls.
-    SDL_SetSurfaceColorMod(surface, r, g, b);
-    SDL_SetSurfaceAlphaMod(surface, a);
-    SDL_SetSurfaceBlendMode(surface, blend);
+    SetTextureState(surface, cmd, drawstate->color);
 }
 
 static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
@@ -705,16 +707,682 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
     // SW_DrawStateCache only lives during SW_RunCommandQueue, so nothing to do here!
 }
 
+// Tile-parallel drawing, see SDL_HINT_RENDER_SOFTWARE_THREADS.
+//
+// Clears, rectangle fills, unscaled copies and geometry are sorted into
+// fixed size tiles of the render target as they come out of the command
+// queue. Each tile draws its own list in submission order through a
+// surface that views its part of the target, and textures are read through
+// per-tile surfaces sharing their pixels, so no two threads ever touch the
+// same SDL_Surface. Everything else is a barrier: the pending tiles are
+// drawn and then the command runs on the calling thread as usual.
+#define SW_TILE_SIZE 128
+
+typedef struct SW_TileItem
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect cliprect;
+    bool clipped; // clears ignore the clip rect
+    SDL_Color color;
+} SW_TileItem;
+
+typedef struct SW_TileTexture
+{
+    SDL_Surface *src;
+    SDL_Surface *surface;
+} SW_TileTexture;
+
+typedef struct SW_Tile
+{
+    SDL_Rect rect;
+    SDL_Surface *surface;
+    int *items;
+    int num_items;
+    int max_items;
+    SW_TileTexture *textures;
+    int num_textures;
+    int max_textures;
+    SDL_Rect *rects;
+    int max_rects;
+} SW_Tile;
+
+typedef struct SW_TileBatch
+{
+    int w;
+    int h;
+    SDL_PixelFormat format;
+    SDL_Surface *surface;
+    void *pixels;
+    int pitch;
+    SDL_Colorspace colorspace;
+    Uint8 *vertices;
+    int num_threads;
+    SW_TileItem *items;
+    int num_items;
+    int max_items;
+    SW_Tile *tiles;
+    SW_Tile **active;
+    int tiles_x;
+    int tiles_y;
+    int num_active;
+    SDL_AtomicInt next_tile;
+} SW_TileBatch;
+
+static int SW_GetTileThreadCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int num_threads;
+
+    if (!hint || !*hint) {
+        return 1;
+    }
+
+    num_threads = SDL_atoi(hint);
+    if (num_threads == 0) {
+        num_threads = SDL_GetNumLogicalCPUCores();
+    }
+    return SDL_max(num_threads, 1);
+}
+
+static void SW_DestroyTileBatch(SW_TileBatch *batch)
+{
+    int i;
+
+    if (!batch) {
+        return;
+    }
+
+    for (i = 0; batch->tiles && i < batch->tiles_x * batch->tiles_y; ++i) {
+        SW_Tile *tile = &batch->tiles[i];
+        SDL_DestroySurface(tile->surface);
+        SDL_free(tile->items);
+        SDL_free(tile->textures);
+        SDL_free(tile->rects);
+    }
+    SDL_free(batch->tiles);
+    SDL_free(batch->active);
+    SDL_free(batch->items);
+    SDL_free(batch);
+}
+
+// Points the tile surfaces at `surface`, which has the size and format the batch was created for
+static bool SW_SetTileBatchTarget(SW_TileBatch *batch, SDL_Surface *surface)
+{
+    const int bpp = SDL_BYTESPERPIXEL(surface->format);
+    int i;
+
+    if (surface == batch->surface && surface->pixels == batch->pixels &&
+        surface->pitch == batch->pitch && surface->colorspace == batch->colorspace) {
+        return true;
+    }
+    batch->surface = NULL;
+
+    for (i = 0; i < batch->tiles_x * batch->tiles_y; ++i) {
+        SW_Tile *tile = &batch->tiles[i];
+        Uint8 *pixels = (Uint8 *)surface->pixels + tile->rect.y * surface->pitch + tile->rect.x * bpp;
+
+        SDL_DestroySurface(tile->surface);
+        tile->surface = SDL_CreateSurfaceFrom(tile->rect.w, tile->rect.h, surface->format, pixels, surface->pitch);
+        if (!tile->surface ||
+            !SDL_SetSurfaceColorspace(tile->surface, surface->colorspace) ||
+            (surface->props && !SDL_CopyProperties(surface->props, SDL_GetSurfaceProperties(tile->surface)))) {
+            return false;
+        }
+    }
+    batch->surface = surface;
+    batch->pixels = surface->pixels;
+    batch->pitch = surface->pitch;
+    batch->colorspace = surface->colorspace;
+    return true;
+}
+
+static SW_TileBatch *SW_CreateTileBatch(SDL_Surface *surface)
+{
+    SW_TileBatch *batch;
+    int tiles_x, tiles_y, x, y;
+
+    tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+
+    batch = (SW_TileBatch *)SDL_calloc(1, sizeof(*batch));
+    if (!batch) {
+        return NULL;
+    }
+    batch->w = surface->w;
+    batch->h = surface->h;
+    batch->format = surface->format;
+    batch->tiles_x = tiles_x;
+    batch->tiles_y = tiles_y;
+    batch->tiles = (SW_Tile *)SDL_calloc(tiles_x * tiles_y, sizeof(*batch->tiles));
+    batch->active = (SW_Tile **)SDL_calloc(tiles_x * tiles_y, sizeof(*batch->active));
+    if (!batch->tiles || !batch->active) {
+        SW_DestroyTileBatch(batch);
+        return NULL;
+    }
+
+    for (y = 0; y < tiles_y; ++y) {
+        for (x = 0; x < tiles_x; ++x) {
+            SW_Tile *tile = &batch->tiles[y * tiles_x + x];
+
+            tile->rect.x = x * SW_TILE_SIZE;
+            tile->rect.y = y * SW_TILE_SIZE;
+            tile->rect.w = SDL_min(SW_TILE_SIZE, surface->w - tile->rect.x);
+            tile->rect.h = SDL_min(SW_TILE_SIZE, surface->h - tile->rect.y);
+        }
+    }
+    return batch;
+}
+
+// The batch and its tile surfaces stay on the renderer, and are only rebuilt when the target changes
+static SW_TileBatch *SW_GetTileBatch(SW_RenderData *data, SDL_Surface *surface, void *vertices, int num_threads)
+{
+    SW_TileBatch *batch = data->batch;
+    const int tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    const int tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+
+    if (tiles_x * tiles_y < 2 || SDL_MUSTLOCK(surface) || SDL_ISPIXELFORMAT_INDEXED(surface->format)) {
+        return NULL;
+    }
+
+    if (batch && (batch->w != surface->w || batch->h != surface->h || batch->format != surface->format)) {
+        SW_DestroyTileBatch(batch);
+        batch = data->batch = NULL;
+    }
+    if (!batch) {
+        batch = data->batch = SW_CreateTileBatch(surface);
+        if (!batch) {
+            return NULL;
+        }
+    }
+    if (!SW_SetTileBatchTarget(batch, surface)) {
+        SW_DestroyTileBatch(batch);
+        data->batch = NULL;
+        return NULL;
+    }
+    batch->vertices = (Uint8 *)vertices;
+    batch->num_threads = num_threads;
+    return batch;
+}
+
+static bool SW_GrowTileArray(void **array, int *max, int count, size_t size)
+{
+    if (count >= *max) {
+        int new_max = *max ? *max * 2 : 16;
+        void *new_array;
+
+        while (new_max <= count) {
+            new_max *= 2;
+        }
+        new_array = SDL_realloc(*array, new_max * size);
+        if (!new_array) {
+            return false;
+        }
+        *array = new_array;
+        *max = new_max;
+    }
+    return true;
+}
+
+// Only the calling thread touches the texture itself, the tiles get their own surface on top of its pixels
+static bool SW_CanTileTexture(SW_TileBatch *batch, const SDL_RenderCommand *cmd, SDL_Color color)
+{
+    SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->internal;
+
+    if (src == batch->surface || SDL_ISPIXELFORMAT_INDEXED(src->format)) {
+        return false;
+    }
+    if (cmd->command == SDL_RENDERCMD_COPY && SDL_SurfaceHasRLE(src) &&
+        cmd->data.draw.blend == SDL_BLENDMODE_BLEND && SDL_ISPIXELFORMAT_ALPHA(src->format) &&
+        color.r == 255 && color.g == 255 && color.b == 255 && color.a == 255) {
+        // This is an RLE blit, which rounds differently, so every tile encodes its own copy of small textures
+        if (src->w * src->h > SW_TILE_SIZE * SW_TILE_SIZE) {
+            return false;
+        }
+    }
+    if (SDL_MUSTLOCK(src)) {
+        // Make the pixels available again, the texture is encoded again the next time it's drawn on the calling thread
+        if (!SDL_LockSurface(src)) {
+            return false;
+        }
+        SDL_UnlockSurface(src);
+    }
+    return true;
+}
+
+static bool SW_BinCommand(SW_TileBatch *batch, const SDL_RenderCommand *cmd, SW_DrawStateCache *drawstate)
+{
+    SDL_Surface *surface = batch->surface;
+    const SDL_Rect *viewport = drawstate->viewport;
+    Uint8 *verts = batch->vertices + cmd->data.draw.first;
+    const size_t vertex_size = cmd->data.draw.texture ? sizeof(GeometryCopyData) : sizeof(GeometryFillData);
+    const size_t vertex_offset = cmd->data.draw.texture ? offsetof(GeometryCopyData, dst) : offsetof(GeometryFillData, dst);
+    SW_TileItem *item;
+    SDL_Rect clip;
+    SDL_Point vp = { 0, 0 };
+    int count = (int)cmd->data.draw.count;
+    int i, x, y, x0, y0, x1, y1;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        clip.x = 0;
+        clip.y = 0;
+        clip.w = surface->w;
+        clip.h = surface->h;
+        break;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        SDL_Rect bounds;
+
+        if (!viewport) {
+            return false;
+        }
+        if (drawstate->cliprect) {
+            clip.x = drawstate->cliprect->x + viewport->x;
+            clip.y = drawstate->cliprect->y + viewport->y;
+            clip.w = drawstate->cliprect->w;
+            clip.h = drawstate->cliprect->h;
+            SDL_GetRectIntersection(viewport, &clip, &clip);
+        } else {
+            clip = *viewport;
+        }
+        bounds.x = 0;
+        bounds.y = 0;
+        bounds.w = surface->w;
+        bounds.h = surface->h;
+        if (!SDL_GetRectIntersection(&clip, &bounds, &clip)) {
+            clip.w = clip.h = 0;
+        }
+        break;
+    }
+
+    default:
+        return false;
+    }
+
+    if (cmd->command == SDL_RENDERCMD_COPY) {
+        const SDL_Rect *rects = (const SDL_Rect *)verts;
+
+        // Scaled copies don't clip exactly at tile edges
+        if (rects[0].w != rects[1].w || rects[0].h != rects[1].h) {
+            return false;
+        }
+    }
+    if ((cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_GEOMETRY) &&
+        cmd->data.draw.texture && !SW_CanTileTexture(batch, cmd, drawstate->color)) {
+        return false;
+    }
+    if (!SW_GrowTileArray((void **)&batch->items, &batch->max_items, batch->num_items, sizeof(*batch->items))) {
+        return false;
+    }
+    if (clip.w <= 0 || clip.h <= 0) {
+        return true;
+    }
+
+    // Find the range of tiles touched by the command, once the viewport is applied
+    if (cmd->command != SDL_RENDERCMD_CLEAR) {
+        vp.x = viewport->x;
+        vp.y = viewport->y;
+    }
+    x0 = clip.x / SW_TILE_SIZE;
+    y0 = clip.y / SW_TILE_SIZE;
+    x1 = (clip.x + clip.w - 1) / SW_TILE_SIZE;
+    y1 = (clip.y + clip.h - 1) / SW_TILE_SIZE;
+
+    if (cmd->command == SDL_RENDERCMD_FILL_RECTS || cmd->command == SDL_RENDERCMD_COPY) {
+        const SDL_Rect *rects = (const SDL_Rect *)verts;
+        int min_x = SDL_MAX_SINT32, min_y = SDL_MAX_SINT32, max_x = SDL_MIN_SINT32, max_y = SDL_MIN_SINT32;
+
+        if (cmd->command == SDL_RENDERCMD_COPY) {
+            // Only the destination rectangle matters
+            rects += 1;
+            count = 1;
+        }
+        for (i = 0; i < count; i++) {
+            if (rects[i].w > 0 && rects[i].h > 0) {
+                min_x = SDL_min(min_x, rects[i].x + vp.x);
+                min_y = SDL_min(min_y, rects[i].y + vp.y);
+                max_x = SDL_max(max_x, rects[i].x + vp.x + rects[i].w - 1);
+                max_y = SDL_max(max_y, rects[i].y + vp.y + rects[i].h - 1);
+            }
+        }
+        if (max_x < 0 || max_y < 0) {
+            return true;
+        }
+        x0 = SDL_max(x0, SDL_max(min_x, 0) / SW_TILE_SIZE);
+        y0 = SDL_max(y0, SDL_max(min_y, 0) / SW_TILE_SIZE);
+        x1 = SDL_min(x1, max_x / SW_TILE_SIZE);
+        y1 = SDL_min(y1, max_y / SW_TILE_SIZE);
+    } else if (cmd->command == SDL_RENDERCMD_GEOMETRY) {
+        int min_x = SDL_MAX_SINT32, min_y = SDL_MAX_SINT32, max_x = SDL_MIN_SINT32, max_y = SDL_MIN_SINT32;
+        SDL_Point tile_size;
+
+        // Triangles only cover pixels inside their bounds in fixed point, so find the tiles in fixed point too
+        tile_size.x = SW_TILE_SIZE;
+        tile_size.y = SW_TILE_SIZE;
+        trianglepoint_2_fixedpoint(&tile_size);
+        trianglepoint_2_fixedpoint(&vp);
+        for (i = 0; i < count; i++) {
+            const SDL_Point *dst = (const SDL_Point *)(verts + i * vertex_size + vertex_offset);
+            min_x = SDL_min(min_x, dst->x + vp.x);
+            min_y = SDL_min(min_y, dst->y + vp.y);
+            max_x = SDL_max(max_x, dst->x + vp.x);
+            max_y = SDL_max(max_y, dst->y + vp.y);
+        }
+        if (max_x < 0 || max_y < 0) {
+            return true;
+        }
+        x0 = SDL_max(x0, SDL_max(min_x, 0) / tile_size.x);
+        y0 = SDL_max(y0, SDL_max(min_y, 0) / tile_size.y);
+        x1 = SDL_min(x1, max_x / tile_size.x);
+        y1 = SDL_min(y1, max_y / tile_size.y);
+    }
+
+    for (y = y0; y <= y1; ++y) {
+        for (x = x0; x <= x1; ++x) {
+            SW_Tile *tile = &batch->tiles[y * batch->tiles_x + x];
+            if (!SW_GrowTileArray((void **)&tile->items, &tile->max_items, tile->num_items, sizeof(*tile->items))) {
+                return false;
+            }
+        }
+    }
+
+    // Apply viewport, exactly like the commands run on the calling thread
+    if (vp.x || vp.y) {
+        if (cmd->command == SDL_RENDERCMD_GEOMETRY) {
+            for (i = 0; i < count; i++) {
+                SDL_Point *dst = (SDL_Point *)(verts + i * vertex_size + vertex_offset);
+                dst->x += vp.x;
+                dst->y += vp.y;
+            }
+        } else {
+            SDL_Rect *rects = (SDL_Rect *)verts;
+            if (cmd->command == SDL_RENDERCMD_COPY) {
+                rects += 1;
+            }
+            for (i = 0; i < count; i++) {
+                rects[i].x += vp.x;
+                rects[i].y += vp.y;
+            }
+        }
+    }
+
+    for (y = y0; y <= y1; ++y) {
+        for (x = x0; x <= x1; ++x) {
+            SW_Tile *tile = &batch->tiles[y * batch->tiles_x + x];
+            tile->items[tile->num_items++] = batch->num_items;
+        }
+    }
+
+    item = &batch->items[batch->num_items++];
+    item->cmd = cmd;
+    item->cliprect = clip;
+    item->clipped = (cmd->command != SDL_RENDERCMD_CLEAR);
+    item->color = drawstate->color;
+    return true;
+}
+
+static SDL_Surface *SW_GetTileTexture(SW_Tile *tile, SDL_Texture *texture)
+{
+    SDL_Surface *src = (SDL_Surface *)texture->internal;
+    SDL_Surface *surface;
+    int i;
+
+    for (i = 0; i < tile->num_textures; ++i) {
+        if (tile->textures[i].src == src) {
+            return tile->textures[i].surface;
+        }
+    }
+
+    if (!SW_GrowTileArray((void **)&tile->textures, &tile->max_textures, tile->num_textures, sizeof(*tile->textures))) {
+        return NULL;
+    }
+    surface = SDL_CreateSurfaceFrom(src->w, src->h, src->format, src->pixels, src->pitch);
+    if (!surface) {
+        return NULL;
+    }
+    if (!SDL_SetSurfaceColorspace(surface, src->colorspace) ||
+        !SDL_SetSurfaceRLE(surface, SDL_SurfaceHasRLE(src)) ||
+        (src->props && !SDL_CopyProperties(src->props, SDL_GetSurfaceProperties(surface)))) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+    tile->textures[tile->num_textures].src = src;
+    tile->textures[tile->num_textures].surface = surface;
+    ++tile->num_textures;
+    return surface;
+}
+
+static void SW_DrawTileItem(SW_TileBatch *batch, SW_Tile *tile, const SW_TileItem *item)
+{
+    const SDL_RenderCommand *cmd = item->cmd;
+    SDL_Surface *surface = tile->surface;
+    Uint8 *verts = batch->vertices + cmd->data.draw.first;
+    const int count = (int)cmd->data.draw.count;
+    int i;
+
+    if (item->clipped) {
+        SDL_Rect clip = item->cliprect;
+        clip.x -= tile->rect.x;
+        clip.y -= tile->rect.y;
+        SDL_SetSurfaceClipRect(surface, &clip);
+    } else {
+        SDL_SetSurfaceClipRect(surface, NULL);
+    }
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+    {
+        const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        break;
+    }
+
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const SDL_Rect *rects = (const SDL_Rect *)verts;
+        const SDL_Color color = item->color;
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+
+        if (!SW_GrowTileArray((void **)&tile->rects, &tile->max_rects, count - 1, sizeof(*tile->rects))) {
+            break;
+        }
+        for (i = 0; i < count; i++) {
+            tile->rects[i] = rects[i];
+            tile->rects[i].x -= tile->rect.x;
+            tile->rects[i].y -= tile->rect.y;
+        }
+
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_FillSurfaceRects(surface, tile->rects, count, SDL_MapSurfaceRGBA(surface, color.r, color.g, color.b, color.a));
+        } else {
+            SDL_BlendFillRects(surface, tile->rects, count, blend, color.r, color.g, color.b, color.a);
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        const SDL_Rect *rects = (const SDL_Rect *)verts;
+        SDL_Surface *src = SW_GetTileTexture(tile, cmd->data.draw.texture);
+        SDL_Rect dstrect;
+
+        if (!src) {
+            break;
+        }
+        SetTextureState(src, cmd, item->color);
+
+        dstrect = rects[1];
+        dstrect.x -= tile->rect.x;
+        dstrect.y -= tile->rect.y;
+        SDL_BlitSurface(src, &rects[0], surface, &dstrect);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        SDL_Surface *src = NULL;
+        SDL_Point origin, size;
+
+        if (cmd->data.draw.texture) {
+            src = SW_GetTileTexture(tile, cmd->data.draw.texture);
+            if (!src) {
+                break;
+            }
+            SetTextureState(src, cmd, item->color);
+        }
+
+        origin.x = tile->rect.x;
+        origin.y = tile->rect.y;
+        trianglepoint_2_fixedpoint(&origin);
+        size.x = tile->rect.w;
+        size.y = tile->rect.h;
+        trianglepoint_2_fixedpoint(&size);
+
+        for (i = 0; i < count; i += 3) {
+            SDL_Point s[3], d[3];
+            SDL_Color c[3];
+            int j;
+
+            for (j = 0; j < 3; ++j) {
+                if (src) {
+                    const GeometryCopyData *ptr = (const GeometryCopyData *)verts + i + j;
+                    s[j] = ptr->src;
+                    d[j] = ptr->dst;
+                    c[j] = ptr->color;
+                } else {
+                    const GeometryFillData *ptr = (const GeometryFillData *)verts + i + j;
+                    d[j] = ptr->dst;
+                    c[j] = ptr->color;
+                }
+            }
+
+            // Skip triangles that don't reach into this tile
+            if (SDL_max(d[0].x, SDL_max(d[1].x, d[2].x)) < origin.x ||
+                SDL_max(d[0].y, SDL_max(d[1].y, d[2].y)) < origin.y ||
+                SDL_min(d[0].x, SDL_min(d[1].x, d[2].x)) >= origin.x + size.x ||
+                SDL_min(d[0].y, SDL_min(d[1].y, d[2].y)) >= origin.y + size.y) {
+                continue;
+            }
+
+            for (j = 0; j < 3; ++j) {
+                d[j].x -= origin.x;
+                d[j].y -= origin.y;
+            }
+            if (src) {
+                SDL_SW_BlitTriangle(
+                    src,
+                    &s[0], &s[1], &s[2],
+                    surface,
+                    &d[0], &d[1], &d[2],
+                    c[0], c[1], c[2],
+                    cmd->data.draw.texture_address_mode_u,
+                    cmd->data.draw.texture_address_mode_v);
+            } else {
+                SDL_SW_FillTriangle(surface, &d[0], &d[1], &d[2], cmd->data.draw.blend, c[0], c[1], c[2]);
+            }
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+static void SDLCALL SW_DrawTilesJob(void *userdata)
+{
+    SW_TileBatch *batch = (SW_TileBatch *)userdata;
+    int i, j;
+
+    while ((i = SDL_AddAtomicInt(&batch->next_tile, 1)) < batch->num_active) {
+        SW_Tile *tile = batch->active[i];
+        for (j = 0; j < tile->num_items; ++j) {
+            SW_DrawTileItem(batch, tile, &batch->items[tile->items[j]]);
+        }
+    }
+}
+
+static void SW_FlushTileBatch(SW_TileBatch *batch)
+{
+    SDL_JobPool *pool = NULL;
+    SDL_JobGroup *group = NULL;
+    int num_jobs, i, j;
+
+    if (batch->num_items == 0) {
+        return;
+    }
+
+    batch->num_active = 0;
+    for (i = 0; i < batch->tiles_x * batch->tiles_y; ++i) {
+        if (batch->tiles[i].num_items > 0) {
+            batch->active[batch->num_active++] = &batch->tiles[i];
+        }
+    }
+    SDL_SetAtomicInt(&batch->next_tile, 0);
+
+    num_jobs = SDL_min(batch->num_threads, batch->num_active);
+    if (num_jobs > 1) {
+        pool = SDL_GetInternalJobPool();
+        if (pool) {
+            group = SDL_CreateJobGroup(pool);
+        }
+    }
+    if (group) {
+        for (i = 1; i < num_jobs; ++i) {
+            if (!SDL_SubmitJob(pool, group, SW_DrawTilesJob, batch)) {
+                break;
+            }
+        }
+    }
+
+    // The calling thread draws tiles too, and picks up all of them if no jobs could be started
+    SW_DrawTilesJob(batch);
+
+    if (group) {
+        SDL_WaitJobGroup(group);
+        SDL_DestroyJobGroup(group);
+    }
+
+    // Texture pixels may be replaced by the commands that follow, so the tiles don't keep them
+    for (i = 0; i < batch->num_active; ++i) {
+        SW_Tile *tile = batch->active[i];
+        for (j = 0; j < tile->num_textures; ++j) {
+            SDL_DestroySurface(tile->textures[j].surface);
+        }
+        tile->num_textures = 0;
+        tile->num_items = 0;
+    }
+    batch->num_active = 0;
+    batch->num_items = 0;
+}
+
 
 static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
+    SW_TileBatch *batch = NULL;
+    int num_threads;
 
     if (!SDL_SurfaceValid(surface)) {
         return false;
     }
 
+    num_threads = SW_GetTileThreadCount();
+    if (num_threads > 1) {
+        batch = SW_GetTileBatch(data, surface, vertices, num_threads);
+    } else if (data->batch) {
+        SW_DestroyTileBatch(data->batch);
+        data->batch = NULL;
+    }
+
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = true;
@@ -724,6 +1392,20 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
     drawstate.color.a = 0;
 
     while (cmd) {
+        if (batch) {
+            if (SW_BinCommand(batch, cmd, &drawstate)) {
+                cmd = cmd->next;
+                continue;
+            }
+            if (cmd->command != SDL_RENDERCMD_NO_OP &&
+                cmd->command != SDL_RENDERCMD_SETVIEWPORT &&
+                cmd->command != SDL_RENDERCMD_SETCLIPRECT &&
+                cmd->command != SDL_RENDERCMD_SETDRAWCOLOR) {
+                // This is drawn on the calling thread, on top of everything the tiles have queued
+                SW_FlushTileBatch(batch);
+            }
+        }
+
         switch (cmd->command) {
         case SDL_RENDERCMD_SETDRAWCOLOR:
         {
@@ -993,6 +1675,10 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         cmd = cmd->next;
     }
 
+    if (batch) {
+        SW_FlushTileBatch(batch);
+    }
+
     return true;
 }
 
@@ -1047,6 +1733,7 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    SW_DestroyTileBatch(data->batch);
     SDL_free(data);
 }
 
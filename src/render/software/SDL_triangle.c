@@ -151,80 +151,207 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
 
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
- * The cross product isn't computed from scratch at each iteration,
- * but optimized using constant step increments
+ * Each edge function is linear along a row, so the pixels of a row that are
+ * inside the triangle are found directly from the three of them, and only
+ * those are visited.
  *
+ * The texture coordinates and colors are linear along the row as well, so
+ * they're stepped from pixel to pixel instead of dividing by the area each
+ * time, with exactly the same result.
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
-                    Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
+// Interpolates trunc(n / area) along a row, where n grows by a constant step from pixel to pixel
+typedef struct TriangleStep
+{
+    Sint64 quotient; // floor(n / area)
+    Sint64 remainder; // 0 <= remainder < area
+    Sint64 step_quotient;
+    Sint64 step_remainder;
+    Sint64 area;
+} TriangleStep;
+
+static SDL_INLINE Sint64 floor_div(Sint64 n, Sint64 d)
+{
+    Sint64 q = n / d;
+    if (n % d != 0 && n < 0) {
+        --q;
+    }
+    return q;
+}
+
+// The step from pixel to pixel is the same for the whole triangle
+static SDL_INLINE void setup_triangle_step(TriangleStep *step, Sint64 n_step, Sint64 area)
+{
+    step->quotient = 0;
+    step->remainder = 0;
+    step->step_quotient = floor_div(n_step, area);
+    step->step_remainder = n_step - step->step_quotient * area;
+    step->area = area;
+}
+
+static SDL_INLINE void start_triangle_step(TriangleStep *step, Sint64 n)
+{
+    step->quotient = floor_div(n, step->area);
+    step->remainder = n - step->quotient * step->area;
+}
+
+static SDL_INLINE void next_triangle_step(TriangleStep *step)
+{
+    // Branch-free, the carry is about as likely as not
+    const Sint64 remainder = step->remainder + step->step_remainder - step->area;
+    const Sint64 borrow = remainder >> 63; // -1 if there was no carry
+    step->quotient += step->step_quotient + 1 + borrow;
+    step->remainder = remainder + (step->area & borrow);
+}
+
+// Rounds towards zero, like the division it replaces
+static SDL_INLINE int get_triangle_step(const TriangleStep *step)
+{
+    return (int)(step->quotient + (step->quotient < 0 && step->remainder != 0));
+}
+
+// Narrow [x_start, x_end) to the pixels where the edge function w + x * step is non-negative
+#define TRIANGLE_CLIP_SPAN(W, STEP)                                         \
+    {                                                                       \
+        const Sint64 edge_w = (W);                                          \
+        const Sint64 edge_step = (STEP);                                    \
+        if (edge_step > 0) {                                                \
+            if (edge_w < 0) {                                               \
+                const Sint64 first = (-edge_w + edge_step - 1) / edge_step; \
+                if (first > x_start) {                                      \
+                    x_start = (int)SDL_min(first, (Sint64)x_end);           \
+                }                                                           \
+            }                                                               \
+        } else if (edge_step < 0) {                                         \
+            if (edge_w < 0) {                                               \
+                x_end = x_start;                                            \
+            } else {                                                        \
+                const Sint64 last = edge_w / -edge_step;                    \
+                if (last < x_end - 1) {                                     \
+                    x_end = (int)last + 1;                                  \
+                }                                                           \
+            }                                                               \
+        } else if (edge_w < 0) {                                            \
+            x_end = x_start;                                                \
+        }                                                                   \
+    }
+
+#define TRIANGLE_BEGIN_SPANS                             \
+    {                                                    \
+        int y;                                           \
+        for (y = 0; y < dstrect.h; y++) {                \
+            int x_start = 0;                             \
+            int x_end = dstrect.w;                       \
+            TRIANGLE_CLIP_SPAN(w0_row + bias_w0, d2d1_y) \
+            TRIANGLE_CLIP_SPAN(w1_row + bias_w1, d0d2_y) \
+            TRIANGLE_CLIP_SPAN(w2_row + bias_w2, d1d0_y) \
+            if (x_start < x_end) {
+
+#define TRIANGLE_END_SPANS        \
+            }                     \
+            /* y += 1 */          \
+            w0_row += d1d2_x;     \
+            w1_row += d2d0_x;     \
+            w2_row += d0d1_x;     \
+            dst_ptr += dst_pitch; \
+        }                         \
+    }
+
+#define TRIANGLE_BEGIN_LOOP                                      \
+    TRIANGLE_BEGIN_SPANS                                         \
+    /* Barycentric coordinates of the first pixel in the span */ \
+    const Sint64 w0 = w0_row + (Sint64)x_start * d2d1_y;         \
+    const Sint64 w1 = w1_row + (Sint64)x_start * d0d2_y;         \
+    const Sint64 w2 = w2_row + (Sint64)x_start * d1d0_y;         \
+    int x;                                                       \
+    (void)w0;                                                    \
+    (void)w1;                                                    \
+    (void)w2;                                                    \
+    for (x = x_start; x < x_end; x++) {                          \
+        Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
 // Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles
-#define TRIANGLE_GET_TEXTCOORD                                                          \
-    int srcx = (int)(((Sint64)w0 * s2s0_x + (Sint64)w1 * s2s1_x + s2_x_area.x) / area); \
-    int srcy = (int)(((Sint64)w0 * s2s0_y + (Sint64)w1 * s2s1_y + s2_x_area.y) / area); \
-    if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_CLAMP) {                          \
-        if (srcx < 0) {                                                                 \
-            srcx = 0;                                                                   \
-        } else if (srcx >= src_surface->w) {                                            \
-            srcx = src_surface->w - 1;                                                  \
-        }                                                                               \
-    } else if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_WRAP) {                    \
-        srcx %= src_surface->w;                                                         \
-        if (srcx < 0) {                                                                 \
-            srcx += (src_surface->w - 1);                                               \
-        }                                                                               \
-    }                                                                                   \
-    if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_CLAMP) {                          \
-        if (srcy < 0) {                                                                 \
-            srcy = 0;                                                                   \
-        } else if (srcy >= src_surface->h) {                                            \
-            srcy = src_surface->h - 1;                                                  \
-        }                                                                               \
-    } else if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_WRAP) {                    \
-        srcy %= src_surface->h;                                                         \
-        if (srcy < 0) {                                                                 \
-            srcy += (src_surface->h - 1);                                               \
-        }                                                                               \
-    }
-
-#define TRIANGLE_GET_MAPPED_COLOR                                                      \
-    Uint8 r = (Uint8)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    Uint8 g = (Uint8)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    Uint8 b = (Uint8)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    Uint8 a = (Uint8)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area); \
-    Uint32 color = SDL_MapRGBA(format, palette, r, g, b, a);
-
-#define TRIANGLE_GET_COLOR                                                             \
-    int r = (int)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    int g = (int)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    int b = (int)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    int a = (int)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area);
+#define TRIANGLE_GET_TEXTCOORD                                                    \
+    int srcx, srcy;                                                               \
+    if (x == x_start) {                                                           \
+        start_triangle_step(&step_srcx, w0 * s2s0_x + w1 * s2s1_x + s2_x_area.x); \
+        start_triangle_step(&step_srcy, w0 * s2s0_y + w1 * s2s1_y + s2_x_area.y); \
+    } else {                                                                      \
+        next_triangle_step(&step_srcx);                                           \
+        next_triangle_step(&step_srcy);                                           \
+    }                                                                             \
+    srcx = get_triangle_step(&step_srcx);                                         \
+    srcy = get_triangle_step(&step_srcy);                                         \
+    if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_CLAMP) {                    \
+        if (srcx < 0) {                                                           \
+            srcx = 0;                                                             \
+        } else if (srcx >= src_surface->w) {                                      \
+            srcx = src_surface->w - 1;                                            \
+        }                                                                         \
+    } else if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_WRAP) {              \
+        srcx %= src_surface->w;                                                   \
+        if (srcx < 0) {                                                           \
+            srcx += (src_surface->w - 1);                                         \
+        }                                                                         \
+    }                                                                             \
+    if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_CLAMP) {                    \
+        if (srcy < 0) {                                                           \
+            srcy = 0;                                                             \
+        } else if (srcy >= src_surface->h) {                                      \
+            srcy = src_surface->h - 1;                                            \
+        }                                                                         \
+    } else if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_WRAP) {              \
+        srcy %= src_surface->h;                                                   \
+        if (srcy < 0) {                                                           \
+            srcy += (src_surface->h - 1);                                         \
+        }                                                                         \
+    }
+
+#define TRIANGLE_SETUP_TEXTCOORD                                                              \
+    setup_triangle_step(&step_srcx, (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, area); \
+    setup_triangle_step(&step_srcy, (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, area);
+
+#define TRIANGLE_SETUP_COLOR                                                                                   \
+    setup_triangle_step(&step_r, (Sint64)d2d1_y * c0.r + (Sint64)d0d2_y * c1.r + (Sint64)d1d0_y * c2.r, area); \
+    setup_triangle_step(&step_g, (Sint64)d2d1_y * c0.g + (Sint64)d0d2_y * c1.g + (Sint64)d1d0_y * c2.g, area); \
+    setup_triangle_step(&step_b, (Sint64)d2d1_y * c0.b + (Sint64)d0d2_y * c1.b + (Sint64)d1d0_y * c2.b, area); \
+    setup_triangle_step(&step_a, (Sint64)d2d1_y * c0.a + (Sint64)d0d2_y * c1.a + (Sint64)d1d0_y * c2.a, area);
+
+#define TRIANGLE_STEP_COLOR                                              \
+    if (x == x_start) {                                                  \
+        start_triangle_step(&step_r, w0 * c0.r + w1 * c1.r + w2 * c2.r); \
+        start_triangle_step(&step_g, w0 * c0.g + w1 * c1.g + w2 * c2.g); \
+        start_triangle_step(&step_b, w0 * c0.b + w1 * c1.b + w2 * c2.b); \
+        start_triangle_step(&step_a, w0 * c0.a + w1 * c1.a + w2 * c2.a); \
+    } else {                                                             \
+        next_triangle_step(&step_r);                                     \
+        next_triangle_step(&step_g);                                     \
+        next_triangle_step(&step_b);                                     \
+        next_triangle_step(&step_a);                                     \
+    }
+
+#define TRIANGLE_GET_MAPPED_COLOR                                                              \
+    TRIANGLE_STEP_COLOR                                                                        \
+    Uint8 r = (Uint8)get_triangle_step(&step_r);                                               \
+    Uint8 g = (Uint8)get_triangle_step(&step_g);                                               \
+    Uint8 b = (Uint8)get_triangle_step(&step_b);                                               \
+    Uint8 a = (Uint8)get_triangle_step(&step_a);                                               \
+    Uint32 color = is_packed ? (((Uint32)(r >> r_loss) << format->Rshift) |                    \
+                                ((Uint32)(g >> g_loss) << format->Gshift) |                    \
+                                ((Uint32)(b >> b_loss) << format->Bshift) |                    \
+                                (((Uint32)(a >> a_loss) << format->Ashift) & format->Amask)) : \
+                               SDL_MapRGBA(format, palette, r, g, b, a);
+
+#define TRIANGLE_GET_COLOR              \
+    TRIANGLE_STEP_COLOR                 \
+    int r = get_triangle_step(&step_r); \
+    int g = get_triangle_step(&step_g); \
+    int b = get_triangle_step(&step_b); \
+    int a = get_triangle_step(&step_a);
 
 #define TRIANGLE_END_LOOP \
     }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
-    }                     \
-    /* y += 1 */          \
-    w0_row += d1d2_x;     \
-    w1_row += d2d0_x;     \
-    w2_row += d0d1_x;     \
-    dst_ptr += dst_pitch; \
-    }                     \
-    }
+    TRIANGLE_END_SPANS
 
 bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
 {
@@ -243,6 +370,7 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
     int d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x;
     Sint64 w0_row, w1_row, w2_row;
     int bias_w0, bias_w1, bias_w2;
+    TriangleStep step_r, step_g, step_b, step_a;
 
     bool is_uniform;
 
@@ -378,11 +506,11 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
         }
 
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPANS
             {
-                *(Uint32 *)dptr = color;
+                SDL_memset4((Uint8 *)dst_ptr + x_start * 4, color, x_end - x_start);
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPANS
         } else if (dstbpp == 3) {
             TRIANGLE_BEGIN_LOOP
             {
@@ -408,6 +536,8 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
     } else {
         const SDL_PixelFormatDetails *format;
         SDL_Palette *palette;
+        bool is_packed;
+        int r_loss, g_loss, b_loss, a_loss;
         if (tmp) {
             format = tmp->fmt;
             palette = tmp->palette;
@@ -415,6 +545,13 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             format = dst->fmt;
             palette = dst->palette;
         }
+        // Same as SDL_MapRGBA(), without a call per pixel
+        is_packed = !SDL_ISPIXELFORMAT_INDEXED(format->format) && !SDL_ISPIXELFORMAT_10BIT(format->format);
+        r_loss = 8 - format->Rbits;
+        g_loss = 8 - format->Gbits;
+        b_loss = 8 - format->Bbits;
+        a_loss = 8 - format->Abits;
+        TRIANGLE_SETUP_COLOR
         if (dstbpp == 4) {
             TRIANGLE_BEGIN_LOOP
             {
@@ -497,6 +634,7 @@ bool SDL_SW_BlitTriangle(
 
     Sint64 w0_row, w1_row, w2_row;
     int bias_w0, bias_w1, bias_w2;
+    TriangleStep step_srcx, step_srcy;
 
     bool is_uniform;
 
@@ -694,6 +832,7 @@ bool SDL_SW_BlitTriangle(
         goto end;
     }
 
+    TRIANGLE_SETUP_TEXTCOORD
     if (dstbpp == 4) {
         TRIANGLE_BEGIN_LOOP
         {
@@ -761,13 +900,21 @@ static int detect_format(const SDL_PixelFormatDetails *pf)
     }
 }
 
-static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
+// ARGB8888 and friends, the 32-bit formats with 8 bits per channel
+static bool is_8888_format(const SDL_PixelFormatDetails *pf)
+{
+    return pf->bytes_per_pixel == 4 && pf->Rbits == 8 && pf->Gbits == 8 && pf->Bbits == 8;
+}
+
+// The per-pixel work of SDL_BlitTriangle_Slow, inlined with constants for the common 8888 formats
+SDL_FORCE_INLINE void SDL_BlitTriangle_Slow_Pixels(SDL_BlitInfo *info,
                                   SDL_Point s2_x_area, SDL_Rect dstrect, int area, int bias_w0, int bias_w1, int bias_w2,
                                   int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
                                   int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, int w0_row, int w1_row, int w2_row,
                                   SDL_Color c0, SDL_Color c1, SDL_Color c2, bool is_uniform,
                                   SDL_TextureAddressMode texture_address_mode_u,
-                                  SDL_TextureAddressMode texture_address_mode_v)
+                                  SDL_TextureAddressMode texture_address_mode_v,
+                                  int srcbpp, int dstbpp, bool is_8888)
 {
     SDL_Surface *src_surface = info->src_surface;
     SDL_Palette *palette = src_surface->palette;
@@ -782,8 +929,6 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     Uint32 dstR, dstG, dstB, dstA;
     const SDL_PixelFormatDetails *src_fmt = info->src_fmt;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
-    int srcbpp = src_fmt->bytes_per_pixel;
-    int dstbpp = dst_fmt->bytes_per_pixel;
     int srcfmt_val;
     int dstfmt_val;
     Uint32 rgbmask = ~src_fmt->Amask;
@@ -791,6 +936,10 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
 
     Uint8 *dst_ptr = info->dst;
     int dst_pitch = info->dst_pitch;
+    TriangleStep step_srcx, step_srcy, step_r, step_g, step_b, step_a;
+
+    TRIANGLE_SETUP_TEXTCOORD
+    TRIANGLE_SETUP_COLOR
 
     srcfmt_val = detect_format(src_fmt);
     dstfmt_val = detect_format(dst_fmt);
@@ -800,8 +949,22 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
         Uint8 *src;
         Uint8 *dst = dptr;
         TRIANGLE_GET_TEXTCOORD
+        // Interpolated for every pixel, even the ones skipped by the colorkey
+        if (!is_uniform) {
+            TRIANGLE_GET_COLOR
+            modulateR = r;
+            modulateG = g;
+            modulateB = b;
+            modulateA = a;
+        }
         src = (info->src + (srcy * info->src_pitch) + (srcx * srcbpp));
-        if (FORMAT_INDEXED(srcfmt_val)) {
+        if (is_8888) {
+            srcpixel = *((Uint32 *)(src));
+            RGBA_FROM_8888(srcpixel, src_fmt, srcR, srcG, srcB, srcA);
+            if (FORMAT_HAS_NO_ALPHA(srcfmt_val)) {
+                srcA = 0xFF;
+            }
+        } else if (FORMAT_INDEXED(srcfmt_val)) {
             srcpixel = *src;
             const SDL_Color *color = &palette->colors[srcpixel];
             srcR = color->r;
@@ -829,7 +992,13 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
             }
         }
         if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL))) {
-            if (FORMAT_HAS_ALPHA(dstfmt_val)) {
+            if (is_8888) {
+                dstpixel = *((Uint32 *)(dst));
+                RGBA_FROM_8888(dstpixel, dst_fmt, dstR, dstG, dstB, dstA);
+                if (FORMAT_HAS_NO_ALPHA(dstfmt_val)) {
+                    dstA = 0xFF;
+                }
+            } else if (FORMAT_HAS_ALPHA(dstfmt_val)) {
                 DISEMBLE_RGBA(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG, dstB, dstA);
             } else if (FORMAT_HAS_NO_ALPHA(dstfmt_val)) {
                 DISEMBLE_RGB(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG, dstB);
@@ -844,14 +1013,6 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
             dstR = dstG = dstB = dstA = 0;
         }
 
-        if (!is_uniform) {
-            TRIANGLE_GET_COLOR
-            modulateR = r;
-            modulateG = g;
-            modulateB = b;
-            modulateA = a;
-        }
-
         if (flags & SDL_COPY_MODULATE_COLOR) {
             srcR = (srcR * modulateR) / 255;
             srcG = (srcG * modulateG) / 255;
@@ -929,4 +1090,28 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     TRIANGLE_END_LOOP
 }
 
+static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
+                                  SDL_Point s2_x_area, SDL_Rect dstrect, int area, int bias_w0, int bias_w1, int bias_w2,
+                                  int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
+                                  int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, int w0_row, int w1_row, int w2_row,
+                                  SDL_Color c0, SDL_Color c1, SDL_Color c2, bool is_uniform,
+                                  SDL_TextureAddressMode texture_address_mode_u,
+                                  SDL_TextureAddressMode texture_address_mode_v)
+{
+    const int srcbpp = info->src_fmt->bytes_per_pixel;
+    const int dstbpp = info->dst_fmt->bytes_per_pixel;
+
+    if (is_8888_format(info->src_fmt) && is_8888_format(info->dst_fmt)) {
+        SDL_BlitTriangle_Slow_Pixels(info, s2_x_area, dstrect, area, bias_w0, bias_w1, bias_w2,
+                                     d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                     s2s0_x, s2s1_x, s2s0_y, s2s1_y, w0_row, w1_row, w2_row,
+                                     c0, c1, c2, is_uniform, texture_address_mode_u, texture_address_mode_v, 4, 4, true);
+    } else {
+        SDL_BlitTriangle_Slow_Pixels(info, s2_x_area, dstrect, area, bias_w0, bias_w1, bias_w2,
+                                     d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                     s2s0_x, s2s1_x, s2s0_y, s2s1_y, w0_row, w1_row, w2_row,
+                                     c0, c1, c2, is_uniform, texture_address_mode_u, texture_address_mode_v, srcbpp, dstbpp, false);
+    }
+}
+
 #endif // SDL_VIDEO_RENDER_SW
@@ -23,10 +23,12 @@
 
 #include "SDL_sysstorage.h"
 #include "../filesystem/SDL_sysfilesystem.h"
+#include "../io/SDL_asyncio_c.h"
 
 // Available title storage drivers
 static TitleStorageBootStrap *titlebootstrap[] = {
     &GENERIC_titlebootstrap,
+    &PACK_titlebootstrap,  // never picked by default, since generic always works. Select it with SDL_HINT_STORAGE_TITLE_DRIVER.
     NULL
 };
 
@@ -45,6 +47,7 @@ static UserStorageBootStrap *userbootstrap[] = {
 struct SDL_Storage
 {
     SDL_StorageInterface iface;
+    const SDL_StorageAsyncInterface *async_iface;
     void *userdata;
 };
 
@@ -179,6 +182,11 @@ SDL_Storage *SDL_OpenFileStorage(const char *path)
     return GENERIC_OpenFileStorage(path);
 }
 
+SDL_Storage *SDL_OpenPackStorage(const char *path)
+{
+    return PACK_OpenStorage(path);
+}
+
 SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
 {
     SDL_Storage *storage;
@@ -201,6 +209,13 @@ SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
     return storage;
 }
 
+void SDL_SetStorageAsyncInterface(SDL_Storage *storage, const SDL_StorageAsyncInterface *iface)
+{
+    if (storage) {
+        storage->async_iface = iface;
+    }
+}
+
 bool SDL_CloseStorage(SDL_Storage *storage)
 {
     bool result = true;
@@ -283,6 +298,81 @@ bool SDL_WriteStorageFile(SDL_Storage *storage, const char *path, const void *so
     return storage->iface.write_file(storage->userdata, path, source, length);
 }
 
+bool SDL_ReadStorageFileAsync(SDL_Storage *storage, const char *path, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_STORAGE_MAGIC()
+
+    CHECK_PARAM(!path) {
+        return SDL_InvalidParamError("path");
+    }
+    CHECK_PARAM(!ValidateStoragePath(path)) {
+        return false;
+    }
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    if (storage->async_iface && storage->async_iface->read_file) {
+        return storage->async_iface->read_file(storage->userdata, path, queue, userdata);
+    }
+
+    if (!storage->iface.read_file) {
+        return SDL_Unsupported();
+    }
+
+    // The backend can only do this synchronously, so do it now and just deliver the result through the queue.
+    Uint64 length = 0;
+    if (!SDL_GetStorageFileSize(storage, path, &length)) {
+        return false;
+    }
+    if (length >= SDL_SIZE_MAX) {
+        return SDL_OutOfMemory();  // it won't fit in the address space, with room for the null-terminator.
+    }
+    Uint8 *ptr = (Uint8 *) SDL_malloc((size_t) (length + 1));  // over-allocate by one so we can add a null-terminator, like SDL_LoadFileAsync.
+    if (!ptr) {
+        return false;
+    }
+    ptr[length] = '\0';
+    if (!storage->iface.read_file(storage->userdata, path, ptr, length) ||
+        !SDL_InternalQueueAsyncIOResult(queue, SDL_ASYNCIO_TASK_READ, SDL_ASYNCIO_COMPLETE, ptr, length, length, userdata)) {
+        SDL_free(ptr);
+        return false;
+    }
+    return true;
+}
+
+bool SDL_WriteStorageFileAsync(SDL_Storage *storage, const char *path, const void *source, Uint64 length, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_STORAGE_MAGIC()
+
+    CHECK_PARAM(!path) {
+        return SDL_InvalidParamError("path");
+    }
+    CHECK_PARAM(!ValidateStoragePath(path)) {
+        return false;
+    }
+    CHECK_PARAM(length > 0 && !source) {
+        return SDL_InvalidParamError("source");
+    }
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    if (storage->async_iface && storage->async_iface->write_file) {
+        return storage->async_iface->write_file(storage->userdata, path, source, length, queue, userdata);
+    }
+
+    if (!storage->iface.write_file) {
+        return SDL_Unsupported();
+    }
+
+    // The backend can only do this synchronously, so do it now and just deliver the result through the queue.
+    if (!storage->iface.write_file(storage->userdata, path, source, length)) {
+        return false;
+    }
+    return SDL_InternalQueueAsyncIOResult(queue, SDL_ASYNCIO_TASK_WRITE, SDL_ASYNCIO_COMPLETE, (void *) source, length, length, userdata);
+}
+
 bool SDL_CreateStorageDirectory(SDL_Storage *storage, const char *path)
 {
     CHECK_STORAGE_MAGIC()
@@ -446,3 +536,18 @@ char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const ch
     return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobStorageDirectoryEnumerator, GlobStorageDirectoryGetPathInfo, storage);
 }
 
+
+SDL_DirectoryCache *SDL_CreateStorageDirectoryCache(SDL_Storage *storage, const char *path)
+{
+    CHECK_STORAGE_MAGIC_RET(NULL)
+
+    if (!path) {
+        path = "";  // we allow NULL to mean "root of the storage tree".
+    }
+
+    if (!ValidateStoragePath(path)) {
+        return NULL;
+    }
+
+    return SDL_InternalCreateDirectoryCache(path, GlobStorageDirectoryEnumerator, GlobStorageDirectoryGetPathInfo, storage, false);
+}
@@ -38,9 +38,22 @@ typedef struct UserStorageBootStrap
     SDL_Storage *(*create)(const char *, const char *, SDL_PropertiesID);
 } UserStorageBootStrap;
 
+// Optional asynchronous versions of SDL_StorageInterface functions, for backends
+// that can hand the work to SDL_AsyncIO. Without these, the synchronous versions
+// are called and their results are delivered to the queue right away.
+typedef struct SDL_StorageAsyncInterface
+{
+    bool (*read_file)(void *userdata, const char *path, SDL_AsyncIOQueue *queue, void *app_userdata);
+    bool (*write_file)(void *userdata, const char *path, const void *source, Uint64 length, SDL_AsyncIOQueue *queue, void *app_userdata);
+} SDL_StorageAsyncInterface;
+
+// Call this right after SDL_OpenStorage; `iface` must stay valid until the storage is closed.
+extern void SDL_SetStorageAsyncInterface(SDL_Storage *storage, const SDL_StorageAsyncInterface *iface);
+
 // Not all of these are available in a given build. Use #ifdefs, etc.
 
 extern TitleStorageBootStrap GENERIC_titlebootstrap;
+extern TitleStorageBootStrap PACK_titlebootstrap;
 // Steam does not have title storage APIs
 
 extern UserStorageBootStrap GENERIC_userbootstrap;
@@ -48,5 +61,6 @@ extern UserStorageBootStrap PRIVATE_userbootstrap;
 extern UserStorageBootStrap STEAM_userbootstrap;
 
 extern SDL_Storage *GENERIC_OpenFileStorage(const char *path);
+extern SDL_Storage *PACK_OpenStorage(const char *path);
 
 #endif // SDL_sysstorage_h_
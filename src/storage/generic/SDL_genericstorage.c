@@ -22,6 +22,7 @@
 #include "SDL_internal.h"
 
 #include "../SDL_sysstorage.h"
+#include "../../io/SDL_asyncio_c.h"
 
 
 static char *GENERIC_INTERNAL_CreateFullPath(const char *base, const char *relative)
@@ -166,6 +167,30 @@ static bool GENERIC_WriteStorageFile(void *userdata, const char *path, const voi
     return result;
 }
 
+static bool GENERIC_ReadStorageFileAsync(void *userdata, const char *path, SDL_AsyncIOQueue *queue, void *app_userdata)
+{
+    bool result = false;
+
+    char *fullpath = GENERIC_INTERNAL_CreateFullPath((char *)userdata, path);
+    if (fullpath) {
+        result = SDL_LoadFileAsync(fullpath, queue, app_userdata);
+        SDL_free(fullpath);
+    }
+    return result;
+}
+
+static bool GENERIC_WriteStorageFileAsync(void *userdata, const char *path, const void *source, Uint64 length, SDL_AsyncIOQueue *queue, void *app_userdata)
+{
+    bool result = false;
+
+    char *fullpath = GENERIC_INTERNAL_CreateFullPath((char *)userdata, path);
+    if (fullpath) {
+        result = SDL_InternalSaveFileAsync(fullpath, source, length, queue, app_userdata);
+        SDL_free(fullpath);
+    }
+    return result;
+}
+
 static bool GENERIC_CreateStorageDirectory(void *userdata, const char *path)
 {
     // TODO: Recursively create subdirectories with SDL_CreateDirectory
@@ -244,6 +269,11 @@ static const SDL_StorageInterface GENERIC_title_iface = {
     NULL    // space_remaining
 };
 
+static const SDL_StorageAsyncInterface GENERIC_title_async_iface = {
+    GENERIC_ReadStorageFileAsync,
+    NULL    // write_file
+};
+
 static SDL_Storage *GENERIC_Title_Create(const char *override, SDL_PropertiesID props)
 {
     SDL_Storage *result = NULL;
@@ -270,6 +300,8 @@ static SDL_Storage *GENERIC_Title_Create(const char *override, SDL_PropertiesID
         result = SDL_OpenStorage(&GENERIC_title_iface, basepath);
         if (result == NULL) {
             SDL_free(basepath);  // otherwise CloseStorage will free it.
+        } else {
+            SDL_SetStorageAsyncInterface(result, &GENERIC_title_async_iface);
         }
     }
 
@@ -297,6 +329,11 @@ static const SDL_StorageInterface GENERIC_user_iface = {
     GENERIC_GetStorageSpaceRemaining
 };
 
+static const SDL_StorageAsyncInterface GENERIC_async_iface = {
+    GENERIC_ReadStorageFileAsync,
+    GENERIC_WriteStorageFileAsync
+};
+
 static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_PropertiesID props)
 {
     SDL_Storage *result;
@@ -308,6 +345,8 @@ static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_Pr
     result = SDL_OpenStorage(&GENERIC_user_iface, prefpath);
     if (result == NULL) {
         SDL_free(prefpath);  // otherwise CloseStorage will free it.
+    } else {
+        SDL_SetStorageAsyncInterface(result, &GENERIC_async_iface);
     }
     return result;
 }
@@ -403,6 +442,8 @@ SDL_Storage *GENERIC_OpenFileStorage(const char *path)
     result = SDL_OpenStorage(&GENERIC_file_iface, basepath);
     if (result == NULL) {
         SDL_free(basepath);
+    } else {
+        SDL_SetStorageAsyncInterface(result, &GENERIC_async_iface);
     }
     return result;
 }
@@ -0,0 +1,621 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_internal.h"
+
+#include "../SDL_sysstorage.h"
+
+// Read-only storage served out of a single .zip archive. The central directory
+// is read once when the storage is opened and turned into a sorted index, so
+// looking up, enumerating and globbing paths never touches the OS, and reading
+// a file is a seek and a read (plus inflating it) on the one open archive.
+
+#define MZ_ASSERT(x) SDL_assert(x)
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define MINIZ_LITTLE_ENDIAN 1
+#else
+#define MINIZ_LITTLE_ENDIAN 0
+#endif
+#define MINIZ_USE_UNALIGNED_LOADS_AND_STORES 0
+#define MINIZ_SDL_NOUNUSED
+#define MINIZ_SDL_INFLATE_ONLY
+#include "../../video/miniz.h"
+
+#define ZIP_LOCAL_HEADER_SIGNATURE     0x04034b50
+#define ZIP_CENTRAL_HEADER_SIGNATURE   0x02014b50
+#define ZIP_END_SIGNATURE              0x06054b50
+#define ZIP64_END_SIGNATURE            0x06064b50
+#define ZIP64_END_LOCATOR_SIGNATURE    0x07064b50
+#define ZIP_LOCAL_HEADER_SIZE          30
+#define ZIP_CENTRAL_HEADER_SIZE        46
+#define ZIP_END_SIZE                   22
+#define ZIP64_END_LOCATOR_SIZE         20
+#define ZIP64_END_SIZE                 56
+#define ZIP_MAX_COMMENT                0xFFFF
+
+#define ZIP_METHOD_STORED   0
+#define ZIP_METHOD_DEFLATED 8
+
+typedef struct PackEntry
+{
+    const char *name;     // not null-terminated, points into PackStorage::names
+    size_t namelen;
+    Uint64 offset;        // of the local file header
+    Uint64 compressed_size;
+    Uint64 size;
+    Uint32 crc32;
+    Uint16 method;
+    bool directory;
+    SDL_Time modify_time;
+} PackEntry;
+
+typedef struct PackStorage
+{
+    SDL_Mutex *lock;  // protects io
+    SDL_IOStream *io;
+    char *names;
+    PackEntry *entries;
+    int num_entries;
+} PackStorage;
+
+static Uint16 ReadLE16(const Uint8 *ptr)
+{
+    return (Uint16)(ptr[0] | (ptr[1] << 8));
+}
+
+static Uint32 ReadLE32(const Uint8 *ptr)
+{
+    return (Uint32)ptr[0] | ((Uint32)ptr[1] << 8) | ((Uint32)ptr[2] << 16) | ((Uint32)ptr[3] << 24);
+}
+
+static Uint64 ReadLE64(const Uint8 *ptr)
+{
+    return (Uint64)ReadLE32(ptr) | ((Uint64)ReadLE32(ptr + 4) << 32);
+}
+
+static bool ReadAt(SDL_IOStream *io, Uint64 offset, void *buffer, size_t size)
+{
+    if (SDL_SeekIO(io, (Sint64)offset, SDL_IO_SEEK_SET) < 0) {
+        return false;
+    }
+    if (SDL_ReadIO(io, buffer, size) != size) {
+        return SDL_SetError("Unexpected end of archive");
+    }
+    return true;
+}
+
+static SDL_Time DosTimeToTime(Uint16 dos_time, Uint16 dos_date)
+{
+    SDL_DateTime dt;
+    SDL_Time result = 0;
+
+    SDL_zero(dt);
+    dt.year = 1980 + ((dos_date >> 9) & 0x7F);
+    dt.month = SDL_max((dos_date >> 5) & 0x0F, 1);
+    dt.day = SDL_max(dos_date & 0x1F, 1);
+    dt.hour = (dos_time >> 11) & 0x1F;
+    dt.minute = (dos_time >> 5) & 0x3F;
+    dt.second = (dos_time & 0x1F) * 2;
+    SDL_DateTimeToTime(&dt, &result);
+    return result;
+}
+
+static int ComparePackNames(const char *a, size_t alen, const char *b, size_t blen)
+{
+    const int result = SDL_memcmp(a, b, SDL_min(alen, blen));
+    if (result != 0) {
+        return result;
+    }
+    return (alen < blen) ? -1 : (alen > blen) ? 1 : 0;
+}
+
+static int SDLCALL ComparePackEntries(const void *a, const void *b)
+{
+    const PackEntry *A = (const PackEntry *)a;
+    const PackEntry *B = (const PackEntry *)b;
+    const int result = ComparePackNames(A->name, A->namelen, B->name, B->namelen);
+    if (result != 0) {
+        return result;
+    }
+    // If a name is both a file and a directory, keep the directory so its children stay reachable.
+    return (int)B->directory - (int)A->directory;
+}
+
+// Returns the index of the first entry that isn't less than name.
+static int FindPackEntry(const PackStorage *pack, const char *name, size_t namelen)
+{
+    int lo = 0, hi = pack->num_entries;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        const PackEntry *entry = &pack->entries[mid];
+        if (ComparePackNames(entry->name, entry->namelen, name, namelen) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static bool HasChar(const char *str, size_t len, char ch)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (str[i] == ch) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t TrimPath(const char *path)
+{
+    size_t len = SDL_strlen(path);
+    while (len > 0 && path[len - 1] == '/') {
+        --len;
+    }
+    return len;
+}
+
+static const PackEntry *LookupPackEntry(const PackStorage *pack, const char *path)
+{
+    const size_t len = TrimPath(path);
+    const int i = FindPackEntry(pack, path, len);
+    if (i < pack->num_entries && ComparePackNames(pack->entries[i].name, pack->entries[i].namelen, path, len) == 0) {
+        return &pack->entries[i];
+    }
+    return NULL;
+}
+
+static bool ReadZip64Extra(const Uint8 *extra, size_t extra_len, Uint64 *size, Uint64 *compressed_size, Uint64 *offset)
+{
+    while (extra_len >= 4) {
+        const Uint16 id = ReadLE16(extra);
+        const Uint16 len = ReadLE16(extra + 2);
+        if ((size_t)len + 4 > extra_len) {
+            break;
+        }
+        if (id == 0x0001) {
+            // Only the fields that overflowed in the central header are present, in this order.
+            const Uint8 *field = extra + 4;
+            const Uint8 *end = field + len;
+            if (*size == 0xFFFFFFFF) {
+                if (field + 8 > end) {
+                    return false;
+                }
+                *size = ReadLE64(field);
+                field += 8;
+            }
+            if (*compressed_size == 0xFFFFFFFF) {
+                if (field + 8 > end) {
+                    return false;
+                }
+                *compressed_size = ReadLE64(field);
+                field += 8;
+            }
+            if (*offset == 0xFFFFFFFF) {
+                if (field + 8 > end) {
+                    return false;
+                }
+                *offset = ReadLE64(field);
+            }
+            return true;
+        }
+        extra += len + 4;
+        extra_len -= len + 4;
+    }
+    return true;
+}
+
+static bool FindCentralDirectory(SDL_IOStream *io, Uint64 *cd_offset, Uint64 *cd_size, Uint64 *cd_entries)
+{
+    const Sint64 archive_size = SDL_GetIOSize(io);
+    if (archive_size < ZIP_END_SIZE) {
+        return SDL_SetError("Not a zip archive");
+    }
+
+    // The end of central directory record is at the end of the file, followed by a comment of up to 64K.
+    const size_t tail_size = (size_t)SDL_min(archive_size, ZIP_END_SIZE + ZIP_MAX_COMMENT);
+    const Uint64 tail_offset = (Uint64)archive_size - tail_size;
+    Uint8 *tail = (Uint8 *)SDL_malloc(tail_size);
+    if (!tail) {
+        return false;
+    }
+    if (!ReadAt(io, tail_offset, tail, tail_size)) {
+        SDL_free(tail);
+        return false;
+    }
+
+    const Uint8 *end = NULL;
+    for (size_t i = tail_size - ZIP_END_SIZE + 1; i-- > 0; ) {
+        if (ReadLE32(tail + i) == ZIP_END_SIGNATURE) {
+            end = tail + i;
+            break;
+        }
+    }
+    if (!end) {
+        SDL_free(tail);
+        return SDL_SetError("Not a zip archive");
+    }
+
+    *cd_entries = ReadLE16(end + 10);
+    *cd_size = ReadLE32(end + 12);
+    *cd_offset = ReadLE32(end + 16);
+
+    if (*cd_entries == 0xFFFF || *cd_size == 0xFFFFFFFF || *cd_offset == 0xFFFFFFFF) {
+        const Uint64 end_offset = tail_offset + (Uint64)(end - tail);
+        Uint8 locator[ZIP64_END_LOCATOR_SIZE];
+        Uint8 end64[ZIP64_END_SIZE];
+
+        if (end_offset < ZIP64_END_LOCATOR_SIZE ||
+            !ReadAt(io, end_offset - ZIP64_END_LOCATOR_SIZE, locator, sizeof(locator)) ||
+            ReadLE32(locator) != ZIP64_END_LOCATOR_SIGNATURE ||
+            !ReadAt(io, ReadLE64(locator + 8), end64, sizeof(end64)) ||
+            ReadLE32(end64) != ZIP64_END_SIGNATURE) {
+            SDL_free(tail);
+            return SDL_SetError("Corrupt zip64 archive");
+        }
+        *cd_entries = ReadLE64(end64 + 32);
+        *cd_size = ReadLE64(end64 + 40);
+        *cd_offset = ReadLE64(end64 + 48);
+    }
+    SDL_free(tail);
+
+    if (*cd_offset + *cd_size > (Uint64)archive_size || *cd_size > SDL_SIZE_MAX ||
+        *cd_entries > (Uint64)(SDL_MAX_SINT32 / 2)) {
+        return SDL_SetError("Corrupt zip archive");
+    }
+    return true;
+}
+
+static bool LoadPackIndex(PackStorage *pack)
+{
+    Uint64 cd_offset = 0, cd_size = 0, cd_entries = 0;
+    if (!FindCentralDirectory(pack->io, &cd_offset, &cd_size, &cd_entries)) {
+        return false;
+    }
+
+    // Keep the central directory around as the storage for the names; we only need them, but this saves 40K little allocations.
+    Uint8 *cd = (Uint8 *)SDL_malloc((size_t)cd_size + 1);
+    if (!cd) {
+        return false;
+    }
+    pack->names = (char *)cd;
+    if (!ReadAt(pack->io, cd_offset, cd, (size_t)cd_size)) {
+        return false;
+    }
+
+    // Every file can add a made-up entry for each directory above it, so count those as we go.
+    int max_entries = (int)cd_entries;
+    const Uint8 *ptr = cd;
+    const Uint8 *cd_end = cd + cd_size;
+    for (Uint64 i = 0; i < cd_entries; ++i) {
+        if (ptr + ZIP_CENTRAL_HEADER_SIZE > cd_end || ReadLE32(ptr) != ZIP_CENTRAL_HEADER_SIGNATURE) {
+            return SDL_SetError("Corrupt zip central directory");
+        }
+        const size_t name_len = ReadLE16(ptr + 28);
+        const size_t entry_len = ZIP_CENTRAL_HEADER_SIZE + name_len + ReadLE16(ptr + 30) + ReadLE16(ptr + 32);
+        if (ptr + entry_len > cd_end) {
+            return SDL_SetError("Corrupt zip central directory");
+        }
+        for (size_t j = 0; j + 1 < name_len; ++j) {
+            if (ptr[ZIP_CENTRAL_HEADER_SIZE + j] == '/') {
+                if (max_entries == SDL_MAX_SINT32) {
+                    return SDL_SetError("Too many entries in zip archive");
+                }
+                ++max_entries;
+            }
+        }
+        ptr += entry_len;
+    }
+
+    pack->entries = (PackEntry *)SDL_calloc(SDL_max(max_entries, 1), sizeof(*pack->entries));
+    if (!pack->entries) {
+        return false;
+    }
+
+    int num_entries = 0;
+    ptr = cd;
+    for (Uint64 i = 0; i < cd_entries; ++i) {
+        const Uint16 method = ReadLE16(ptr + 10);
+        const Uint16 dos_time = ReadLE16(ptr + 12);
+        const Uint16 dos_date = ReadLE16(ptr + 14);
+        const Uint32 crc32 = ReadLE32(ptr + 16);
+        Uint64 compressed_size = ReadLE32(ptr + 20);
+        Uint64 size = ReadLE32(ptr + 24);
+        const size_t name_len = ReadLE16(ptr + 28);
+        const size_t extra_len = ReadLE16(ptr + 30);
+        const size_t comment_len = ReadLE16(ptr + 32);
+        Uint64 offset = ReadLE32(ptr + 42);
+        const char *name = (const char *)ptr + ZIP_CENTRAL_HEADER_SIZE;
+
+        if (!ReadZip64Extra(ptr + ZIP_CENTRAL_HEADER_SIZE + name_len, extra_len, &size, &compressed_size, &offset)) {
+            return SDL_SetError("Corrupt zip64 extra field");
+        }
+        ptr += ZIP_CENTRAL_HEADER_SIZE + name_len + extra_len + comment_len;
+
+        // Storage paths are relative and always use '/', skip anything that couldn't be asked for.
+        size_t len = name_len;
+        while (len > 0 && name[0] == '/') {
+            ++name;
+            --len;
+        }
+        const bool directory = (len > 0 && name[len - 1] == '/');
+        while (len > 0 && name[len - 1] == '/') {
+            --len;
+        }
+        if (len == 0 || HasChar(name, len, '\\') || HasChar(name, len, '\0')) {
+            continue;
+        }
+
+        PackEntry *entry = &pack->entries[num_entries++];
+        entry->name = name;
+        entry->namelen = len;
+        entry->offset = offset;
+        entry->compressed_size = compressed_size;
+        entry->size = directory ? 0 : size;
+        entry->crc32 = crc32;
+        entry->method = method;
+        entry->directory = directory;
+        entry->modify_time = DosTimeToTime(dos_time, dos_date);
+
+        // Archives don't have to list directories, so make sure every parent exists.
+        for (size_t j = len; j-- > 0; ) {
+            if (name[j] == '/') {
+                PackEntry *parent = &pack->entries[num_entries++];
+                SDL_zerop(parent);
+                parent->name = name;
+                parent->namelen = j;
+                parent->directory = true;
+                parent->modify_time = entry->modify_time;
+            }
+        }
+    }
+
+    SDL_qsort(pack->entries, num_entries, sizeof(*pack->entries), ComparePackEntries);
+
+    // Drop duplicates, mostly the made-up directories.
+    int unique = 0;
+    for (int i = 0; i < num_entries; ++i) {
+        if (unique > 0) {
+            const PackEntry *prev = &pack->entries[unique - 1];
+            if (ComparePackNames(prev->name, prev->namelen, pack->entries[i].name, pack->entries[i].namelen) == 0) {
+                continue;
+            }
+        }
+        pack->entries[unique++] = pack->entries[i];
+    }
+    pack->num_entries = unique;
+    return true;
+}
+
+static bool PACK_CloseStorage(void *userdata)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    bool result = true;
+    if (pack->io) {
+        result = SDL_CloseIO(pack->io);
+    }
+    SDL_DestroyMutex(pack->lock);
+    SDL_free(pack->entries);
+    SDL_free(pack->names);
+    SDL_free(pack);
+    return result;
+}
+
+static bool PACK_EnumerateStorageDirectory(void *userdata, const char *path, SDL_EnumerateDirectoryCallback callback, void *callback_userdata)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+    const size_t pathlen = TrimPath(path);
+    char *dirname = NULL;
+    char *fname = NULL;
+    size_t fname_size = 0;
+    int i;
+
+    if (pathlen > 0) {
+        const PackEntry *entry = LookupPackEntry(pack, path);
+        if (!entry) {
+            return SDL_SetError("Can't open directory %s", path);
+        } else if (!entry->directory) {
+            return SDL_SetError("%s is not a directory", path);
+        }
+    }
+
+    dirname = (char *)SDL_malloc(pathlen + 2);
+    if (!dirname) {
+        return false;
+    }
+    SDL_memcpy(dirname, path, pathlen);
+    dirname[pathlen] = '/';
+    dirname[pathlen + 1] = '\0';
+    const size_t prefixlen = pathlen ? (pathlen + 1) : 0;
+    if (!prefixlen) {
+        dirname[0] = '\0';  // the root is enumerated as "".
+    }
+
+    // Everything under the directory is together in the sorted index, its children are the ones without another '/'.
+    SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
+    for (i = FindPackEntry(pack, dirname, prefixlen); (i < pack->num_entries) && (result == SDL_ENUM_CONTINUE); ++i) {
+        const PackEntry *entry = &pack->entries[i];
+        if (entry->namelen <= prefixlen || SDL_memcmp(entry->name, dirname, prefixlen) != 0) {
+            break;
+        }
+
+        const char *child = entry->name + prefixlen;
+        const size_t childlen = entry->namelen - prefixlen;
+        if (HasChar(child, childlen, '/')) {
+            continue;
+        }
+
+        if (childlen + 1 > fname_size) {
+            char *ptr = (char *)SDL_realloc(fname, childlen + 1);
+            if (!ptr) {
+                result = SDL_ENUM_FAILURE;
+                break;
+            }
+            fname = ptr;
+            fname_size = childlen + 1;
+        }
+        SDL_memcpy(fname, child, childlen);
+        fname[childlen] = '\0';
+
+        result = callback(callback_userdata, dirname, fname);
+    }
+
+    SDL_free(fname);
+    SDL_free(dirname);
+    return (result != SDL_ENUM_FAILURE);
+}
+
+static bool PACK_GetStoragePathInfo(void *userdata, const char *path, SDL_PathInfo *info)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+
+    if (TrimPath(path) == 0) {
+        info->type = SDL_PATHTYPE_DIRECTORY;
+        return true;
+    }
+
+    const PackEntry *entry = LookupPackEntry(pack, path);
+    if (!entry) {
+        return SDL_SetError("Can't stat %s", path);
+    }
+    info->type = entry->directory ? SDL_PATHTYPE_DIRECTORY : SDL_PATHTYPE_FILE;
+    info->size = entry->size;
+    info->create_time = entry->modify_time;
+    info->modify_time = entry->modify_time;
+    info->access_time = entry->modify_time;
+    return true;
+}
+
+static bool PACK_ReadStorageFile(void *userdata, const char *path, void *destination, Uint64 length)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    Uint8 header[ZIP_LOCAL_HEADER_SIZE];
+    void *compressed = NULL;
+    bool result = false;
+
+    const PackEntry *entry = LookupPackEntry(pack, path);
+    if (!entry) {
+        return SDL_SetError("Couldn't open %s", path);
+    } else if (entry->directory) {
+        return SDL_SetError("%s is a directory", path);
+    } else if (length != entry->size) {
+        return SDL_SetError("File length did not exactly match the destination length");
+    } else if (entry->method != ZIP_METHOD_STORED && entry->method != ZIP_METHOD_DEFLATED) {
+        return SDL_SetError("Unsupported compression method %d for %s", (int)entry->method, path);
+    } else if (entry->compressed_size > SDL_SIZE_MAX) {
+        return SDL_SetError("Read size exceeds SDL_SIZE_MAX");
+    }
+
+    if (entry->method == ZIP_METHOD_DEFLATED) {
+        compressed = SDL_malloc(SDL_max((size_t)entry->compressed_size, 1));
+        if (!compressed) {
+            return false;
+        }
+    }
+
+    SDL_LockMutex(pack->lock);
+    if (ReadAt(pack->io, entry->offset, header, sizeof(header))) {
+        if (ReadLE32(header) != ZIP_LOCAL_HEADER_SIGNATURE) {
+            SDL_SetError("Corrupt zip local header for %s", path);
+        } else {
+            const Uint64 data_offset = entry->offset + ZIP_LOCAL_HEADER_SIZE + ReadLE16(header + 26) + ReadLE16(header + 28);
+            if (compressed) {
+                result = ReadAt(pack->io, data_offset, compressed, (size_t)entry->compressed_size);
+            } else if (length > 0) {
+                result = ReadAt(pack->io, data_offset, destination, (size_t)length);
+            } else {
+                result = true;
+            }
+        }
+    }
+    SDL_UnlockMutex(pack->lock);
+
+    if (result && compressed) {
+        const size_t inflated = tinfl_decompress_mem_to_mem(destination, (size_t)length, compressed, (size_t)entry->compressed_size, TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+        if (inflated != length) {
+            result = SDL_SetError("Couldn't decompress %s", path);
+        }
+    }
+    SDL_free(compressed);
+
+    if (result && mz_crc32(MZ_CRC32_INIT, (const unsigned char *)destination, (size_t)length) != entry->crc32) {
+        result = SDL_SetError("Checksum mismatch for %s", path);
+    }
+    return result;
+}
+
+static const SDL_StorageInterface PACK_iface = {
+    sizeof(SDL_StorageInterface),
+    PACK_CloseStorage,
+    NULL,   // ready
+    PACK_EnumerateStorageDirectory,
+    PACK_GetStoragePathInfo,
+    PACK_ReadStorageFile,
+    NULL,   // write_file
+    NULL,   // mkdir
+    NULL,   // remove
+    NULL,   // rename
+    NULL,   // copy
+    NULL    // space_remaining
+};
+
+SDL_Storage *PACK_OpenStorage(const char *path)
+{
+    SDL_Storage *result = NULL;
+
+    CHECK_PARAM(!path || !*path) {
+        SDL_InvalidParamError("path");
+        return NULL;
+    }
+
+    PackStorage *pack = (PackStorage *)SDL_calloc(1, sizeof(*pack));
+    if (!pack) {
+        return NULL;
+    }
+
+    pack->lock = SDL_CreateMutex();
+    if (pack->lock) {
+        pack->io = SDL_IOFromFile(path, "rb");
+    }
+    if (pack->io && LoadPackIndex(pack)) {
+        result = SDL_OpenStorage(&PACK_iface, pack);
+    }
+    if (!result) {
+        PACK_CloseStorage(pack);
+    }
+    return result;
+}
+
+static SDL_Storage *PACK_Title_Create(const char *override, SDL_PropertiesID props)
+{
+    if (!override || !*override) {
+        SDL_SetError("The pack title storage driver needs the path to an archive");
+        return NULL;
+    }
+    return PACK_OpenStorage(override);
+}
+
+TitleStorageBootStrap PACK_titlebootstrap = {
+    "pack",
+    "SDL pack file title storage driver",
+    PACK_Title_Create
+};
@@ -0,0 +1,432 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_thread_c.h"
+
+// A work-stealing job pool.
+//
+// Every worker thread owns a queue. A worker pushes and pops jobs at the
+// tail of its own queue, so recently submitted (and likely cache-hot) work
+// runs first, and when it runs dry it steals the oldest job from the head
+// of another worker's queue. Jobs submitted from outside the pool are spread
+// round-robin across the queues. Each queue is a small ring protected by a
+// spinlock; contention is limited to a thief and the owner meeting on the
+// same queue.
+//
+// Idle workers and threads waiting on a group all sleep on the pool
+// condition, so a new job or a finished group wakes whichever is needed.
+
+#define SDL_JOB_QUEUE_INITIAL_SIZE 64
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction fn;
+    void *userdata;
+    SDL_JobGroup *group;
+} SDL_Job;
+
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_Job *jobs;
+    Uint32 mask;
+    Uint32 head;
+    Uint32 tail;
+} SDL_JobQueue;
+
+typedef struct SDL_JobWorker
+{
+    SDL_JobPool *pool;
+    int index;
+    SDL_Thread *thread;
+} SDL_JobWorker;
+
+struct SDL_JobPool
+{
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+    SDL_AtomicInt queued;
+    SDL_AtomicInt sleepers;
+    SDL_AtomicInt next_queue;
+    SDL_AtomicInt shutdown;
+    int num_queues;
+    SDL_JobQueue *queues;
+    int num_threads;
+    SDL_JobWorker *workers;
+};
+
+struct SDL_JobGroup
+{
+    SDL_JobPool *pool;
+    SDL_AtomicInt pending;
+};
+
+static SDL_TLSID SDL_job_worker;
+static SDL_InitState SDL_jobs_init;
+static SDL_JobPool *SDL_internal_job_pool;
+
+static bool SDL_PushJob(SDL_JobQueue *queue, const SDL_Job *job)
+{
+    SDL_LockSpinlock(&queue->lock);
+    if ((queue->tail - queue->head) > queue->mask) {
+        const Uint32 size = (queue->mask + 1);
+        SDL_Job *jobs = (SDL_Job *)SDL_malloc(size * 2 * sizeof(*jobs));
+        if (!jobs) {
+            SDL_UnlockSpinlock(&queue->lock);
+            return false;
+        }
+        for (Uint32 i = 0; i < size; ++i) {
+            jobs[i] = queue->jobs[(queue->head + i) & queue->mask];
+        }
+        SDL_free(queue->jobs);
+        queue->jobs = jobs;
+        queue->mask = (size * 2) - 1;
+        queue->head = 0;
+        queue->tail = size;
+    }
+    queue->jobs[queue->tail & queue->mask] = *job;
+    ++queue->tail;
+    SDL_UnlockSpinlock(&queue->lock);
+    return true;
+}
+
+// The owner takes the newest job, thieves take the oldest one.
+static bool SDL_PopJob(SDL_JobQueue *queue, SDL_Job *job, bool steal)
+{
+    bool result = false;
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->head != queue->tail) {
+        if (steal) {
+            *job = queue->jobs[queue->head & queue->mask];
+            ++queue->head;
+        } else {
+            --queue->tail;
+            *job = queue->jobs[queue->tail & queue->mask];
+        }
+        result = true;
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+    return result;
+}
+
+static bool SDL_GetNextJob(SDL_JobPool *pool, int index, SDL_Job *job)
+{
+    if (SDL_GetAtomicInt(&pool->queued) <= 0) {
+        return false;
+    }
+
+    if (SDL_PopJob(&pool->queues[index], job, false)) {
+        SDL_AddAtomicInt(&pool->queued, -1);
+        return true;
+    }
+
+    for (int i = 1; i < pool->num_queues; ++i) {
+        if (SDL_PopJob(&pool->queues[(index + i) % pool->num_queues], job, true)) {
+            SDL_AddAtomicInt(&pool->queued, -1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void SDL_FinishJob(SDL_JobGroup *group)
+{
+    // A waiter may destroy the group as soon as the count reaches zero, so
+    // only the pool is touched after that.
+    SDL_JobPool *pool = group->pool;
+    if (SDL_AtomicDecRef(&group->pending)) {
+        SDL_LockMutex(pool->lock);
+        SDL_BroadcastCondition(pool->cond);
+        SDL_UnlockMutex(pool->lock);
+    }
+}
+
+static void SDL_RunJob(const SDL_Job *job)
+{
+    job->fn(job->userdata);
+
+    if (job->group) {
+        SDL_FinishJob(job->group);
+    }
+}
+
+// Find the queue this thread should use for the pool
+static int SDL_GetJobQueueIndex(SDL_JobPool *pool)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)SDL_GetTLS(&SDL_job_worker);
+    if (worker && worker->pool == pool) {
+        return worker->index;
+    }
+    return (int)((Uint32)SDL_AddAtomicInt(&pool->next_queue, 1) % (Uint32)pool->num_queues);
+}
+
+static int SDLCALL SDL_JobWorkerThread(void *data)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)data;
+    SDL_JobPool *pool = worker->pool;
+    SDL_Job job;
+
+    SDL_SetTLS(&SDL_job_worker, worker, NULL);
+
+    for (;;) {
+        if (SDL_GetNextJob(pool, worker->index, &job)) {
+            SDL_RunJob(&job);
+            continue;
+        }
+
+        // Announce that we're going to sleep before checking for work, so a
+        // submitter either sees us sleeping or we see its job.
+        SDL_LockMutex(pool->lock);
+        SDL_AddAtomicInt(&pool->sleepers, 1);
+        while (SDL_GetAtomicInt(&pool->queued) <= 0 && !SDL_GetAtomicInt(&pool->shutdown)) {
+            SDL_WaitCondition(pool->cond, pool->lock);
+        }
+        SDL_AddAtomicInt(&pool->sleepers, -1);
+        SDL_UnlockMutex(pool->lock);
+
+        if (SDL_GetAtomicInt(&pool->queued) <= 0 && SDL_GetAtomicInt(&pool->shutdown)) {
+            break;
+        }
+    }
+    return 0;
+}
+
+SDL_JobPool *SDL_CreateJobPool(int num_threads)
+{
+    CHECK_PARAM(num_threads < 0) {
+        SDL_InvalidParamError("num_threads");
+        return NULL;
+    }
+
+    if (num_threads == 0) {
+        num_threads = SDL_GetNumLogicalCPUCores();
+    }
+
+    SDL_JobPool *pool = (SDL_JobPool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->num_queues = SDL_max(num_threads, 1);
+    pool->queues = (SDL_JobQueue *)SDL_calloc(pool->num_queues, sizeof(*pool->queues));
+    pool->workers = (SDL_JobWorker *)SDL_calloc(num_threads, sizeof(*pool->workers));
+    pool->lock = SDL_CreateMutex();
+    pool->cond = SDL_CreateCondition();
+    if (!pool->queues || (num_threads > 0 && !pool->workers) || !pool->lock || !pool->cond) {
+        SDL_DestroyJobPool(pool);
+        return NULL;
+    }
+
+    for (int i = 0; i < pool->num_queues; ++i) {
+        SDL_JobQueue *queue = &pool->queues[i];
+        queue->jobs = (SDL_Job *)SDL_malloc(SDL_JOB_QUEUE_INITIAL_SIZE * sizeof(*queue->jobs));
+        if (!queue->jobs) {
+            SDL_DestroyJobPool(pool);
+            return NULL;
+        }
+        queue->mask = SDL_JOB_QUEUE_INITIAL_SIZE - 1;
+    }
+
+    // If we can't get all the threads we asked for, run with the ones we got.
+    // Without any, jobs are run by the threads waiting on them.
+    for (int i = 0; i < num_threads; ++i) {
+        SDL_JobWorker *worker = &pool->workers[pool->num_threads];
+        char name[64];
+
+        worker->pool = pool;
+        worker->index = pool->num_threads;
+        SDL_snprintf(name, sizeof(name), "SDLJobWorker%d", worker->index);
+        worker->thread = SDL_CreateThread(SDL_JobWorkerThread, name, worker);
+        if (!worker->thread) {
+            break;
+        }
+        ++pool->num_threads;
+    }
+    return pool;
+}
+
+int SDL_GetJobPoolThreadCount(SDL_JobPool *pool)
+{
+    CHECK_PARAM(!pool) {
+        SDL_InvalidParamError("pool");
+        return -1;
+    }
+
+    return pool->num_threads;
+}
+
+SDL_JobGroup *SDL_CreateJobGroup(SDL_JobPool *pool)
+{
+    CHECK_PARAM(!pool) {
+        SDL_InvalidParamError("pool");
+        return NULL;
+    }
+
+    SDL_JobGroup *group = (SDL_JobGroup *)SDL_calloc(1, sizeof(*group));
+    if (!group) {
+        return NULL;
+    }
+    group->pool = pool;
+    return group;
+}
+
+bool SDL_SubmitJob(SDL_JobPool *pool, SDL_JobGroup *group, SDL_JobFunction fn, void *userdata)
+{
+    CHECK_PARAM(!pool) {
+        return SDL_InvalidParamError("pool");
+    }
+    CHECK_PARAM(group && group->pool != pool) {
+        return SDL_InvalidParamError("group");
+    }
+    CHECK_PARAM(!fn) {
+        return SDL_InvalidParamError("fn");
+    }
+
+    SDL_Job job;
+    job.fn = fn;
+    job.userdata = userdata;
+    job.group = group;
+
+    if (group) {
+        SDL_AddAtomicInt(&group->pending, 1);
+    }
+
+    if (!SDL_PushJob(&pool->queues[SDL_GetJobQueueIndex(pool)], &job)) {
+        if (group) {
+            SDL_FinishJob(group);
+        }
+        return false;
+    }
+    SDL_AddAtomicInt(&pool->queued, 1);
+
+    if (SDL_GetAtomicInt(&pool->sleepers) > 0) {
+        SDL_LockMutex(pool->lock);
+        SDL_SignalCondition(pool->cond);
+        SDL_UnlockMutex(pool->lock);
+    }
+    return true;
+}
+
+void SDL_WaitJobGroup(SDL_JobGroup *group)
+{
+    CHECK_PARAM(!group) {
+        SDL_InvalidParamError("group");
+        return;
+    }
+
+    SDL_JobPool *pool = group->pool;
+    const int index = SDL_GetJobQueueIndex(pool);
+    SDL_Job job;
+
+    while (SDL_GetAtomicInt(&group->pending) > 0) {
+        // Help out rather than block, this also keeps jobs that wait on
+        // other jobs from deadlocking the pool.
+        if (SDL_GetNextJob(pool, index, &job)) {
+            SDL_RunJob(&job);
+            continue;
+        }
+
+        // Sleep like an idle worker, so jobs submitted after this point
+        // wake us up too, even if every worker is itself waiting on a group.
+        SDL_LockMutex(pool->lock);
+        SDL_AddAtomicInt(&pool->sleepers, 1);
+        while (SDL_GetAtomicInt(&pool->queued) <= 0 && SDL_GetAtomicInt(&group->pending) > 0) {
+            SDL_WaitCondition(pool->cond, pool->lock);
+        }
+        SDL_AddAtomicInt(&pool->sleepers, -1);
+        SDL_UnlockMutex(pool->lock);
+    }
+
+    // We may have consumed a wakeup meant for a new job, pass it along
+    if (SDL_GetAtomicInt(&pool->queued) > 0 && SDL_GetAtomicInt(&pool->sleepers) > 0) {
+        SDL_LockMutex(pool->lock);
+        SDL_SignalCondition(pool->cond);
+        SDL_UnlockMutex(pool->lock);
+    }
+}
+
+void SDL_DestroyJobGroup(SDL_JobGroup *group)
+{
+    if (!group) {
+        return;
+    }
+
+    SDL_WaitJobGroup(group);
+    SDL_free(group);
+}
+
+void SDL_DestroyJobPool(SDL_JobPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    if (pool->num_threads > 0) {
+        SDL_LockMutex(pool->lock);
+        SDL_SetAtomicInt(&pool->shutdown, 1);
+        SDL_BroadcastCondition(pool->cond);
+        SDL_UnlockMutex(pool->lock);
+
+        for (int i = 0; i < pool->num_threads; ++i) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+    }
+
+    // Run anything left over if there were no workers to do it
+    if (pool->queues) {
+        SDL_Job job;
+        while (SDL_GetNextJob(pool, 0, &job)) {
+            SDL_RunJob(&job);
+        }
+        for (int i = 0; i < pool->num_queues; ++i) {
+            SDL_free(pool->queues[i].jobs);
+        }
+        SDL_free(pool->queues);
+    }
+
+    SDL_DestroyCondition(pool->cond);
+    SDL_DestroyMutex(pool->lock);
+    SDL_free(pool->workers);
+    SDL_free(pool);
+}
+
+SDL_JobPool *SDL_GetInternalJobPool(void)
+{
+    if (SDL_ShouldInit(&SDL_jobs_init)) {
+        SDL_internal_job_pool = SDL_CreateJobPool(0);
+        SDL_SetInitialized(&SDL_jobs_init, SDL_internal_job_pool != NULL);
+    }
+    return SDL_internal_job_pool;
+}
+
+void SDL_QuitJobs(void)
+{
+    if (!SDL_ShouldQuit(&SDL_jobs_init)) {
+        return;
+    }
+
+    SDL_DestroyJobPool(SDL_internal_job_pool);
+    SDL_internal_job_pool = NULL;
+
+    SDL_SetInitialized(&SDL_jobs_init, false);
+}
@@ -82,6 +82,10 @@ typedef struct
 extern void SDL_InitTLSData(void);
 extern void SDL_QuitTLSData(void);
 
+// A job pool shared by SDL internals, created on first use
+extern SDL_JobPool *SDL_GetInternalJobPool(void);
+extern void SDL_QuitJobs(void);
+
 /* Generic TLS support.
    This is only intended as a fallback if getting real thread-local
    storage fails or isn't supported on this platform.
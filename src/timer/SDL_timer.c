@@ -22,6 +22,7 @@
 
 #include "SDL_timer_c.h"
 #include "../thread/SDL_systhread.h"
+#include "../SDL_hashtable.h"
 
 // #define DEBUG_TIMERS
 
@@ -35,24 +36,20 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 order;
+    int heap_index;     // position in the heap, or -1 if it isn't in the heap
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
+    struct SDL_Timer *next_canceled;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
-
-// The timers are kept in a sorted list
+// The timers are kept in a binary min-heap ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -62,49 +59,136 @@ typedef struct
     SDL_SpinLock lock;
     SDL_Semaphore *sem;
     SDL_Timer *pending;
+    SDL_Timer *canceled;
     SDL_Timer *freelist;
     SDL_AtomicInt active;
 
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    // Heap of timers - this is only touched by the timer thread
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_order;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
 
 /* The idea here is that any thread might add a timer, but a single
- * thread manages the active timer queue, sorted by scheduling time.
+ * thread manages the active timer queue, a heap ordered by scheduling time.
+ * Timers scheduled for the same time fire in the order they were queued.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by setting a canceled flag and handing them to the timer
+ * thread, which takes them out of the heap by their stored index. Whoever sets
+ * the canceled flag owns the timer's cleanup: SDL_RemoveTimer() queues it on
+ * the canceled list, the timer thread frees a timer whose callback returned 0.
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+static bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->order < b->order;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+// Put a timer at position `i` of the heap and sift it up or down to its place
+static void SDL_SiftTimer(SDL_TimerData *data, int i, SDL_Timer *timer)
+{
+    SDL_Timer **timers = data->timers;
+    const int count = data->num_timers;
+    int parent, child;
+
+    // Sift up towards the root
+    for (; i > 0; i = parent) {
+        parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, timers[parent])) {
             break;
         }
+        timers[i] = timers[parent];
+        timers[i]->heap_index = i;
     }
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+    // Sift down towards the leaves
+    for (; (child = 2 * i + 1) < count; i = child) {
+        if (child + 1 < count && SDL_TimerBefore(timers[child + 1], timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(timers[child], timer)) {
+            break;
+        }
+        timers[i] = timers[child];
+        timers[i]->heap_index = i;
+    }
+
+    timers[i] = timer;
+    timer->heap_index = i;
+}
+
+static bool SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_Timer **timers = data->timers;
+
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return false;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->order = data->next_order++;
+    SDL_SiftTimer(data, data->num_timers++, timer);
+    return true;
+}
+
+// Take the timer at position `i` out of the heap
+static void SDL_RemoveTimerAt(SDL_TimerData *data, int i)
+{
+    SDL_Timer *timer = data->timers[i];
+    SDL_Timer *last = data->timers[--data->num_timers];
+
+    timer->heap_index = -1;
+    if (last != timer) {
+        SDL_SiftTimer(data, i, last);
     }
-    timer->next = curr;
+}
+
+static SDL_Timer *SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *first = data->timers[0];
+    SDL_RemoveTimerAt(data, 0);
+    return first;
+}
+
+// Queue a timer, or hand it back to the pending list to try again later if we're out of memory
+static bool SDL_QueueTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    if (SDL_GetAtomicInt(&timer->canceled)) {
+        return true;  // It's on the canceled list, which frees it
+    }
+    if (SDL_AddTimerInternal(data, timer)) {
+        return true;
+    }
+
+    SDL_LockSpinlock(&data->lock);
+    timer->next = data->pending;
+    data->pending = timer;
+    SDL_UnlockSpinlock(&data->lock);
+    return false;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *canceled;
     SDL_Timer *current;
+    SDL_Timer *expired_head, *expired_tail;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
+    bool out_of_memory;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -112,6 +196,8 @@ static int SDLCALL SDL_TimerThread(void *_data)
      *  3. Wait until next dispatch time or new timer arrives
      */
     for (;;) {
+        out_of_memory = false;
+
         // Pending and freelist maintenance
         SDL_LockSpinlock(&data->lock);
         {
@@ -119,6 +205,10 @@ static int SDLCALL SDL_TimerThread(void *_data)
             pending = data->pending;
             data->pending = NULL;
 
+            // Get any timers that were removed
+            canceled = data->canceled;
+            data->canceled = NULL;
+
             // Make any unused timer structures available
             if (freelist_head) {
                 freelist_tail->next = data->freelist;
@@ -127,17 +217,42 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        // Sort the pending timers into our heap
         while (pending) {
             current = pending;
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
+            if (!SDL_QueueTimer(data, current)) {
+                out_of_memory = true;
+            }
         }
         freelist_head = NULL;
         freelist_tail = NULL;
 
+        /* Take the removed timers out of the heap and free them. This comes after
+           the pending timers, so none of them are still on the pending list. */
+        while (canceled) {
+            current = canceled;
+            canceled = canceled->next_canceled;
+            if (current->heap_index >= 0) {
+                SDL_RemoveTimerAt(data, current->heap_index);
+            }
+            current->next = NULL;
+            if (freelist_tail) {
+                freelist_tail->next = current;
+            } else {
+                freelist_head = current;
+            }
+            freelist_tail = current;
+        }
+
         // Check to see if we're still running, after maintenance
         if (!SDL_GetAtomicInt(&data->active)) {
+            if (freelist_head) {
+                SDL_LockSpinlock(&data->lock);
+                freelist_tail->next = data->freelist;
+                data->freelist = freelist_head;
+                SDL_UnlockSpinlock(&data->lock);
+            }
             break;
         }
 
@@ -146,47 +261,62 @@ static int SDLCALL SDL_TimerThread(void *_data)
 
         tick = SDL_GetTicksNS();
 
-        // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
-
-            if (tick < current->scheduled) {
-                // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
-                break;
+        // Pull out all the timers that expire this tick
+        expired_head = NULL;
+        expired_tail = NULL;
+        while (data->num_timers > 0 && data->timers[0]->scheduled <= tick) {
+            current = SDL_RemoveFirstTimer(data);
+            current->next = NULL;
+            if (expired_tail) {
+                expired_tail->next = current;
+            } else {
+                expired_head = current;
             }
+            expired_tail = current;
+        }
 
-            // We're going to do something with this timer
-            data->timers = current->next;
+        // Process them as a batch
+        while (expired_head) {
+            current = expired_head;
+            expired_head = current->next;
 
             if (SDL_GetAtomicInt(&current->canceled)) {
-                interval = 0;
+                continue;  // It's on the canceled list, which frees it
+            }
+
+            if (current->callback_ms) {
+                interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
             } else {
-                if (current->callback_ms) {
-                    interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
-                } else {
-                    interval = current->callback_ns(current->userdata, current->timerID, current->interval);
-                }
+                interval = current->callback_ns(current->userdata, current->timerID, current->interval);
             }
 
             if (interval > 0) {
                 // Reschedule this timer
                 current->interval = interval;
                 current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
-            } else {
-                if (!freelist_head) {
-                    freelist_head = current;
+                if (!SDL_QueueTimer(data, current)) {
+                    out_of_memory = true;
                 }
+            } else if (SDL_CompareAndSwapAtomicInt(&current->canceled, 0, 1)) {
+                // The timer is done and nobody removed it in the meantime, free it
+                current->next = NULL;
                 if (freelist_tail) {
                     freelist_tail->next = current;
+                } else {
+                    freelist_head = current;
                 }
                 freelist_tail = current;
-
-                SDL_SetAtomicInt(&current->canceled, 1);
             }
         }
 
+        if (out_of_memory) {
+            // Try to queue the timers we couldn't fit again shortly
+            delay = SDL_MS_TO_NS(1);
+        } else if (data->num_timers > 0) {
+            // Scheduled for the future, wait a bit
+            delay = (data->timers[0]->scheduled - tick);
+        }
+
         // Adjust the delay based on processing time
         now = SDL_GetTicksNS();
         interval = (now - tick);
@@ -219,6 +349,11 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
@@ -245,7 +380,7 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -265,10 +400,33 @@ void SDL_QuitTimers(void)
         data->sem = NULL;
     }
 
-    // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
+    // Clean up the timer entries, removed timers can still be in the heap or on the pending list
+    while (data->canceled) {
+        SDL_Timer **prev;
+
+        timer = data->canceled;
+        data->canceled = timer->next_canceled;
+        if (timer->heap_index >= 0) {
+            SDL_RemoveTimerAt(data, timer->heap_index);
+        }
+        for (prev = &data->pending; *prev; prev = &(*prev)->next) {
+            if (*prev == timer) {
+                *prev = timer->next;
+                break;
+            }
+        }
+        SDL_free(timer);
+    }
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_free(data->timers[i]);
+    }
+    SDL_free(data->timers);
+    data->timers = NULL;
+    data->num_timers = 0;
+    data->max_timers = 0;
+    while (data->pending) {
+        timer = data->pending;
+        data->pending = timer->next;
         SDL_free(timer);
     }
     while (data->freelist) {
@@ -276,10 +434,9 @@ void SDL_QuitTimers(void)
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +456,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    bool added;
 
     CHECK_PARAM(!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -331,20 +488,16 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->userdata = userdata;
     timer->interval = interval;
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
+    timer->heap_index = -1;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    SDL_LockMutex(data->timermap_lock);
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID, timer, false);
+    SDL_UnlockMutex(data->timermap_lock);
+    if (!added) {
         SDL_free(timer);
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
 
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
@@ -355,7 +508,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     // Wake up the timer thread if necessary
     SDL_SignalSemaphore(data->sem);
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +524,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer = NULL;
     bool canceled = false;
 
     CHECK_PARAM(!id) {
@@ -380,25 +533,20 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
-            canceled = true;
-        }
-        SDL_free(entry);
+    if (timer && SDL_CompareAndSwapAtomicInt(&timer->canceled, 0, 1)) {
+        // Hand it to the timer thread to take out of the heap
+        SDL_LockSpinlock(&data->lock);
+        timer->next_canceled = data->canceled;
+        data->canceled = timer;
+        SDL_UnlockSpinlock(&data->lock);
+
+        SDL_SignalSemaphore(data->sem);
+        canceled = true;
     }
     if (canceled) {
         return true;
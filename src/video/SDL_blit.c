@@ -231,7 +231,17 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
             blit = SDL_BlitCopy;
         } else if (SDL_ISPIXELFORMAT_10BIT(surface->format) ||
                    SDL_ISPIXELFORMAT_10BIT(dst->format)) {
-            blit = SDL_Blit_Slow;
+#ifdef SDL_HAVE_BLIT_AUTO
+            // ARGB2101010 is the only 10-bit format with generated blitters
+            if ((!SDL_ISPIXELFORMAT_10BIT(surface->format) || surface->format == SDL_PIXELFORMAT_ARGB2101010) &&
+                (!SDL_ISPIXELFORMAT_10BIT(dst->format) || dst->format == SDL_PIXELFORMAT_ARGB2101010)) {
+                blit = SDL_ChooseBlitFunc(surface->format, dst->format, map->info.flags,
+                                          SDL_GeneratedBlitFuncTable);
+            }
+#endif
+            if (!blit) {
+                blit = SDL_Blit_Slow;
+            }
         }
 #ifdef SDL_HAVE_BLIT_0
         else if (SDL_BITSPERPIXEL(surface->format) < 8 &&
@@ -291,5 +301,12 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
         return SDL_SetError("Blit combination not supported");
     }
 
+    if (blit == SDL_Blit_Slow || blit == SDL_Blit_Slow_Float) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Using %s for %s -> %s, flags 0x%.8x",
+                     (blit == SDL_Blit_Slow) ? "SDL_Blit_Slow" : "SDL_Blit_Slow_Float",
+                     SDL_GetPixelFormatName(surface->format), SDL_GetPixelFormatName(dst->format),
+                     (unsigned int)map->info.flags);
+    }
+
     return true;
 }
@@ -48,6 +48,46 @@ static SlowBlitPixelAccess GetPixelAccessMethod(SDL_PixelFormat format)
     }
 }
 
+/* Ordered dithering for blits to a palettized surface, see SDL_PROP_SURFACE_DITHER_BOOLEAN.
+ * Returns how far apart the palette's colors roughly are, or 0 if we shouldn't dither.
+ */
+static int GetDitherSpread(SDL_BlitInfo *info, SlowBlitPixelAccess dst_access)
+{
+    const SDL_Palette *pal = info->dst_pal;
+    int levels = 2;
+
+    if (dst_access != SlowBlitPixelAccess_Index8 || !pal || pal->ncolors < 2 || !info->src_surface->props ||
+        !SDL_GetBooleanProperty(info->src_surface->props, SDL_PROP_SURFACE_DITHER_BOOLEAN, false)) {
+        return 0;
+    }
+
+    // Assume the colors are spread evenly over the RGB cube
+    while (levels * levels * levels < pal->ncolors) {
+        ++levels;
+    }
+    return 255 / (levels - 1);
+}
+
+static Uint32 DitherPixel(Uint32 pixel, int spread, const SDL_Surface *surface, const Uint8 *dst)
+{
+    static const Uint8 bayer[4][4] = {
+        { 0, 8, 2, 10 },
+        { 12, 4, 14, 6 },
+        { 3, 11, 1, 9 },
+        { 15, 7, 13, 5 }
+    };
+    // The pattern follows destination coordinates, so neighboring blits line up
+    const size_t offset = (size_t)(dst - (const Uint8 *)surface->pixels);
+    const int x = (int)(offset % surface->pitch);
+    const int y = (int)(offset / surface->pitch);
+    const int d = (((bayer[y & 3][x & 3] * 2 + 1) * spread) >> 5) - (spread >> 1);
+    const int R = SDL_clamp((int)((pixel >> 24) & 0xFF) + d, 0, 255);
+    const int G = SDL_clamp((int)((pixel >> 16) & 0xFF) + d, 0, 255);
+    const int B = SDL_clamp((int)((pixel >> 8) & 0xFF) + d, 0, 255);
+
+    return ((Uint32)R << 24) | ((Uint32)G << 16) | ((Uint32)B << 8) | (pixel & 0xFF);
+}
+
 /* The ONE TRUE BLITTER
  * This puppy has to handle all the unoptimized cases - yes, it's slow.
  */
@@ -69,7 +109,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteLUT *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -78,12 +118,14 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     Uint32 ckey = info->colorkey & rgbmask;
     Uint32 last_pixel = 0;
     Uint8 last_index = 0;
+    int dither_spread;
 
     src_access = GetPixelAccessMethod(src_fmt->format);
     dst_access = GetPixelAccessMethod(dst_fmt->format);
     if (dst_access == SlowBlitPixelAccess_Index8) {
         last_index = SDL_LookupRGBAColor(palette_map, last_pixel, dst_pal);
     }
+    dither_spread = GetDitherSpread(info, dst_access);
 
     incy = info->dst_h ? ((Uint64)info->src_h << 16) / info->dst_h : 0;
     incx = info->dst_w ? ((Uint64)info->src_w << 16) / info->dst_w : 0;
@@ -282,6 +324,9 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
             switch (dst_access) {
             case SlowBlitPixelAccess_Index8:
                 dstpixel = ((dstR << 24) | (dstG << 16) | (dstB << 8) | dstA);
+                if (dither_spread) {
+                    dstpixel = DitherPixel(dstpixel, dither_spread, info->dst_surface, dst);
+                }
                 if (dstpixel != last_pixel) {
                     last_pixel = dstpixel;
                     last_index = SDL_LookupRGBAColor(palette_map, dstpixel, dst_pal);
@@ -821,7 +866,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteLUT *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -838,6 +883,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     SDL_TonemapContext tonemap;
     Uint32 last_pixel = 0;
     Uint8 last_index = 0;
+    int dither_spread;
 
     src_colorspace = info->src_surface->colorspace;
     dst_colorspace = info->dst_surface->colorspace;
@@ -891,6 +937,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     if (dst_access == SlowBlitPixelAccess_Index8) {
         last_index = SDL_LookupRGBAColor(palette_map, last_pixel, dst_pal);
     }
+    dither_spread = GetDitherSpread(info, dst_access);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
@@ -977,6 +1024,9 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
                 Uint32 B = (Uint8)SDL_roundf(SDL_clamp(SDL_sRGBfromLinear(dstB), 0.0f, 1.0f) * 255.0f);
                 Uint32 A = (Uint8)SDL_roundf(SDL_clamp(dstA, 0.0f, 1.0f) * 255.0f);
                 Uint32 dstpixel = ((R << 24) | (G << 16) | (B << 8) | A);
+                if (dither_spread) {
+                    dstpixel = DitherPixel(dstpixel, dither_spread, info->dst_surface, dst);
+                }
                 if (dstpixel != last_pixel) {
                     last_pixel = dstpixel;
                     last_index = SDL_LookupRGBAColor(palette_map, dstpixel, dst_pal);
@@ -1214,20 +1214,138 @@ static Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Ui
     return pixelvalue;
 }
 
-Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
+/*
+ * Nearest color lookup for blits to a palettized surface.
+ *
+ * RGBA space is split into cells, and each cell keeps the palette entries
+ * that could be the nearest match for some color inside it. Looking up a
+ * color then only compares against that short list, in palette order, so the
+ * result is exactly what SDL_FindColor() would return. Cells are filled in
+ * the first time a color lands in them, so a blit only pays for the part of
+ * the color space it actually uses.
+ */
+#define PALETTE_LUT_RGB_BITS 3
+#define PALETTE_LUT_A_BITS   2
+#define PALETTE_LUT_CELLS    (1 << (3 * PALETTE_LUT_RGB_BITS + PALETTE_LUT_A_BITS))
+
+struct SDL_PaletteLUT
 {
-    Uint8 color_index = 0;
-    if (pal) {
-        const void *value;
-        if (SDL_FindInHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, &value)) {
-            color_index = (Uint8)(uintptr_t)value;
-        } else {
-            Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
-            Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
-            Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
-            Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
-            color_index = SDL_FindColor(pal, r, g, b, a);
-            SDL_InsertIntoHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, (const void *)(uintptr_t)color_index, true);
+    Uint32 cell_start[PALETTE_LUT_CELLS];
+    Uint16 cell_count[PALETTE_LUT_CELLS]; // 0 if the cell hasn't been filled in yet
+    Uint8 *candidates;
+    size_t num_candidates;
+    size_t max_candidates;
+};
+
+SDL_PaletteLUT *SDL_CreatePaletteLUT(void)
+{
+    return (SDL_PaletteLUT *)SDL_calloc(1, sizeof(SDL_PaletteLUT));
+}
+
+void SDL_DestroyPaletteLUT(SDL_PaletteLUT *lut)
+{
+    if (lut) {
+        SDL_free(lut->candidates);
+        SDL_free(lut);
+    }
+}
+
+// The closest and farthest squared distance from `value` to anything in [lo, hi]
+static void GetPaletteLUTRange(int value, int lo, int hi, unsigned int *nearest, unsigned int *farthest)
+{
+    const int near_d = (value < lo) ? (lo - value) : (value > hi) ? (value - hi) : 0;
+    const int far_d = SDL_max(value - lo, hi - value);
+    *nearest = (unsigned int)(near_d * near_d);
+    *farthest = (unsigned int)(far_d * far_d);
+}
+
+static bool FillPaletteLUTCell(SDL_PaletteLUT *lut, int cell, const SDL_Palette *pal)
+{
+    const int rgb_size = 1 << (8 - PALETTE_LUT_RGB_BITS);
+    const int a_size = 1 << (8 - PALETTE_LUT_A_BITS);
+    const int rlo = ((cell >> (2 * PALETTE_LUT_RGB_BITS + PALETTE_LUT_A_BITS)) & ((1 << PALETTE_LUT_RGB_BITS) - 1)) * rgb_size;
+    const int glo = ((cell >> (PALETTE_LUT_RGB_BITS + PALETTE_LUT_A_BITS)) & ((1 << PALETTE_LUT_RGB_BITS) - 1)) * rgb_size;
+    const int blo = ((cell >> PALETTE_LUT_A_BITS) & ((1 << PALETTE_LUT_RGB_BITS) - 1)) * rgb_size;
+    const int alo = (cell & ((1 << PALETTE_LUT_A_BITS) - 1)) * a_size;
+    unsigned int nearest[256];
+    unsigned int bound = ~0U;
+    int i;
+
+    // An entry can only win somewhere in the cell if its nearest point is no farther
+    // than the best any entry can guarantee for the whole cell.
+    for (i = 0; i < pal->ncolors; ++i) {
+        const SDL_Color *color = &pal->colors[i];
+        unsigned int rn, rf, gn, gf, bn, bf, an, af;
+        GetPaletteLUTRange(color->r, rlo, rlo + rgb_size - 1, &rn, &rf);
+        GetPaletteLUTRange(color->g, glo, glo + rgb_size - 1, &gn, &gf);
+        GetPaletteLUTRange(color->b, blo, blo + rgb_size - 1, &bn, &bf);
+        GetPaletteLUTRange(color->a, alo, alo + a_size - 1, &an, &af);
+        nearest[i] = rn + gn + bn + an;
+        bound = SDL_min(bound, rf + gf + bf + af);
+    }
+
+    if (lut->num_candidates + pal->ncolors > lut->max_candidates) {
+        size_t max_candidates = SDL_max(lut->max_candidates * 2, 4096);
+        while (lut->num_candidates + pal->ncolors > max_candidates) {
+            max_candidates *= 2;
+        }
+        Uint8 *candidates = (Uint8 *)SDL_realloc(lut->candidates, max_candidates);
+        if (!candidates) {
+            return false;
+        }
+        lut->candidates = candidates;
+        lut->max_candidates = max_candidates;
+    }
+
+    lut->cell_start[cell] = (Uint32)lut->num_candidates;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (nearest[i] <= bound) {
+            lut->candidates[lut->num_candidates++] = (Uint8)i;
+        }
+    }
+    lut->cell_count[cell] = (Uint16)(lut->num_candidates - lut->cell_start[cell]);
+    return true;
+}
+
+Uint8 SDL_LookupRGBAColor(SDL_PaletteLUT *lut, Uint32 pixelvalue, const SDL_Palette *pal)
+{
+    if (!pal || pal->ncolors <= 0) {
+        return 0;
+    }
+
+    const Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
+    const Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
+    const Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
+    const Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
+    const int cell = ((r >> (8 - PALETTE_LUT_RGB_BITS)) << (2 * PALETTE_LUT_RGB_BITS + PALETTE_LUT_A_BITS)) |
+                     ((g >> (8 - PALETTE_LUT_RGB_BITS)) << (PALETTE_LUT_RGB_BITS + PALETTE_LUT_A_BITS)) |
+                     ((b >> (8 - PALETTE_LUT_RGB_BITS)) << PALETTE_LUT_A_BITS) |
+                     (a >> (8 - PALETTE_LUT_A_BITS));
+
+    if (!lut || (lut->cell_count[cell] == 0 && !FillPaletteLUTCell(lut, cell, pal))) {
+        return SDL_FindColor(pal, r, g, b, a);
+    }
+
+    // Same search as SDL_FindColor, over fewer entries
+    const Uint8 *candidates = &lut->candidates[lut->cell_start[cell]];
+    const int count = lut->cell_count[cell];
+    unsigned int smallest = ~0U;
+    Uint8 color_index = candidates[0];
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &pal->colors[candidates[i]];
+        const int rd = color->r - r;
+        const int gd = color->g - g;
+        const int bd = color->b - b;
+        const int ad = color->a - a;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            color_index = candidates[i];
+            if (distance == 0) { // Perfect match!
+                break;
+            }
+            smallest = distance;
         }
     }
     return color_index;
@@ -1545,7 +1663,7 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
         map->info.table = NULL;
     }
     if (map->info.palette_map) {
-        SDL_DestroyHashTable(map->info.palette_map);
+        SDL_DestroyPaletteLUT(map->info.palette_map);
         map->info.palette_map = NULL;
     }
 }
@@ -1601,7 +1719,10 @@ bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             // BitField --> Palette
-            map->info.palette_map = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+            map->info.palette_map = SDL_CreatePaletteLUT();
+            if (!map->info.palette_map) {
+                return false;
+            }
         } else {
             // BitField --> BitField
             if (srcfmt == dstfmt) {
@@ -22,6 +22,7 @@
 
 #include "SDL_stb_c.h"
 #include "SDL_surface_c.h"
+#include "../io/SDL_iostream_c.h"
 
 #ifdef SDL_HAVE_STB
 ////////////////////////////////////////////////////////////////////////////
@@ -152,6 +153,26 @@ static int IMG_LoadSTB_IO_eof(void *user)
     return SDL_GetIOStatus(src) == SDL_IO_STATUS_EOF;
 }
 
+/* Find the end of the PNG at the start of the data, after its IEND chunk */
+static size_t SDL_GetPNGSize(const stbi_uc *data, size_t datasize)
+{
+    size_t offset = 8;
+
+    while (offset + 12 <= datasize) {
+        const stbi_uc *chunk = data + offset;
+        const size_t length = ((size_t)chunk[0] << 24) | ((size_t)chunk[1] << 16) | ((size_t)chunk[2] << 8) | chunk[3];
+
+        if (length > datasize - offset - 12) {
+            break;
+        }
+        offset += 12 + length;
+        if (SDL_memcmp(&chunk[4], "IEND", 4) == 0) {
+            return offset;
+        }
+    }
+    return datasize;
+}
+
 static SDL_Surface *SDL_LoadSTB_IO(SDL_IOStream *src)
 {
     Sint64 start;
@@ -159,6 +180,9 @@ static SDL_Surface *SDL_LoadSTB_IO(SDL_IOStream *src)
     int w, h, format;
     stbi_uc *pixels;
     stbi_io_callbacks rw_callbacks;
+    const stbi_uc *data;
+    size_t datasize;
+    bool from_memory;
     SDL_Surface *surface = NULL;
     bool use_palette = false;
     unsigned int palette_colors[256];
@@ -182,7 +206,8 @@ static SDL_Surface *SDL_LoadSTB_IO(SDL_IOStream *src)
     }
     SDL_SeekIO(src, start, SDL_IO_SEEK_SET);
 
-    /* Load the image data */
+    /* Load the image data, straight from memory if the stream is backed by it */
+    data = (const stbi_uc *)SDL_GetIOMemory(src, &datasize);
     rw_callbacks.read = IMG_LoadSTB_IO_read;
     rw_callbacks.skip = IMG_LoadSTB_IO_skip;
     rw_callbacks.eof = IMG_LoadSTB_IO_eof;
@@ -190,7 +215,15 @@ static SDL_Surface *SDL_LoadSTB_IO(SDL_IOStream *src)
     if (use_palette) {
         /* Unused palette entries will be opaque white */
         SDL_memset(palette_colors, 0xff, sizeof(palette_colors));
-
+    }
+    from_memory = (data && datasize <= SDL_MAX_SINT32);
+    if (from_memory) {
+        if (use_palette) {
+            pixels = stbi_load_from_memory_with_palette(data, (int)datasize, &w, &h, palette_colors, SDL_arraysize(palette_colors));
+        } else {
+            pixels = stbi_load_from_memory(data, (int)datasize, &w, &h, &format, STBI_default);
+        }
+    } else if (use_palette) {
         pixels = stbi_load_from_callbacks_with_palette(
             &rw_callbacks,
             src,
@@ -213,6 +246,10 @@ static SDL_Surface *SDL_LoadSTB_IO(SDL_IOStream *src)
         SDL_SeekIO(src, start, SDL_IO_SEEK_SET);
         return NULL;
     }
+    if (from_memory) {
+        /* Decoding from memory didn't move the stream, leave it after the image like reading it would */
+        SDL_SeekIO(src, (Sint64)SDL_GetPNGSize(data, datasize), SDL_IO_SEEK_CUR);
+    }
 
     if (use_palette) {
         surface = SDL_CreateSurfaceFrom(
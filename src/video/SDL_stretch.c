@@ -21,10 +21,100 @@
 #include "SDL_internal.h"
 
 #include "SDL_surface_c.h"
+#include "../thread/SDL_thread_c.h"
 
 static bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 static bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 
+// Scales rows [y_start, y_end) of the destination
+typedef bool (*SDL_StretchFunc)(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end);
+
+// Don't bother splitting up scales smaller than this
+#define SDL_STRETCH_MIN_BAND_PIXELS (64 * 1024)
+#define SDL_STRETCH_MIN_BAND_ROWS   8
+#define SDL_STRETCH_MAX_BANDS       64
+
+typedef struct SDL_StretchBand
+{
+    SDL_StretchFunc func;
+    const Uint32 *src;
+    int src_w, src_h, src_pitch;
+    Uint32 *dst;
+    int dst_w, dst_h, dst_pitch;
+    int y_start, y_end;
+} SDL_StretchBand;
+
+static void SDLCALL SDL_StretchBandJob(void *userdata)
+{
+    const SDL_StretchBand *band = (const SDL_StretchBand *)userdata;
+
+    band->func(band->src, band->src_w, band->src_h, band->src_pitch, band->dst, band->dst_w, band->dst_h, band->dst_pitch, band->y_start, band->y_end);
+}
+
+static int SDL_GetStretchBandCount(int dst_w, int dst_h)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_STRETCH_THREADS);
+    int num_bands;
+
+    if (!hint || !*hint) {
+        return 1;
+    }
+
+    num_bands = SDL_atoi(hint);
+    if (num_bands == 0) {
+        num_bands = SDL_GetNumLogicalCPUCores();
+    }
+    num_bands = (int)SDL_min(num_bands, (((Sint64)dst_w * dst_h) / SDL_STRETCH_MIN_BAND_PIXELS));
+    num_bands = SDL_min(num_bands, (dst_h / SDL_STRETCH_MIN_BAND_ROWS));
+    num_bands = SDL_min(num_bands, SDL_STRETCH_MAX_BANDS);
+    return SDL_max(num_bands, 1);
+}
+
+// Every row is computed independently of the ones before it, so the
+// destination can be split into bands of rows that are scaled in parallel
+// with exactly the same output as a single pass.
+static bool SDL_StretchRows(SDL_StretchFunc func, const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+{
+    SDL_StretchBand bands[SDL_STRETCH_MAX_BANDS];
+    SDL_JobPool *pool = NULL;
+    SDL_JobGroup *group = NULL;
+    int num_bands = SDL_GetStretchBandCount(dst_w, dst_h);
+    int i;
+
+    if (num_bands > 1) {
+        pool = SDL_GetInternalJobPool();
+        if (pool) {
+            group = SDL_CreateJobGroup(pool);
+        }
+    }
+    if (!group) {
+        return func(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, 0, dst_h);
+    }
+
+    for (i = 0; i < num_bands; ++i) {
+        SDL_StretchBand *band = &bands[i];
+        band->func = func;
+        band->src = src;
+        band->src_w = src_w;
+        band->src_h = src_h;
+        band->src_pitch = src_pitch;
+        band->dst = dst;
+        band->dst_w = dst_w;
+        band->dst_h = dst_h;
+        band->dst_pitch = dst_pitch;
+        band->y_start = (int)(((Sint64)dst_h * i) / num_bands);
+        band->y_end = (int)(((Sint64)dst_h * (i + 1)) / num_bands);
+
+        // The calling thread takes the last band itself
+        if (i == num_bands - 1 || !SDL_SubmitJob(pool, group, SDL_StretchBandJob, band)) {
+            SDL_StretchBandJob(band);
+        }
+    }
+    SDL_WaitJobGroup(group);
+    SDL_DestroyJobGroup(group);
+    return true;
+}
+
 bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
     bool result;
@@ -200,7 +290,9 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)y_start * fp_step_h;                                          \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y_start * dst_pitch);
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -327,11 +419,11 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
     INTERPOL(tmp, tmp + 1, frac_w0, frac_w1, dst);
 }
 
-static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
 
         BILINEAR___HEIGHT
 
@@ -447,11 +539,11 @@ static SDL_INLINE void SDL_TARGETING("sse2") INTERPOL_BILINEAR_SSE(const Uint32
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -567,6 +659,258 @@ static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, in
 }
 #endif
 
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+
+static SDL_INLINE int hasAVX2(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasAVX2();
+    return val;
+}
+
+/* Horizontal pass for one pixel per 128-bit lane, same math as INTERPOL_BILINEAR_SSE:
+   'k' holds the vertically interpolated x00 and x01 channels as 16-bit values,
+   'weights' holds (1 - frac_w, frac_w) pairs for the pixel in that lane. */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") INTERPOL_HORIZONTAL_AVX2(__m256i k, __m256i weights)
+{
+    k = _mm256_unpacklo_epi16(k, _mm256_srli_si256(k, 8));
+    return _mm256_srli_epi32(_mm256_madd_epi16(k, weights), PRECISION * 2);
+}
+
+static bool SDL_TARGETING("avx2") scale_mat_AVX2(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
+{
+    BILINEAR___START
+
+    const __m256i v_lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i v_fp_offset = _mm256_mullo_epi32(v_lane, _mm256_set1_epi32(fp_step_w));
+    const __m256i v_frac_mask = _mm256_set1_epi32(FRAC_ONE - 1);
+    const __m256i v_frac_one = _mm256_set1_epi32(FRAC_ONE);
+    const __m256i v_pick_02 = _mm256_setr_epi32(0, 0, 0, 0, 2, 2, 2, 2);
+    const __m256i v_pick_13 = _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3);
+    const __m256i v_pick_46 = _mm256_setr_epi32(4, 4, 4, 4, 6, 6, 6, 6);
+    const __m256i v_pick_57 = _mm256_setr_epi32(5, 5, 5, 5, 7, 7, 7, 7);
+    const __m256i v_reorder = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+    const __m256i v_zero = _mm256_setzero_si256();
+
+    for (i = y_start; i < y_end; i++) {
+        int nb_block8;
+        __m128i v_frac_h0;
+        __m128i v_frac_h1;
+        __m128i zero;
+        __m256i v256_frac_h0;
+        __m256i v256_frac_h1;
+
+        BILINEAR___HEIGHT
+
+        nb_block8 = middle / 8;
+        middle &= 7;
+
+        v_frac_h0 = _mm_set1_epi16((short)frac_h0);
+        v_frac_h1 = _mm_set1_epi16((short)frac_h1);
+        zero = _mm_setzero_si128();
+        v256_frac_h0 = _mm256_set1_epi16((short)frac_h0);
+        v256_frac_h1 = _mm256_set1_epi16((short)frac_h1);
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (nb_block8--) {
+            __m256i v_fp, v_index, v_frac, v_weights;
+            __m256i x0_0123, x0_4567, x1_0123, x1_4567; // x00 and x01 of 4 pixels from each row
+            __m256i k_02, k_13, k_46, k_57;
+            __m256i e_0123, e_4567;
+
+            // The middle section never goes past the last source column,
+            // so the fixed point positions fit in 32 bits.
+            v_fp = _mm256_add_epi32(_mm256_set1_epi32((int)(Uint32)fp_sum_w), v_fp_offset);
+            fp_sum_w += 8 * (Sint64)fp_step_w;
+
+            v_index = _mm256_slli_epi32(_mm256_srli_epi32(v_fp, 16), 2);
+            v_frac = _mm256_and_si256(_mm256_srli_epi32(v_fp, 16 - PRECISION), v_frac_mask);
+            v_weights = _mm256_or_si256(_mm256_slli_epi32(v_frac, 16), _mm256_sub_epi32(v_frac_one, v_frac));
+
+            x0_0123 = _mm256_i32gather_epi64((const long long *)src_h0, _mm256_castsi256_si128(v_index), 1);
+            x0_4567 = _mm256_i32gather_epi64((const long long *)src_h0, _mm256_extracti128_si256(v_index, 1), 1);
+            x1_0123 = _mm256_i32gather_epi64((const long long *)src_h1, _mm256_castsi256_si128(v_index), 1);
+            x1_4567 = _mm256_i32gather_epi64((const long long *)src_h1, _mm256_extracti128_si256(v_index, 1), 1);
+
+            // Interpolation vertical, one pixel per 128-bit lane
+            k_02 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x0_0123, v_zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(x1_0123, v_zero), v256_frac_h0));
+            k_13 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x0_0123, v_zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(x1_0123, v_zero), v256_frac_h0));
+            k_46 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x0_4567, v_zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(x1_4567, v_zero), v256_frac_h0));
+            k_57 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x0_4567, v_zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(x1_4567, v_zero), v256_frac_h0));
+
+            // Interpolation horizontal
+            k_02 = INTERPOL_HORIZONTAL_AVX2(k_02, _mm256_permutevar8x32_epi32(v_weights, v_pick_02));
+            k_13 = INTERPOL_HORIZONTAL_AVX2(k_13, _mm256_permutevar8x32_epi32(v_weights, v_pick_13));
+            k_46 = INTERPOL_HORIZONTAL_AVX2(k_46, _mm256_permutevar8x32_epi32(v_weights, v_pick_46));
+            k_57 = INTERPOL_HORIZONTAL_AVX2(k_57, _mm256_permutevar8x32_epi32(v_weights, v_pick_57));
+
+            // Store 8 pixels, packing leaves them as 0 1 4 5 | 2 3 6 7
+            e_0123 = _mm256_packs_epi32(k_02, k_13);
+            e_4567 = _mm256_packs_epi32(k_46, k_57);
+            e_0123 = _mm256_packus_epi16(e_0123, e_4567);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_permutevar8x32_epi32(e_0123, v_reorder));
+            dst += 8;
+        }
+
+        while (middle--) {
+            const Uint32 *s_00_01;
+            const Uint32 *s_10_11;
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return true;
+}
+#endif
+
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX512F_INTRINSICS)
+
+static SDL_INLINE int hasAVX512F(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasAVX512F();
+    return val;
+}
+
+/* AVX-512F has no 16-bit multiplies, so the math is done in 32-bit lanes with
+   the same intermediate values as the SSE2 path. x0 * (1 - frac) + x1 * frac
+   is computed as (x0 << PRECISION) + (x1 - x0) * frac, and since a vertically
+   interpolated channel fits in 16 bits, the vertical pass handles two channels
+   per lane at once. */
+static SDL_INLINE __m512i SDL_TARGETING("avx512f") INTERPOL_VERTICAL_AVX512(__m512i x0, __m512i x1, __m512i frac_h0)
+{
+    return _mm512_add_epi32(_mm512_slli_epi32(x0, PRECISION), _mm512_mullo_epi32(_mm512_sub_epi32(x1, x0), frac_h0));
+}
+
+static SDL_INLINE __m512i SDL_TARGETING("avx512f") INTERPOL_HORIZONTAL_AVX512(__m512i k0, __m512i k1, __m512i frac_w0)
+{
+    k0 = _mm512_add_epi32(_mm512_slli_epi32(k0, PRECISION), _mm512_mullo_epi32(_mm512_sub_epi32(k1, k0), frac_w0));
+    return _mm512_srli_epi32(k0, PRECISION * 2);
+}
+
+static bool SDL_TARGETING("avx512f") scale_mat_AVX512F(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
+{
+    BILINEAR___START
+
+    const __m512i v_lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i v_fp_offset = _mm512_mullo_epi32(v_lane, _mm512_set1_epi32(fp_step_w));
+    const __m512i v_frac_mask = _mm512_set1_epi32(FRAC_ONE - 1);
+    const __m512i v_mask = _mm512_set1_epi32(0x00FF00FF);
+    const __m512i v_low = _mm512_set1_epi32(0xFFFF);
+
+    for (i = y_start; i < y_end; i++) {
+        int nb_block16;
+        __m128i v_frac_h0;
+        __m128i v_frac_h1;
+        __m128i zero;
+        __m512i v512_frac_h0;
+
+        BILINEAR___HEIGHT
+
+        nb_block16 = middle / 16;
+        middle &= 15;
+
+        v_frac_h0 = _mm_set1_epi16((short)frac_h0);
+        v_frac_h1 = _mm_set1_epi16((short)frac_h1);
+        zero = _mm_setzero_si128();
+        v512_frac_h0 = _mm512_set1_epi32(frac_h0);
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (nb_block16--) {
+            __m512i v_fp, v_index, v_frac_w0;
+            __m512i x00, x01, x10, x11;
+            __m512i k0_02, k1_02, k0_13, k1_13;
+            __m512i c0, c1, c2, c3;
+
+            // The middle section never goes past the last source column,
+            // so the fixed point positions fit in 32 bits.
+            v_fp = _mm512_add_epi32(_mm512_set1_epi32((int)(Uint32)fp_sum_w), v_fp_offset);
+            fp_sum_w += 16 * (Sint64)fp_step_w;
+
+            v_index = _mm512_slli_epi32(_mm512_srli_epi32(v_fp, 16), 2);
+            v_frac_w0 = _mm512_and_si512(_mm512_srli_epi32(v_fp, 16 - PRECISION), v_frac_mask);
+
+            x00 = _mm512_i32gather_epi32(v_index, (const void *)src_h0, 1);
+            x01 = _mm512_i32gather_epi32(v_index, (const void *)(src_h0 + 1), 1);
+            x10 = _mm512_i32gather_epi32(v_index, (const void *)src_h1, 1);
+            x11 = _mm512_i32gather_epi32(v_index, (const void *)(src_h1 + 1), 1);
+
+            // Interpolation vertical, channels 0 and 2, then 1 and 3
+            k0_02 = INTERPOL_VERTICAL_AVX512(_mm512_and_si512(x00, v_mask), _mm512_and_si512(x10, v_mask), v512_frac_h0);
+            k1_02 = INTERPOL_VERTICAL_AVX512(_mm512_and_si512(x01, v_mask), _mm512_and_si512(x11, v_mask), v512_frac_h0);
+            k0_13 = INTERPOL_VERTICAL_AVX512(_mm512_and_si512(_mm512_srli_epi32(x00, 8), v_mask), _mm512_and_si512(_mm512_srli_epi32(x10, 8), v_mask), v512_frac_h0);
+            k1_13 = INTERPOL_VERTICAL_AVX512(_mm512_and_si512(_mm512_srli_epi32(x01, 8), v_mask), _mm512_and_si512(_mm512_srli_epi32(x11, 8), v_mask), v512_frac_h0);
+
+            // Interpolation horizontal
+            c0 = INTERPOL_HORIZONTAL_AVX512(_mm512_and_si512(k0_02, v_low), _mm512_and_si512(k1_02, v_low), v_frac_w0);
+            c1 = INTERPOL_HORIZONTAL_AVX512(_mm512_and_si512(k0_13, v_low), _mm512_and_si512(k1_13, v_low), v_frac_w0);
+            c2 = INTERPOL_HORIZONTAL_AVX512(_mm512_srli_epi32(k0_02, 16), _mm512_srli_epi32(k1_02, 16), v_frac_w0);
+            c3 = INTERPOL_HORIZONTAL_AVX512(_mm512_srli_epi32(k0_13, 16), _mm512_srli_epi32(k1_13, 16), v_frac_w0);
+
+            // Store 16 pixels
+            c0 = _mm512_or_si512(_mm512_or_si512(c0, _mm512_slli_epi32(c1, 8)),
+                                 _mm512_or_si512(_mm512_slli_epi32(c2, 16), _mm512_slli_epi32(c3, 24)));
+            _mm512_storeu_si512((void *)dst, c0);
+            dst += 16;
+        }
+
+        while (middle--) {
+            const Uint32 *s_00_01;
+            const Uint32 *s_10_11;
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return true;
+}
+#endif
+
 #ifdef SDL_NEON_INTRINSICS
 
 static SDL_INLINE int hasNEON(void)
@@ -611,11 +955,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -831,33 +1175,41 @@ static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitc
 
 bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    bool result = false;
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
+    SDL_StretchFunc func = NULL;
     int src_pitch = s->pitch;
     int dst_pitch = d->pitch;
     Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
 
 #ifdef SDL_NEON_INTRINSICS
-    if (!result && hasNEON()) {
-        result = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!func && hasNEON()) {
+        func = scale_mat_NEON;
+    }
+#endif
+
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX512F_INTRINSICS)
+    if (!func && hasAVX512F()) {
+        func = scale_mat_AVX512F;
+    }
+#endif
+
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+    if (!func && hasAVX2()) {
+        func = scale_mat_AVX2;
     }
 #endif
 
 #ifdef SDL_SSE2_INTRINSICS
-    if (!result && hasSSE2()) {
-        result = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!func && hasSSE2()) {
+        func = scale_mat_SSE;
     }
 #endif
 
-    if (!result) {
-        result = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!func) {
+        func = scale_mat;
     }
 
-    return result;
+    return SDL_StretchRows(func, src, srcrect->w, srcrect->h, src_pitch, dst, dstrect->w, dstrect->h, dst_pitch);
 }
 
 #define SDL_SCALE_NEAREST__START          \
@@ -870,7 +1222,8 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + y_start * incy;     \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y_start * dst_pitch);
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -879,11 +1232,11 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     posx = incx / 2;                                                      \
     n = dst_w;
 
-static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -898,11 +1251,11 @@ static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -917,11 +1270,11 @@ static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -938,11 +1291,11 @@ static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -959,10 +1312,7 @@ static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
 
 bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
+    SDL_StretchFunc func;
     int src_pitch = s->pitch;
     int dst_pitch = d->pitch;
     int bpp = SDL_BYTESPERPIXEL(d->format);
@@ -971,12 +1321,14 @@ bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect,
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        func = scale_mat_nearest_4;
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        func = scale_mat_nearest_3;
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        func = scale_mat_nearest_2;
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        func = scale_mat_nearest_1;
     }
+
+    return SDL_StretchRows(func, src, srcrect->w, srcrect->h, src_pitch, dst, dstrect->w, dstrect->h, dst_pitch);
 }
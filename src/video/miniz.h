@@ -176,7 +176,14 @@
 //#define MINIZ_NO_DEFLATE_APIS
 
 // Define MINIZ_NO_INFLATE_APIS to disable all decompression API's.
+//#define MINIZ_NO_INFLATE_APIS
+
+// SDL: the PNG writer only needs compression and the pack file storage only needs decompression.
+#ifdef MINIZ_SDL_INFLATE_ONLY
+#define MINIZ_NO_DEFLATE_APIS
+#else
 #define MINIZ_NO_INFLATE_APIS
+#endif
 
 // Define MINIZ_NO_ARCHIVE_APIS to disable all ZIP archive API's.
 #define MINIZ_NO_ARCHIVE_APIS
@@ -258,11 +265,15 @@ extern "C" {
 typedef unsigned long mz_ulong;
 
 // mz_free() internally uses the MZ_FREE() macro (which by default calls free() unless you've modified the MZ_MALLOC macro) to release a block allocated from the heap.
+#ifndef MINIZ_SDL_INFLATE_ONLY
 MINIZ_STATIC void mz_free(void *p);
+#endif
 
 #define MZ_ADLER32_INIT (1)
 // mz_adler32() returns the initial adler-32 value to use when called with ptr==NULL.
+#ifndef MINIZ_SDL_INFLATE_ONLY
 MINIZ_STATIC mz_ulong mz_adler32(mz_ulong adler, const unsigned char *ptr, size_t buf_len);
+#endif
 
 #define MZ_CRC32_INIT (0)
 // mz_crc32() returns the initial CRC-32 value to use when called with ptr==NULL.
@@ -743,7 +754,9 @@ enum
 //  Function returns a pointer to the decompressed data, or NULL on failure.
 //  *pOut_len will be set to the decompressed data's size, which could be larger than src_buf_len on uncompressible data.
 //  The caller must call mz_free() on the returned block when it's no longer needed.
+#ifndef MINIZ_SDL_NOUNUSED
 MINIZ_STATIC void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, size_t *pOut_len, int flags);
+#endif
 
 // tinfl_decompress_mem_to_mem() decompresses a block in memory to another block in memory.
 // Returns TINFL_DECOMPRESS_MEM_TO_MEM_FAILED on failure, or the number of bytes written on success.
@@ -753,7 +766,9 @@ MINIZ_STATIC size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_l
 // tinfl_decompress_mem_to_callback() decompresses a block in memory to an internal 32KB buffer, and a user provided callback function will be called to flush the buffer.
 // Returns 1 on success or 0 on failure.
 typedef int (*tinfl_put_buf_func_ptr)(const void* pBuf, int len, void *pUser);
+#ifndef MINIZ_SDL_NOUNUSED
 MINIZ_STATIC int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size, tinfl_put_buf_func_ptr pPut_buf_func, void *pPut_buf_user, int flags);
+#endif
 
 struct tinfl_decompressor_tag; typedef struct tinfl_decompressor_tag tinfl_decompressor;
 
@@ -1049,6 +1064,7 @@ typedef unsigned char mz_validate_uint64[sizeof(mz_uint64)==8 ? 1 : -1];
 
 // ------------------- zlib-style API's
 
+#ifndef MINIZ_SDL_INFLATE_ONLY
 mz_ulong mz_adler32(mz_ulong adler, const unsigned char *ptr, size_t buf_len)
 {
   mz_uint32 i, s1 = (mz_uint32)(adler & 0xffff), s2 = (mz_uint32)(adler >> 16); size_t block_len = buf_len % 5552;
@@ -1063,6 +1079,7 @@ mz_ulong mz_adler32(mz_ulong adler, const unsigned char *ptr, size_t buf_len)
   }
   return (s2 << 16) + s1;
 }
+#endif
 
 // Karl Malbrain's compact CRC-32. See "A compact CCITT crc16 and crc32 C implementation that balances processor cache usage against speed": http://www.geocities.com/malbrain/
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8 *ptr, size_t buf_len)
@@ -1075,10 +1092,12 @@ mz_ulong mz_crc32(mz_ulong crc, const mz_uint8 *ptr, size_t buf_len)
   return ~crcu32;
 }
 
+#ifndef MINIZ_SDL_INFLATE_ONLY
 MINIZ_STATIC void mz_free(void *p)
 {
   MZ_FREE(p);
 }
+#endif
 
 #ifndef MINIZ_NO_ZLIB_APIS
 
@@ -1789,6 +1808,7 @@ common_exit:
 }
 
 // Higher level helper functions.
+#ifndef MINIZ_SDL_NOUNUSED
 void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, size_t *pOut_len, int flags)
 {
   tinfl_decompressor decomp; void *pBuf = NULL, *pNew_buf; size_t src_buf_ofs = 0, out_buf_capacity = 0;
@@ -1817,6 +1837,8 @@ void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, siz
   return pBuf;
 }
 
+#endif /* MINIZ_SDL_NOUNUSED */
+
 size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_len, const void *pSrc_buf, size_t src_buf_len, int flags)
 {
   tinfl_decompressor decomp; tinfl_status status; tinfl_init(&decomp);
@@ -1824,6 +1846,7 @@ size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_len, const voi
   return (status != TINFL_STATUS_DONE) ? TINFL_DECOMPRESS_MEM_TO_MEM_FAILED : out_buf_len;
 }
 
+#ifndef MINIZ_SDL_NOUNUSED
 int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size, tinfl_put_buf_func_ptr pPut_buf_func, void *pPut_buf_user, int flags)
 {
   int result = 0;
@@ -1852,6 +1875,7 @@ int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size,
   *pIn_buf_size = in_buf_ofs;
   return result;
 }
+#endif /* MINIZ_SDL_NOUNUSED */
 #endif /*#ifndef MINIZ_NO_INFLATE_APIS*/
 
 // ------------------- Low-level Compression (independent from all decompression API's)
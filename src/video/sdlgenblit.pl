@@ -33,12 +33,14 @@ my @src_formats = (
     "RGBA8888",
     "ABGR8888",
     "BGRA8888",
+    "ARGB2101010",
 );
 my @dst_formats = (
     "XRGB8888",
     "XBGR8888",
     "ARGB8888",
     "ABGR8888",
+    "ARGB2101010",
 );
 
 my %format_size = (
@@ -48,6 +50,7 @@ my %format_size = (
     "RGBA8888" => 4,
     "ABGR8888" => 4,
     "BGRA8888" => 4,
+    "ARGB2101010" => 4,
 );
 
 my %format_type = (
@@ -57,6 +60,7 @@ my %format_type = (
     "RGBA8888" => "Uint32",
     "ABGR8888" => "Uint32",
     "BGRA8888" => "Uint32",
+    "ARGB2101010" => "Uint32",
 );
 
 my %get_rgba_string_ignore_alpha = (
@@ -66,6 +70,7 @@ my %get_rgba_string_ignore_alpha = (
     "RGBA8888" => "__R = (Uint8)(__pixel_ >> 24); __G = (Uint8)(__pixel_ >> 16); __B = (Uint8)(__pixel_ >> 8);",
     "ABGR8888" => "__B = (Uint8)(__pixel_ >> 16); __G = (Uint8)(__pixel_ >> 8); __R = (Uint8)__pixel_;",
     "BGRA8888" => "__B = (Uint8)(__pixel_ >> 24); __G = (Uint8)(__pixel_ >> 16); __R = (Uint8)(__pixel_ >> 8);",
+    "ARGB2101010" => "__R = (Uint8)(__pixel_ >> 22); __G = (Uint8)(__pixel_ >> 12); __B = (Uint8)(__pixel_ >> 2);",
 );
 
 my %get_rgba_string = (
@@ -75,6 +80,7 @@ my %get_rgba_string = (
     "RGBA8888" => $get_rgba_string_ignore_alpha{"RGBA8888"} . " __A = (Uint8)__pixel_;",
     "ABGR8888" => $get_rgba_string_ignore_alpha{"ABGR8888"} . " __A = (Uint8)(__pixel_ >> 24);",
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " __A = (Uint8)__pixel_;",
+    "ARGB2101010" => $get_rgba_string_ignore_alpha{"ARGB2101010"} . " __A = SDL_expand_byte[2][__pixel_ >> 30];",
 );
 
 my %set_rgba_string = (
@@ -84,6 +90,7 @@ my %set_rgba_string = (
     "RGBA8888" => "__pixel_ = (__R << 24) | (__G << 16) | (__B << 8) | __A;",
     "ABGR8888" => "__pixel_ = (__A << 24) | (__B << 16) | (__G << 8) | __R;",
     "BGRA8888" => "__pixel_ = (__B << 24) | (__G << 16) | (__R << 8) | __A;",
+    "ARGB2101010" => "__pixel_ = ((__A * 3 / 255) << 30) | ((__R ? ((__R << 2) | 0x3) : 0) << 20) | ((__G ? ((__G << 2) | 0x3) : 0) << 10) | (__B ? ((__B << 2) | 0x3) : 0);",
 );
 
 sub open_file {
@@ -150,6 +157,7 @@ sub output_copyfuncname
     my $dst = shift;
     my $modulate = shift;
     my $blend = shift;
+    my $colorkey = shift;
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
@@ -161,6 +169,9 @@ sub output_copyfuncname
     if ( $blend ) {
         print FILE "_Blend";
     }
+    if ( $colorkey ) {
+        print FILE "_Colorkey";
+    }
     if ( $scale ) {
         print FILE "_Scale";
     }
@@ -185,9 +196,9 @@ sub get_rgba
 
     $string =~ s/__/$prefix/g;
     if ( $prefix eq "" ) {
-        $string =~ s/_/value/g;
+        $string =~ s/pixel_/pixelvalue/g;
     } else {
-        $string =~ s/_//g;
+        $string =~ s/pixel_/pixel/g;
     }
     if ( $prefix ne "" ) {
         print FILE <<__EOF__;
@@ -212,9 +223,9 @@ sub set_rgba
     $string =~ s/__/$prefix/g;
     if ( $prefix eq "" ) {
         $suffix = "value";
-        $string =~ s/_/value/g;
+        $string =~ s/pixel_/pixelvalue/g;
     } else {
-        $string =~ s/_//g;
+        $string =~ s/pixel_/pixel/g;
     }
     print FILE <<__EOF__;
             $string
@@ -456,6 +467,24 @@ __EOF__
 __EOF__
         }
 
+        print FILE <<__EOF__;
+                break;
+            default:
+                ${d}R = ${s}R;
+                ${d}G = ${s}G;
+                ${d}B = ${s}B;
+__EOF__
+        if ( $dst_has_alpha ) {
+            if ($A_is_const_FF) {
+                print FILE <<__EOF__;
+                ${d}A = 0xFF;
+__EOF__
+            } else {
+                print FILE <<__EOF__;
+                ${d}A = ${s}A;
+__EOF__
+            }
+        }
         print FILE <<__EOF__;
                 break;
             }
@@ -474,6 +503,7 @@ sub output_copyfunc
     my $dst = shift;
     my $modulate = shift;
     my $blend = shift;
+    my $colorkey = shift;
     my $scale = shift;
 
     my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
@@ -492,10 +522,16 @@ sub output_copyfunc
     $da =~ s/[XA8]//g;
     $matching_colors = (!$modulate && !$blend && ($sa eq $da)) ? 1 : 0;
 
-    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n");
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $colorkey, $scale, 1, "\n");
     print FILE <<__EOF__;
 {
 __EOF__
+    if ( $colorkey ) {
+        print FILE <<__EOF__;
+    const Uint32 rgbmask = ~info->src_fmt->Amask;
+    const Uint32 ckey = info->colorkey & rgbmask;
+__EOF__
+    }
     if ( $modulate || $blend ) {
         print FILE <<__EOF__;
     const int flags = info->flags;
@@ -603,8 +639,15 @@ __EOF__
             srcx = posx >> 16;
             src = ($format_type{$src} *)(info->src + (srcy * info->src_pitch) + (srcx * $format_size{$src}));
 __EOF__
-        print FILE <<__EOF__;
+        if ( $colorkey ) {
+            print FILE <<__EOF__;
+            if ((*src & rgbmask) == ckey) {
+                posx += incx;
+                ++dst;
+                continue;
+            }
 __EOF__
+        }
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
             posx += incx;
@@ -623,6 +666,15 @@ __EOF__
         int n = info->dst_w;
         while (n--) {
 __EOF__
+        if ( $colorkey ) {
+            print FILE <<__EOF__;
+            if ((*src & rgbmask) == ckey) {
+                ++src;
+                ++dst;
+                continue;
+            }
+__EOF__
+        }
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
             ++src;
@@ -669,10 +721,12 @@ __EOF__
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
             my $dst = $dst_formats[$j];
+            # The colorkey variants go last, so they're only picked for colorkey blits
+            for (my $colorkey = 0; $colorkey <= 1; ++$colorkey) {
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
-                        if ( $modulate || $blend || $scale ) {
+                        if ( want_copyfunc($modulate, $blend, $colorkey, $scale) ) {
                             print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
@@ -692,6 +746,14 @@ __EOF__
                                     $flags = "$flags | $flag";
                                 }
                             }
+                            if ( $colorkey ) {
+                                $flag = "SDL_COPY_COLORKEY";
+                                if ( $flags eq "" ) {
+                                    $flags = $flag;
+                                } else {
+                                    $flags = "$flags | $flag";
+                                }
+                            }
                             if ( $scale ) {
                                 $flag = "SDL_COPY_NEAREST";
                                 if ( $flags eq "" ) {
@@ -704,11 +766,12 @@ __EOF__
                                 $flags = "0";
                             }
                             print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $colorkey, $scale, 0, " },\n");
                         }
                     }
                 }
             }
+            }
         }
     }
     print FILE <<__EOF__;
@@ -718,16 +781,35 @@ __EOF__
 __EOF__
 }
 
+sub want_copyfunc
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $colorkey = shift;
+    my $scale = shift;
+
+    # SDL_ChooseBlitFunc() takes the first entry whose flags cover the
+    # requested ones, so every combination needs its own colorkey variant.
+    # Otherwise colorkey blits without blending would end up in a blend
+    # variant, which doesn't draw anything without a blend mode.
+    if ( $colorkey ) {
+        return 1;
+    }
+    return ( $modulate || $blend || $scale );
+}
+
 sub output_copyfunc_c
 {
     my $src = shift;
     my $dst = shift;
 
-    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
-        for (my $blend = 0; $blend <= 1; ++$blend) {
-            for (my $scale = 0; $scale <= 1; ++$scale) {
-                if ( $modulate || $blend || $scale ) {
-                    output_copyfunc($src, $dst, $modulate, $blend, $scale);
+    for (my $colorkey = 0; $colorkey <= 1; ++$colorkey) {
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( want_copyfunc($modulate, $blend, $colorkey, $scale) ) {
+                        output_copyfunc($src, $dst, $modulate, $blend, $colorkey, $scale);
+                    }
                 }
             }
         }
@@ -0,0 +1,395 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Read a file in many small pieces with async I/O, one request at a time and
+   in batches, then the first few pieces again into a small registered buffer,
+   and check that all of them get the same data.
+   Then read it again on a low and a high priority queue at the same time and
+   report the queue statistics, and finally mix reads and writes that start
+   right where the previous transfer ended. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define TEST_FILENAME "asynciobatch.tmp"
+
+static int chunk_size = 4096;
+static int num_chunks = 4096;
+
+/* Registered buffers are pinned and count against RLIMIT_MEMLOCK, so keep them small */
+#define REGISTERED_CHUNKS 4
+
+static bool CreateTestFile(void)
+{
+    const size_t size = (size_t)chunk_size * num_chunks;
+    Uint8 *data = (Uint8 *)SDL_malloc(size);
+    Uint32 seed = 0x12345678;
+    bool result;
+    size_t i;
+
+    if (!data) {
+        return false;
+    }
+    for (i = 0; i < size; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (Uint8)(seed >> 24);
+    }
+    result = SDL_SaveFile(TEST_FILENAME, data, size);
+    SDL_free(data);
+    return result;
+}
+
+static bool ReadChunks(SDL_AsyncIOQueue *queue, Uint8 *buffer, int count, bool batch, Uint64 *elapsed)
+{
+    SDL_AsyncIO *asyncio = SDL_AsyncIOFromFile(TEST_FILENAME, "r");
+    Uint64 start;
+    int i, pending = 0;
+    bool result = true;
+
+    if (!asyncio) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s", TEST_FILENAME, SDL_GetError());
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    if (batch) {
+        SDL_BeginAsyncIOBatch(queue);
+    }
+    for (i = 0; i < count; ++i) {
+        const Uint64 offset = (Uint64)i * chunk_size;
+        if (!SDL_ReadAsyncIO(asyncio, buffer + offset, offset, chunk_size, queue, NULL)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadAsyncIO() failed: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+        ++pending;
+    }
+    if (batch) {
+        SDL_SubmitAsyncIOBatch(queue);
+    }
+
+    while (pending > 0) {
+        SDL_AsyncIOOutcome outcome;
+        if (SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+            if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != outcome.bytes_requested) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Read at offset %" SDL_PRIu64 " failed", outcome.offset);
+                result = false;
+            }
+            --pending;
+        }
+    }
+    *elapsed = SDL_GetTicksNS() - start;
+
+    if (SDL_CloseAsyncIO(asyncio, false, queue, NULL)) {
+        SDL_AsyncIOOutcome outcome;
+        SDL_WaitAsyncIOResult(queue, &outcome, -1);
+    }
+    return result;
+}
+
+static bool CheckStats(SDL_AsyncIOQueue *queue, const char *name)
+{
+    SDL_AsyncIOQueueStats stats;
+
+    if (!SDL_GetAsyncIOQueueStats(queue, &stats)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_GetAsyncIOQueueStats() failed: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_Log("%s queue: %" SDL_PRIu64 " tasks, max depth %d, average latency %" SDL_PRIu64 " us, max latency %" SDL_PRIu64 " us",
+            name, stats.tasks_completed, stats.max_tasks_pending,
+            stats.tasks_completed ? (stats.total_latency_ns / stats.tasks_completed) / SDL_NS_PER_US : 0,
+            stats.max_latency_ns / SDL_NS_PER_US);
+
+    if (stats.tasks_started != stats.tasks_completed || stats.tasks_pending != 0 || stats.max_tasks_pending <= 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s queue statistics don't add up", name);
+        return false;
+    }
+    return true;
+}
+
+static bool ReadWithPriorities(Uint8 *low_buffer, Uint8 *high_buffer)
+{
+    SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_AsyncIOQueue *low = NULL, *high = NULL;
+    SDL_AsyncIO *asyncio = NULL;
+    int i, pending = 0;
+    bool result = false;
+
+    if (!props) {
+        return false;
+    }
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_PRIORITY_NUMBER, SDL_ASYNCIO_PRIORITY_LOW);
+    low = SDL_CreateAsyncIOQueueWithProperties(props);
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_PRIORITY_NUMBER, SDL_ASYNCIO_PRIORITY_HIGH);
+    high = SDL_CreateAsyncIOQueueWithProperties(props);
+    asyncio = SDL_AsyncIOFromFile(TEST_FILENAME, "r");
+    if (!low || !high || !asyncio) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up priority test: %s", SDL_GetError());
+        goto done;
+    }
+
+    /* Queue up the whole file as background work, then ask for it again urgently */
+    for (i = 0; i < num_chunks; ++i) {
+        const Uint64 offset = (Uint64)i * chunk_size;
+        if (!SDL_ReadAsyncIO(asyncio, low_buffer + offset, offset, chunk_size, low, NULL)) {
+            goto done;
+        }
+        ++pending;
+    }
+    for (i = 0; i < num_chunks; ++i) {
+        const Uint64 offset = (Uint64)i * chunk_size;
+        if (!SDL_ReadAsyncIO(asyncio, high_buffer + offset, offset, chunk_size, high, NULL)) {
+            goto done;
+        }
+        ++pending;
+    }
+
+    result = true;
+
+done:
+    while (pending > 0) {
+        SDL_AsyncIOOutcome outcome;
+        if (SDL_GetAsyncIOResult(high, &outcome) || SDL_WaitAsyncIOResult(low, &outcome, 1)) {
+            if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != outcome.bytes_requested) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Read at offset %" SDL_PRIu64 " failed", outcome.offset);
+                result = false;
+            }
+            --pending;
+        }
+    }
+    if (asyncio && SDL_CloseAsyncIO(asyncio, false, low, NULL)) {
+        SDL_AsyncIOOutcome outcome;
+        SDL_WaitAsyncIOResult(low, &outcome, -1);
+    }
+    if (result) {
+        result = CheckStats(high, "High priority") && CheckStats(low, "Low priority");
+    }
+    SDL_DestroyAsyncIOQueue(low);
+    SDL_DestroyAsyncIOQueue(high);
+    SDL_DestroyProperties(props);
+    return result;
+}
+
+static bool TransferChunk(SDL_AsyncIOQueue *queue, SDL_AsyncIO *asyncio, bool write, Uint8 *buffer, int chunk)
+{
+    const Uint64 offset = (Uint64)chunk * chunk_size;
+    SDL_AsyncIOOutcome outcome;
+    bool result;
+
+    if (write) {
+        result = SDL_WriteAsyncIO(asyncio, buffer, offset, chunk_size, queue, NULL);
+    } else {
+        result = SDL_ReadAsyncIO(asyncio, buffer, offset, chunk_size, queue, NULL);
+    }
+    if (!result || !SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't %s chunk %d: %s", write ? "write" : "read", chunk, SDL_GetError());
+        return false;
+    }
+    if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != outcome.bytes_requested) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s of chunk %d failed", write ? "Write" : "Read", chunk);
+        return false;
+    }
+    return true;
+}
+
+static bool ReadAfterWrite(SDL_AsyncIOQueue *queue, const Uint8 *expected)
+{
+    SDL_AsyncIO *asyncio;
+    Uint8 *buffer, *pattern;
+    bool result = false;
+
+    if (num_chunks < 4) {
+        return true;
+    }
+
+    asyncio = SDL_AsyncIOFromFile(TEST_FILENAME, "r+");
+    buffer = (Uint8 *)SDL_malloc(chunk_size);
+    pattern = (Uint8 *)SDL_malloc(chunk_size);
+    if (!asyncio || !buffer || !pattern) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up read/write test: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_memset(pattern, 0xA5, chunk_size);
+
+    /* Each transfer starts where the previous one ended, switching between writing and reading */
+    if (!TransferChunk(queue, asyncio, true, pattern, 0) ||
+        !TransferChunk(queue, asyncio, false, buffer, 1)) {
+        goto done;
+    }
+    if (SDL_memcmp(buffer, expected + chunk_size, chunk_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Read right after a write returned the wrong data");
+        goto done;
+    }
+    if (!TransferChunk(queue, asyncio, true, pattern, 2) ||
+        !TransferChunk(queue, asyncio, false, buffer, 3)) {
+        goto done;
+    }
+    if (SDL_memcmp(buffer, expected + 3 * chunk_size, chunk_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Read right after a write returned the wrong data");
+        goto done;
+    }
+
+    /* Both writes have to have landed where they were asked to go */
+    if (!TransferChunk(queue, asyncio, false, buffer, 2)) {
+        goto done;
+    }
+    if (SDL_memcmp(buffer, pattern, chunk_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Write right after a read went to the wrong place");
+        goto done;
+    }
+    if (!TransferChunk(queue, asyncio, false, buffer, 0)) {
+        goto done;
+    }
+    if (SDL_memcmp(buffer, pattern, chunk_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Write didn't land where it was asked to go");
+        goto done;
+    }
+    result = true;
+
+done:
+    if (asyncio && SDL_CloseAsyncIO(asyncio, false, queue, NULL)) {
+        SDL_AsyncIOOutcome outcome;
+        SDL_WaitAsyncIOResult(queue, &outcome, -1);
+    }
+    SDL_free(buffer);
+    SDL_free(pattern);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AsyncIOQueue *queue = NULL;
+    SDL_PropertiesID props = 0;
+    Uint8 *unbatched = NULL, *batched = NULL, *registered = NULL;
+    Uint64 unbatched_time = 0, batched_time = 0, registered_time = 0;
+    size_t size, registered_size;
+    bool sqpoll = false;
+    int result = 1;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--chunk-size") == 0 && argv[i + 1]) {
+                chunk_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--chunks") == 0 && argv[i + 1]) {
+                num_chunks = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--sqpoll") == 0) {
+                sqpoll = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || chunk_size <= 0 || num_chunks < REGISTERED_CHUNKS) {
+            static const char *options[] = { "[--chunk-size N]", "[--chunks N]", "[--sqpoll]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    size = (size_t)chunk_size * num_chunks;
+    unbatched = (Uint8 *)SDL_calloc(1, size);
+    batched = (Uint8 *)SDL_calloc(1, size);
+    registered_size = (size_t)chunk_size * REGISTERED_CHUNKS;
+    registered = (Uint8 *)SDL_calloc(1, registered_size);
+    props = SDL_CreateProperties();
+    if (!unbatched || !batched || !registered || !props || !CreateTestFile()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up test: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_ENTRIES_NUMBER, 256);
+    SDL_SetBooleanProperty(props, SDL_PROP_ASYNCIOQUEUE_CREATE_SQPOLL_BOOLEAN, sqpoll);
+    queue = SDL_CreateAsyncIOQueueWithProperties(props);
+    if (!queue) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateAsyncIOQueueWithProperties() failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    if (!ReadChunks(queue, unbatched, num_chunks, false, &unbatched_time)) {
+        goto done;
+    }
+    if (!ReadChunks(queue, batched, num_chunks, true, &batched_time)) {
+        goto done;
+    }
+
+    SDL_Log("%d reads of %d bytes: one at a time %" SDL_PRIu64 " us, batched %" SDL_PRIu64 " us",
+            num_chunks, chunk_size, unbatched_time / SDL_NS_PER_US, batched_time / SDL_NS_PER_US);
+
+    if (SDL_memcmp(unbatched, batched, size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Batched reads returned different data");
+        goto done;
+    }
+
+    if (!SDL_RegisterAsyncIOBuffers(queue, (void **)&registered, &registered_size, 1)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RegisterAsyncIOBuffers() failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (!ReadChunks(queue, registered, REGISTERED_CHUNKS, true, &registered_time)) {
+        goto done;
+    }
+    SDL_RegisterAsyncIOBuffers(queue, NULL, NULL, 0);
+
+    SDL_Log("%d reads of %d bytes into a registered buffer: %" SDL_PRIu64 " us",
+            REGISTERED_CHUNKS, chunk_size, registered_time / SDL_NS_PER_US);
+
+    if (SDL_memcmp(unbatched, registered, registered_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reads into a registered buffer returned different data");
+        goto done;
+    }
+    if (!CheckStats(queue, "Default")) {
+        goto done;
+    }
+
+    SDL_memset(batched, 0, size);
+    if (!ReadWithPriorities(batched, batched)) {
+        goto done;
+    }
+    if (SDL_memcmp(unbatched, batched, size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Prioritized reads returned different data");
+        goto done;
+    }
+    if (!ReadAfterWrite(queue, unbatched)) {
+        goto done;
+    }
+    result = 0;
+
+done:
+    SDL_DestroyAsyncIOQueue(queue);
+    SDL_DestroyProperties(props);
+    SDL_free(unbatched);
+    SDL_free(batched);
+    SDL_free(registered);
+    SDL_RemovePath(TEST_FILENAME);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,291 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measure the throughput of the audio sample format converters.
+
+   SDL picks its converters once per process, so to compare the scalar and
+   SIMD versions, --all-tiers re-runs this program with SDL_CPU_FEATURE_MASK
+   set for each tier, collects the output checksums each tier logs, and
+   fails if any tier differs from the scalar one. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define CHUNK_FRAMES 4096
+#define CHANNELS     2
+
+typedef struct
+{
+    SDL_AudioFormat src;
+    SDL_AudioFormat dst;
+} Conversion;
+
+static const Conversion conversions[] = {
+    { SDL_AUDIO_S8, SDL_AUDIO_F32 },
+    { SDL_AUDIO_U8, SDL_AUDIO_F32 },
+    { SDL_AUDIO_S16, SDL_AUDIO_F32 },
+    { SDL_AUDIO_S32, SDL_AUDIO_F32 },
+    { SDL_AUDIO_F32, SDL_AUDIO_S8 },
+    { SDL_AUDIO_F32, SDL_AUDIO_U8 },
+    { SDL_AUDIO_F32, SDL_AUDIO_S16 },
+    { SDL_AUDIO_F32, SDL_AUDIO_S32 },
+    { SDL_AUDIO_S16LE, SDL_AUDIO_S16BE },
+    { SDL_AUDIO_S32LE, SDL_AUDIO_S32BE },
+};
+
+static const char *tiers[][2] = {
+    { "scalar", "-all" },
+    { "sse2", "-all,+sse,+sse2" },
+    { "sse4.1", "-all,+sse,+sse2,+sse3,+sse41" },
+    { "avx2", "-all,+sse,+sse2,+sse3,+sse41,+sse42,+avx,+avx2" },
+    { "all", "all" },
+};
+
+static Uint32 Checksum(const Uint8 *data, int len, Uint32 crc)
+{
+    int i;
+
+    /* FNV-1a, just to spot differences between tiers */
+    for (i = 0; i < len; ++i) {
+        crc = (crc ^ data[i]) * 16777619u;
+    }
+    return crc;
+}
+
+static void FillSource(Uint8 *buf, int len, SDL_AudioFormat format)
+{
+    Uint32 seed = 0x12345678;
+    int i;
+
+    if (format == SDL_AUDIO_F32) {
+        float *samples = (float *)buf;
+        for (i = 0; i < len / 4; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            /* Include some out of range samples to exercise clamping */
+            samples[i] = ((float)(seed >> 8) / 8388608.0f - 1.0f) * 1.25f;
+        }
+    } else {
+        for (i = 0; i < len; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            buf[i] = (Uint8)(seed >> 24);
+        }
+    }
+}
+
+static bool RunConversion(const Conversion *conversion, Uint64 total_frames, bool print_checksum)
+{
+    const SDL_AudioSpec src_spec = { conversion->src, CHANNELS, 48000 };
+    const SDL_AudioSpec dst_spec = { conversion->dst, CHANNELS, 48000 };
+    const int src_len = CHUNK_FRAMES * SDL_AUDIO_FRAMESIZE(src_spec);
+    const int dst_len = CHUNK_FRAMES * SDL_AUDIO_FRAMESIZE(dst_spec);
+    SDL_AudioStream *stream;
+    Uint8 *src_buf, *dst_buf;
+    Uint64 frames, start, elapsed;
+    Uint32 crc = 2166136261u;
+    bool result = true;
+
+    stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    src_buf = (Uint8 *)SDL_malloc(src_len);
+    dst_buf = (Uint8 *)SDL_malloc(dst_len);
+    if (!stream || !src_buf || !dst_buf) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up conversion: %s", SDL_GetError());
+        result = false;
+        goto done;
+    }
+    FillSource(src_buf, src_len, conversion->src);
+
+    start = SDL_GetTicksNS();
+    for (frames = 0; frames < total_frames; frames += CHUNK_FRAMES) {
+        if (!SDL_PutAudioStreamData(stream, src_buf, src_len) ||
+            SDL_GetAudioStreamData(stream, dst_buf, dst_len) != dst_len) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Conversion failed: %s", SDL_GetError());
+            result = false;
+            goto done;
+        }
+        if (frames == 0) {
+            crc = Checksum(dst_buf, dst_len, crc);
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    SDL_Log("%-16s -> %-16s %8.1f Msamples/s  (checksum %08" SDL_PRIx32 ")",
+            SDL_GetAudioFormatName(conversion->src), SDL_GetAudioFormatName(conversion->dst),
+            (double)(frames * CHANNELS) * 1000.0 / (double)elapsed, crc);
+    if (print_checksum) {
+        SDL_Log("checksum %s %s %08" SDL_PRIx32,
+                SDL_GetAudioFormatName(conversion->src), SDL_GetAudioFormatName(conversion->dst), crc);
+    }
+
+done:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(src_buf);
+    SDL_free(dst_buf);
+    return result;
+}
+
+/* Logs the output of a tier and returns its checksum lines, in order */
+static char *GetChecksums(char *output)
+{
+    const size_t size = SDL_strlen(output) + 1;
+    char *checksums = (char *)SDL_malloc(size);
+    char *line, *next;
+
+    if (!checksums) {
+        return NULL;
+    }
+    *checksums = '\0';
+    for (line = output; *line; line = next) {
+        const char *checksum;
+
+        next = SDL_strchr(line, '\n');
+        if (next) {
+            *next++ = '\0';
+        } else {
+            next = line + SDL_strlen(line);
+        }
+        SDL_Log("%s", line);
+
+        checksum = SDL_strstr(line, "checksum ");
+        if (checksum && (checksum == line || checksum[-1] != '(')) {
+            SDL_strlcat(checksums, checksum, size);
+            SDL_strlcat(checksums, "\n", size);
+        }
+    }
+    return checksums;
+}
+
+static bool RunAllTiers(const char *program, int total_frames)
+{
+    char frames[32];
+    char *reference = NULL;
+    bool result = true;
+    int i;
+
+    SDL_snprintf(frames, sizeof(frames), "%d", total_frames);
+
+    for (i = 0; i < SDL_arraysize(tiers); ++i) {
+        const char *args[] = { program, "--frames", frames, "--checksums", NULL };
+        SDL_Environment *env = SDL_CreateEnvironment(true);
+        SDL_PropertiesID props = SDL_CreateProperties();
+        SDL_Process *process = NULL;
+        char *output = NULL;
+        int exitcode = 1;
+
+        SDL_Log("=== %s ===", tiers[i][0]);
+
+        if (env && props) {
+            SDL_SetEnvironmentVariable(env, "SDL_CPU_FEATURE_MASK", tiers[i][1], true);
+            SDL_SetPointerProperty(props, SDL_PROP_PROCESS_CREATE_ARGS_POINTER, (void *)args);
+            SDL_SetPointerProperty(props, SDL_PROP_PROCESS_CREATE_ENVIRONMENT_POINTER, env);
+            SDL_SetNumberProperty(props, SDL_PROP_PROCESS_CREATE_STDOUT_NUMBER, SDL_PROCESS_STDIO_APP);
+            SDL_SetBooleanProperty(props, SDL_PROP_PROCESS_CREATE_STDERR_TO_STDOUT_BOOLEAN, true);
+            process = SDL_CreateProcessWithProperties(props);
+        }
+        if (process) {
+            char *log = (char *)SDL_ReadProcess(process, NULL, &exitcode);
+            if (log) {
+                output = GetChecksums(log);
+                SDL_free(log);
+            }
+            SDL_DestroyProcess(process);
+        } else {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run %s: %s", program, SDL_GetError());
+        }
+        if (exitcode != 0 || !output) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Tier %s failed with exit code %d", tiers[i][0], exitcode);
+            result = false;
+        } else if (!reference) {
+            /* The first tier is scalar, everything else is compared against it */
+            reference = output;
+            output = NULL;
+        } else if (SDL_strcmp(output, reference) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Tier %s output doesn't match %s:\n%s\nexpected:\n%s",
+                         tiers[i][0], tiers[0][0], output, reference);
+            result = false;
+        }
+
+        SDL_free(output);
+        SDL_DestroyProperties(props);
+        SDL_DestroyEnvironment(env);
+    }
+    SDL_free(reference);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int total_frames = 48000 * 60;
+    bool all_tiers = false;
+    bool print_checksums = false;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                total_frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--all-tiers") == 0) {
+                all_tiers = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--checksums") == 0) {
+                print_checksums = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || total_frames <= 0) {
+            static const char *options[] = { "[--frames N]", "[--all-tiers]", "[--checksums]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (all_tiers) {
+        if (!RunAllTiers(argv[0], total_frames)) {
+            result = 1;
+        }
+    } else {
+        SDL_Log("Converting %d frames of %d channel audio, SSE2:%d SSE4.1:%d AVX2:%d NEON:%d",
+                total_frames, CHANNELS, SDL_HasSSE2(), SDL_HasSSE41(), SDL_HasAVX2(), SDL_HasNEON());
+        for (i = 0; i < SDL_arraysize(conversions); ++i) {
+            if (!RunConversion(&conversions[i], (Uint64)total_frames, print_checksums)) {
+                result = 1;
+                break;
+            }
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -1470,6 +1470,63 @@ cleanup:
 
     return status;
 }
+/**
+ * Check that SDL_MixAudio() with float32 audio adds and clamps exactly like the
+ * straightforward scalar code, whatever alignment and length the buffers have.
+ *
+ * \sa SDL_MixAudio
+ */
+static int SDLCALL audio_mixFloat32(void *arg)
+{
+    static const float volumes[] = { 1.0f, 0.5f, 0.3f, 1.75f };
+    static const int lengths[] = { 1, 3, 16, 31, 64, 1000, 1027 };
+    const int max_samples = 1027 + 1;
+    float *src = (float *)SDL_malloc(max_samples * sizeof(float));
+    float *dst = (float *)SDL_malloc(max_samples * sizeof(float));
+    float *expected = (float *)SDL_malloc(max_samples * sizeof(float));
+    int i, j, k, offset;
+
+    SDLTest_AssertCheck(src && dst && expected, "Allocate test buffers");
+    if (!src || !dst || !expected) {
+        SDL_free(src);
+        SDL_free(dst);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(volumes); ++i) {
+        for (j = 0; j < SDL_arraysize(lengths); ++j) {
+            for (offset = 0; offset <= 1; ++offset) {
+                const int num_samples = lengths[j];
+                int mismatches = 0;
+
+                for (k = 0; k < max_samples; ++k) {
+                    src[k] = SDLTest_RandomUnitFloat() * 3.0f - 1.5f;
+                    dst[k] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                }
+                for (k = 0; k < num_samples; ++k) {
+                    const float sample = dst[offset + k] + (src[offset + k] * volumes[i]);
+                    expected[k] = (sample > 1.0f) ? 1.0f : (sample < -1.0f) ? -1.0f : sample;
+                }
+
+                SDL_MixAudio((Uint8 *)&dst[offset], (const Uint8 *)&src[offset], SDL_AUDIO_F32, num_samples * sizeof(float), volumes[i]);
+                for (k = 0; k < num_samples; ++k) {
+                    if (SDL_memcmp(&dst[offset + k], &expected[k], sizeof(float)) != 0) {
+                        ++mismatches;
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Mix %d samples at offset %d with volume %f, expected 0 mismatches, got %d",
+                                    num_samples, offset, volumes[i], mismatches);
+            }
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1477,6 +1534,695 @@ static const SDLTest_TestCaseReference audioTestGetAudioFormatName = {
     audio_getAudioFormatName, "audio_getAudioFormatName", "Call to SDL_GetAudioFormatName", TEST_ENABLED
 };
 
+/* Writes a small WAVE file into memory. */
+static SDL_IOStream *CreateTestWAV(Uint16 encoding, Uint16 channels, Uint16 bitspersample, const Uint8 *data, Uint32 length)
+{
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    const Uint16 blockalign = (Uint16)(channels * bitspersample / 8);
+    const Uint32 freq = 22050;
+
+    if (!io) {
+        return NULL;
+    }
+    SDL_WriteIO(io, "RIFF", 4);
+    SDL_WriteU32LE(io, 4 + (8 + 16) + (8 + length));
+    SDL_WriteIO(io, "WAVEfmt ", 8);
+    SDL_WriteU32LE(io, 16);
+    SDL_WriteU16LE(io, encoding);
+    SDL_WriteU16LE(io, channels);
+    SDL_WriteU32LE(io, freq);
+    SDL_WriteU32LE(io, freq * blockalign);
+    SDL_WriteU16LE(io, blockalign);
+    SDL_WriteU16LE(io, bitspersample);
+    SDL_WriteIO(io, "data", 4);
+    SDL_WriteU32LE(io, length);
+    SDL_WriteIO(io, data, length);
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+    return io;
+}
+
+/**
+ * Check that streaming a WAVE file gives the same audio as loading it.
+ *
+ * \sa SDL_CreateAudioStreamFromWAV_IO
+ * \sa SDL_LoadWAV_IO
+ */
+static int SDLCALL audio_streamWAV(void *arg)
+{
+    static const struct
+    {
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bitspersample;
+    } formats[] = {
+        { 0x0001, 2, 16 }, /* PCM */
+        { 0x0001, 1, 24 }, /* PCM, expanded to 32 bits */
+        { 0x0001, 2, 8 },  /* PCM */
+        { 0x0003, 2, 32 }, /* IEEE float */
+        { 0x0007, 2, 8 },  /* mu-law */
+        { 0x0006, 1, 8 },  /* A-law */
+    };
+    const Uint32 length = 6 * 10001; /* Several decoder steps, not a multiple of the step size. */
+    Uint8 *data = (Uint8 *)SDL_malloc(length);
+    int i;
+    Uint32 j;
+
+    SDLTest_AssertCheck(data != NULL, "Allocate test data");
+    if (!data) {
+        return TEST_ABORTED;
+    }
+    for (j = 0; j < length; ++j) {
+        data[j] = (Uint8)SDLTest_RandomUint8();
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_IOStream *io;
+        SDL_AudioSpec spec;
+        Uint8 *expected = NULL;
+        Uint32 expected_len = 0;
+        SDL_AudioStream *stream;
+        Uint8 *actual;
+        int actual_len = 0;
+        bool result;
+
+        if (formats[i].encoding == 0x0003) {
+            /* Keep the float samples finite. */
+            for (j = 0; j + 4 <= length; j += 4) {
+                const float sample = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                SDL_memcpy(&data[j], &sample, sizeof(sample));
+            }
+        }
+
+        io = CreateTestWAV(formats[i].encoding, formats[i].channels, formats[i].bitspersample, data, length);
+        SDLTest_AssertCheck(io != NULL, "Create WAVE file %d", i);
+        if (!io) {
+            continue;
+        }
+
+        result = SDL_LoadWAV_IO(io, false, &spec, &expected, &expected_len);
+        SDLTest_AssertCheck(result, "Call to SDL_LoadWAV_IO(), got error: %s", result ? "none" : SDL_GetError());
+        SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+        stream = SDL_CreateAudioStreamFromWAV_IO(io, true, NULL);
+        SDLTest_AssertPass("Call to SDL_CreateAudioStreamFromWAV_IO()");
+        SDLTest_AssertCheck(stream != NULL, "Validate stream, got error: %s", stream ? "none" : SDL_GetError());
+
+        actual = (Uint8 *)SDL_malloc(expected_len + 4096);
+        if (result && stream && actual) {
+            /* Pull the data in odd sized pieces, like an audio device would. */
+            const int frame_size = SDL_AUDIO_FRAMESIZE(spec);
+            int amount;
+            do {
+                amount = SDL_GetAudioStreamData(stream, actual + actual_len, SDL_min(frame_size * 333, (int)expected_len + 4096 - actual_len));
+                actual_len += SDL_max(amount, 0);
+            } while (amount > 0);
+            SDLTest_AssertCheck(actual_len == (int)expected_len, "Check streamed length, expected %u, got %d", (unsigned int)expected_len, actual_len);
+            SDLTest_AssertCheck(SDL_memcmp(actual, expected, SDL_min((Uint32)actual_len, expected_len)) == 0, "Check streamed data matches SDL_LoadWAV_IO()");
+        }
+
+        SDL_free(actual);
+        SDL_DestroyAudioStream(stream);
+        SDL_free(expected);
+    }
+
+    SDL_free(data);
+    return TEST_COMPLETED;
+}
+
+/* Writes an ADPCM WAVE file with random blocks into memory. A LIST chunk follows the data chunk. */
+static SDL_IOStream *CreateTestADPCMWAV(Uint16 encoding, Uint16 channels, Uint16 blockalign, Uint32 length)
+{
+    static const Sint16 coefficients[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    const bool ms = (encoding == 0x0002);
+    const Uint32 headersize = channels * (ms ? 7 : 4);
+    const Uint16 samplesperblock = (Uint16)((blockalign - headersize) * 2 / channels + (ms ? 2 : 1));
+    const Uint32 fmtsize = ms ? 16 + 2 + 4 + 4 * 7 : 16 + 2 + 2;
+    const Uint32 freq = 22050;
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    Uint8 *data = (Uint8 *)SDL_malloc(length);
+    Uint32 i;
+    Uint16 c;
+
+    if (!io || !data) {
+        SDL_CloseIO(io);
+        SDL_free(data);
+        return NULL;
+    }
+    for (i = 0; i < length; ++i) {
+        data[i] = (Uint8)SDLTest_RandomUint8();
+    }
+    /* Make the block headers valid, including the one of a truncated last block. */
+    for (i = 0; i + headersize <= length; i += blockalign) {
+        for (c = 0; c < channels; ++c) {
+            if (ms) {
+                data[i + c] = (Uint8)SDLTest_RandomIntegerInRange(0, 6);
+            } else {
+                data[i + c * 4 + 2] = (Uint8)SDLTest_RandomIntegerInRange(0, 88);
+                data[i + c * 4 + 3] = 0;
+            }
+        }
+    }
+
+    SDL_WriteIO(io, "RIFF", 4);
+    SDL_WriteU32LE(io, 4 + (8 + fmtsize) + (8 + length + (length & 1)) + (8 + 4));
+    SDL_WriteIO(io, "WAVEfmt ", 8);
+    SDL_WriteU32LE(io, fmtsize);
+    SDL_WriteU16LE(io, encoding);
+    SDL_WriteU16LE(io, channels);
+    SDL_WriteU32LE(io, freq);
+    SDL_WriteU32LE(io, freq * blockalign / samplesperblock);
+    SDL_WriteU16LE(io, blockalign);
+    SDL_WriteU16LE(io, 4);
+    SDL_WriteU16LE(io, (Uint16)(fmtsize - 18));
+    SDL_WriteU16LE(io, samplesperblock);
+    if (ms) {
+        SDL_WriteU16LE(io, 7);
+        for (i = 0; i < SDL_arraysize(coefficients); ++i) {
+            SDL_WriteS16LE(io, coefficients[i]);
+        }
+    }
+    SDL_WriteIO(io, "data", 4);
+    SDL_WriteU32LE(io, length);
+    SDL_WriteIO(io, data, length);
+    if (length & 1) {
+        SDL_WriteU8(io, 0);
+    }
+    SDL_WriteIO(io, "LIST", 4);
+    SDL_WriteU32LE(io, 4);
+    SDL_WriteIO(io, "INFO", 4);
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+    SDL_free(data);
+    return io;
+}
+
+/**
+ * Check that streaming an ADPCM WAVE file gives the same audio as loading it.
+ *
+ * The stream is read in pieces that end in the middle of ADPCM blocks, and
+ * the data source is moved around between reads, so the decoder has to seek
+ * back to where it left off.
+ *
+ * \sa SDL_CreateAudioStreamFromWAV_IO
+ * \sa SDL_LoadWAV_IO
+ */
+static int SDLCALL audio_streamADPCMWAV(void *arg)
+{
+    static const struct
+    {
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 blockalign;
+    } formats[] = {
+        { 0x0002, 1, 256 }, /* MS ADPCM */
+        { 0x0002, 2, 512 }, /* MS ADPCM */
+        { 0x0011, 1, 256 }, /* IMA ADPCM */
+        { 0x0011, 2, 512 }, /* IMA ADPCM */
+    };
+    /* Odd read sizes in sample frames, smaller and larger than a block. */
+    static const int reads[] = { 1, 7, 333, 499, 1000, 3 };
+    static const char *truncation[] = { "dropblock", "dropframe" };
+    const char *oldhint = SDL_GetHint(SDL_HINT_WAVE_TRUNCATION);
+    char *saved = oldhint ? SDL_strdup(oldhint) : NULL;
+    int i, t;
+
+    for (t = 0; t < SDL_arraysize(truncation); ++t) {
+        SDL_SetHint(SDL_HINT_WAVE_TRUNCATION, truncation[t]);
+
+        for (i = 0; i < SDL_arraysize(formats); ++i) {
+            /* Some whole blocks and a truncated one. */
+            const Uint32 length = formats[i].blockalign * 20 + formats[i].blockalign / 2 + 1;
+            SDL_IOStream *io;
+            SDL_AudioSpec spec;
+            Uint8 *expected = NULL;
+            Uint32 expected_len = 0;
+            SDL_AudioStream *stream;
+            Uint8 *actual;
+            int actual_len = 0;
+            bool result;
+
+            io = CreateTestADPCMWAV(formats[i].encoding, formats[i].channels, formats[i].blockalign, length);
+            SDLTest_AssertCheck(io != NULL, "Create ADPCM WAVE file %d", i);
+            if (!io) {
+                continue;
+            }
+
+            result = SDL_LoadWAV_IO(io, false, &spec, &expected, &expected_len);
+            SDLTest_AssertCheck(result, "Call to SDL_LoadWAV_IO() with %s, got error: %s", truncation[t], result ? "none" : SDL_GetError());
+            SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+            stream = SDL_CreateAudioStreamFromWAV_IO(io, false, NULL);
+            SDLTest_AssertPass("Call to SDL_CreateAudioStreamFromWAV_IO()");
+            SDLTest_AssertCheck(stream != NULL, "Validate stream, got error: %s", stream ? "none" : SDL_GetError());
+
+            actual = (Uint8 *)SDL_malloc(expected_len + 4096);
+            if (result && stream && actual) {
+                const int frame_size = SDL_AUDIO_FRAMESIZE(spec);
+                const Sint64 size = SDL_GetIOSize(io);
+                int amount;
+                int j = 0;
+
+                SDLTest_AssertCheck(spec.format == SDL_AUDIO_S16, "Check decoded format, expected S16, got %s", SDL_GetAudioFormatName(spec.format));
+                do {
+                    const int request = reads[j++ % SDL_arraysize(reads)] * frame_size;
+                    amount = SDL_GetAudioStreamData(stream, actual + actual_len, SDL_min(request, (int)expected_len + 4096 - actual_len));
+                    actual_len += SDL_max(amount, 0);
+                    /* Anything else could use the data source between reads. */
+                    SDL_SeekIO(io, SDLTest_RandomIntegerInRange(0, (Sint32)size), SDL_IO_SEEK_SET);
+                } while (amount > 0);
+                SDLTest_AssertCheck(actual_len == (int)expected_len, "Check streamed length, expected %u, got %d", (unsigned int)expected_len, actual_len);
+                SDLTest_AssertCheck(SDL_memcmp(actual, expected, SDL_min((Uint32)actual_len, expected_len)) == 0, "Check streamed data matches SDL_LoadWAV_IO()");
+            }
+
+            SDL_free(actual);
+            SDL_DestroyAudioStream(stream);
+            SDL_CloseIO(io);
+            SDL_free(expected);
+        }
+    }
+
+    SDL_SetHint(SDL_HINT_WAVE_TRUNCATION, saved);
+    SDL_free(saved);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check the signal-to-noise ratio of each resampling quality, for the channel counts that have their own kernels.
+ *
+ * \sa SDL_SetAudioStreamResampleQuality
+ */
+static int SDLCALL audio_resampleQuality(void *arg)
+{
+    static const struct
+    {
+        SDL_AudioResampleQuality quality;
+        const char *name;
+        double signal_to_noise;
+    } qualities[] = {
+        { SDL_AUDIO_RESAMPLE_LINEAR, "linear", 60 },
+        { SDL_AUDIO_RESAMPLE_MEDIUM, "medium", 80 },
+        { SDL_AUDIO_RESAMPLE_HIGH, "high", 110 },
+    };
+    static const int channel_counts[] = { 1, 2, 3, 6, 8 };
+    const int time = 2;
+    const int freq = 440;
+    const int rate_in = 44100;
+    const int rate_out = 48000;
+    const int frames_in = time * rate_in;
+    const int frames_out = time * rate_out;
+    int q, c, i, j;
+
+    for (q = 0; q < SDL_arraysize(qualities); ++q) {
+        for (c = 0; c < SDL_arraysize(channel_counts); ++c) {
+            const int num_channels = channel_counts[c];
+            const int len_in = frames_in * num_channels * (int)sizeof(float);
+            const int len_out = frames_out * num_channels * (int)sizeof(float);
+            SDL_AudioSpec spec_in, spec_out;
+            SDL_AudioResampleQuality quality;
+            SDL_AudioStream *stream;
+            float *buf_in, *buf_out;
+            double sum_squared_error = 0;
+            double sum_squared_value = 0;
+            double signal_to_noise;
+            int len;
+
+            SDL_zero(spec_in);
+            SDL_zero(spec_out);
+            spec_in.format = spec_out.format = SDL_AUDIO_F32;
+            spec_in.channels = spec_out.channels = num_channels;
+            spec_in.freq = rate_in;
+            spec_out.freq = rate_out;
+
+            stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+            SDLTest_AssertCheck(stream != NULL, "Create stream, got error: %s", stream ? "none" : SDL_GetError());
+            if (!stream) {
+                return TEST_ABORTED;
+            }
+            SDLTest_AssertCheck(SDL_GetAudioStreamResampleQuality(stream, &quality) && quality == SDL_AUDIO_RESAMPLE_MEDIUM, "Check the default resampling quality");
+            SDLTest_AssertCheck(SDL_SetAudioStreamResampleQuality(stream, qualities[q].quality), "Set resampling quality to %s", qualities[q].name);
+
+            buf_in = (float *)SDL_malloc(len_in);
+            buf_out = (float *)SDL_malloc(len_out * 2);
+            SDLTest_AssertCheck(buf_in && buf_out, "Allocate buffers");
+            if (!buf_in || !buf_out) {
+                SDL_free(buf_in);
+                SDL_free(buf_out);
+                SDL_DestroyAudioStream(stream);
+                return TEST_ABORTED;
+            }
+
+            /* Give every channel its own phase, so mixing channels up shows as noise */
+            for (i = 0; i < frames_in; ++i) {
+                for (j = 0; j < num_channels; ++j) {
+                    buf_in[i * num_channels + j] = (float)sine_wave_sample(i, rate_in, freq, j * 0.7);
+                }
+            }
+
+            len = convert_audio_chunks(stream, buf_in, len_in, buf_out, len_out * 2);
+            SDLTest_AssertCheck(len == len_out, "Expected output length to be %i, got %i.", len_out, len);
+
+            if (len == len_out) {
+                /* Skip the ends, where channels that don't start at zero jump from the silence around the input */
+                for (i = 64; i < frames_out - 64; ++i) {
+                    for (j = 0; j < num_channels; ++j) {
+                        const double target = sine_wave_sample(i, rate_out, freq, j * 0.7);
+                        const double error = target - buf_out[i * num_channels + j];
+                        sum_squared_error += error * error;
+                        sum_squared_value += target * target;
+                    }
+                }
+                signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+                SDLTest_AssertCheck(signal_to_noise >= qualities[q].signal_to_noise,
+                                    "%s resampling of %d channels has signal-to-noise ratio %f dB, should be no less than %f dB.",
+                                    qualities[q].name, num_channels, signal_to_noise, qualities[q].signal_to_noise);
+            }
+
+            SDL_free(buf_in);
+            SDL_free(buf_out);
+            SDL_DestroyAudioStream(stream);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a stream with a ring buffer keeps puts in order, including across threads.
+ *
+ * \sa SDL_SetAudioStreamRingBuffer
+ */
+#define RING_TEST_SAMPLES 200000
+
+static int SDLCALL audio_ringBufferProducer(void *arg)
+{
+    SDL_AudioStream *stream = (SDL_AudioStream *)arg;
+    Sint16 chunk[97];
+    int next = 0;
+
+    while (next < RING_TEST_SAMPLES) {
+        const int count = SDL_min((int)SDL_arraysize(chunk), RING_TEST_SAMPLES - next);
+        int i;
+        for (i = 0; i < count; ++i) {
+            chunk[i] = (Sint16)(next + i);
+        }
+        if (SDL_PutAudioStreamData(stream, chunk, count * (int)sizeof(Sint16))) {
+            next += count;
+        } else {
+            SDL_Delay(0); /* full, let the reader catch up */
+        }
+    }
+    return next;
+}
+
+static int SDLCALL audio_ringBuffer(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S16, 1, 48000 };
+    Sint16 samples[8];
+    Sint16 buffer[1000];
+    SDL_AudioStream *stream;
+    SDL_Thread *thread;
+    bool result;
+    bool in_order = true;
+    int produced = 0;
+    int total = 0;
+    int i, amount;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Create stream, got error: %s", stream ? "none" : SDL_GetError());
+    if (!stream) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_SetAudioStreamRingBuffer(stream, sizeof(samples));
+    SDLTest_AssertCheck(result, "Call to SDL_SetAudioStreamRingBuffer(), got error: %s", result ? "none" : SDL_GetError());
+
+    for (i = 0; i < SDL_arraysize(samples); ++i) {
+        samples[i] = (Sint16)i;
+    }
+    result = SDL_PutAudioStreamData(stream, samples, 3 * sizeof(Sint16));
+    SDLTest_AssertCheck(result, "Put into the ring");
+    result = SDL_PutAudioStreamData(stream, samples + 3, 6 * sizeof(Sint16));
+    SDLTest_AssertCheck(!result, "Putting more than fits in the ring fails");
+    result = SDL_PutAudioStreamData(stream, samples + 3, 1);
+    SDLTest_AssertCheck(!result, "Putting a partial frame fails");
+    result = SDL_PutAudioStreamDataNoCopy(stream, samples + 3, 2 * sizeof(Sint16), NULL, NULL);
+    SDLTest_AssertCheck(result, "Put around the ring");
+    result = SDL_PutAudioStreamData(stream, samples + 5, 3 * sizeof(Sint16));
+    SDLTest_AssertCheck(result, "Put into the ring after it was drained");
+    result = SDL_SetAudioStreamRingBuffer(stream, 0);
+    SDLTest_AssertCheck(result, "Remove the ring");
+    amount = SDL_GetAudioStreamQueued(stream);
+    SDLTest_AssertCheck(amount == 8 * (int)sizeof(Sint16), "Check queued amount, expected %d, got %d", 8 * (int)sizeof(Sint16), amount);
+    amount = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer));
+    SDLTest_AssertCheck(amount == 8 * (int)sizeof(Sint16) && SDL_memcmp(buffer, samples, amount) == 0, "Check data put through the ring comes out in order");
+
+    /* The ring is rounded up to a power of two so its byte counts can wrap around */
+    result = SDL_SetAudioStreamRingBuffer(stream, 12);
+    SDLTest_AssertCheck(result, "Call to SDL_SetAudioStreamRingBuffer(), got error: %s", result ? "none" : SDL_GetError());
+    result = SDL_PutAudioStreamData(stream, samples, sizeof(samples));
+    SDLTest_AssertCheck(result, "Put a rounded up ring's full size into it");
+    SDL_ClearAudioStream(stream);
+    result = SDL_SetAudioStreamRingBuffer(stream, 0x40000001);
+    SDLTest_AssertCheck(!result, "Setting a ring larger than 1 GiB fails");
+
+    result = SDL_SetAudioStreamRingBuffer(stream, 4096);
+    SDLTest_AssertCheck(result, "Call to SDL_SetAudioStreamRingBuffer(), got error: %s", result ? "none" : SDL_GetError());
+    result = SDL_PutAudioStreamData(stream, samples, sizeof(samples));
+    SDL_ClearAudioStream(stream);
+    amount = SDL_GetAudioStreamAvailable(stream);
+    SDLTest_AssertCheck(result && amount == 0, "Check clearing the stream empties the ring, got %d bytes", amount);
+
+    thread = SDL_CreateThread(audio_ringBufferProducer, "RingProducer", stream);
+    SDLTest_AssertCheck(thread != NULL, "Create producer thread, got error: %s", thread ? "none" : SDL_GetError());
+    if (thread) {
+        const Uint64 start = SDL_GetTicks();
+        while (total < RING_TEST_SAMPLES && SDL_GetTicks() - start < 10000) {
+            amount = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer)) / (int)sizeof(Sint16);
+            for (i = 0; i < amount; ++i) {
+                if (buffer[i] != (Sint16)(total + i)) {
+                    in_order = false;
+                }
+            }
+            total += SDL_max(amount, 0);
+        }
+        SDL_WaitThread(thread, &produced);
+    }
+    SDLTest_AssertCheck(produced == RING_TEST_SAMPLES && total == RING_TEST_SAMPLES, "Check all samples came through, produced %d, got %d", produced, total);
+    SDLTest_AssertCheck(in_order, "Check samples from another thread came out in order");
+
+    SDL_DestroyAudioStream(stream);
+    return TEST_COMPLETED;
+}
+#undef RING_TEST_SAMPLES
+
+/**
+ * Check that the stream reads frames split by the end of its ring buffer, and
+ * that data keeps its space in the ring until it has been read.
+ *
+ * \sa SDL_SetAudioStreamRingBuffer
+ */
+static int SDLCALL audio_ringBufferFrames(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S16, 3, 48000 };
+    const int framesize = SDL_AUDIO_FRAMESIZE(spec);
+    Sint16 samples[4 * 3];
+    Sint16 buffer[4 * 3];
+    SDL_AudioStream *stream;
+    bool result;
+    int i, amount;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Create stream, got error: %s", stream ? "none" : SDL_GetError());
+    if (!stream) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(samples); ++i) {
+        samples[i] = (Sint16)(i + 1);
+    }
+
+    /* 16 bytes doesn't hold a whole number of 6 byte frames */
+    result = SDL_SetAudioStreamRingBuffer(stream, 16);
+    SDLTest_AssertCheck(result, "Call to SDL_SetAudioStreamRingBuffer(), got error: %s", result ? "none" : SDL_GetError());
+
+    result = SDL_PutAudioStreamData(stream, samples, 2 * framesize);
+    SDLTest_AssertCheck(result, "Put two frames into the ring");
+    amount = SDL_GetAudioStreamQueued(stream);
+    SDLTest_AssertCheck(amount == 2 * framesize, "Check queued amount, expected %d, got %d", 2 * framesize, amount);
+    result = SDL_PutAudioStreamData(stream, samples, framesize);
+    SDLTest_AssertCheck(!result, "Data that hasn't been read keeps its space in the ring");
+    amount = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer));
+    SDLTest_AssertCheck(amount == 2 * framesize && SDL_memcmp(buffer, samples, amount) == 0, "Check the first two frames come out, got %d bytes", amount);
+
+    /* The first of these is split by the end of the ring */
+    result = SDL_PutAudioStreamData(stream, samples + 6, 2 * framesize);
+    SDLTest_AssertCheck(result, "Put two frames around the end of the ring");
+    amount = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer));
+    SDLTest_AssertCheck(amount == 2 * framesize && SDL_memcmp(buffer, samples + 6, amount) == 0, "Check frames split by the end of the ring come out whole, got %d bytes", amount);
+
+    /* Resizing the ring keeps anything that hasn't been read yet */
+    result = SDL_PutAudioStreamData(stream, samples, 2 * framesize);
+    SDLTest_AssertCheck(result, "Put two more frames into the ring");
+    amount = SDL_GetAudioStreamQueued(stream);
+    SDLTest_AssertCheck(amount == 2 * framesize, "Check queued amount, expected %d, got %d", 2 * framesize, amount);
+    result = SDL_SetAudioStreamRingBuffer(stream, 64);
+    SDLTest_AssertCheck(result, "Resize the ring while it holds queued data, got error: %s", result ? "none" : SDL_GetError());
+    result = SDL_PutAudioStreamData(stream, samples + 6, 2 * framesize);
+    SDLTest_AssertCheck(result, "Put into the resized ring");
+    amount = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer));
+    SDLTest_AssertCheck(amount == 4 * framesize && SDL_memcmp(buffer, samples, amount) == 0, "Check data queued from the old ring comes out first, got %d bytes", amount);
+
+    SDL_DestroyAudioStream(stream);
+    return TEST_COMPLETED;
+}
+
+#define TRACK_TEST_FRAMES 4800
+
+typedef struct
+{
+    SDL_AtomicInt captured;
+    float frames[TRACK_TEST_FRAMES * 2 * 2];
+} TrackCapture;
+
+static void SDLCALL audio_trackChannelMapsPostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    TrackCapture *capture = (TrackCapture *)userdata;
+    const int max_samples = (int)SDL_arraysize(capture->frames);
+    int captured = SDL_GetAtomicInt(&capture->captured);
+    int num_samples = buflen / (int)sizeof(float);
+    int i = 0;
+
+    /* Skip the silence before the stream's data reaches the device */
+    if (captured == 0) {
+        while (i < num_samples && buffer[i] == 0.0f) {
+            ++i;
+        }
+        i -= i % spec->channels;
+    }
+    num_samples = SDL_min(num_samples - i, max_samples - captured);
+    if (num_samples > 0) {
+        SDL_memcpy(&capture->frames[captured], &buffer[i], num_samples * sizeof(float));
+        SDL_SetAtomicInt(&capture->captured, captured + num_samples);
+    }
+}
+
+/* Check that the first half of the frames was swapped and the second half wasn't */
+static int audio_countTrackMismatches(const float *output, int amount, int track_frames)
+{
+    int mismatches = 0;
+    int i;
+
+    /* Skip the frames near the switch, where the resampler blends the two tracks */
+    for (i = 100; i < SDL_min(amount, track_frames * 2) - 100; ++i) {
+        const float expected = (i < track_frames) ? -0.25f : 0.25f;
+        if (i >= track_frames - 100 && i < track_frames + 100) {
+            continue;
+        }
+        if (SDL_fabsf(output[i * 2] - expected) > 0.01f || SDL_fabsf(output[i * 2 + 1] + expected) > 0.01f) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * Check that audio queued under an earlier input channel map is still swizzled
+ * with that map after the map is changed, with and without resampling, and
+ * when the stream is mixed by a device.
+ *
+ * \sa SDL_SetAudioStreamInputChannelMap
+ */
+static int SDLCALL audio_trackChannelMaps(void *arg)
+{
+    static TrackCapture capture;
+    static const int swapped[] = { 1, 0 };
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_frames = TRACK_TEST_FRAMES;
+    SDL_AudioSpec device_spec = { SDL_AUDIO_F32, 2, 48000 };
+    SDL_AudioDeviceID devid;
+    const int dst_freqs[] = { 48000, 44100 };
+    float *frames = (float *)SDL_malloc(num_frames * 2 * sizeof(float));
+    float *output = (float *)SDL_malloc(num_frames * 2 * 2 * sizeof(float));
+    int i;
+
+    SDLTest_AssertCheck(frames && output, "Allocate test buffers");
+    if (!frames || !output) {
+        SDL_free(frames);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < num_frames; ++i) {
+        frames[i * 2] = 0.25f;
+        frames[i * 2 + 1] = -0.25f;
+    }
+
+    for (i = 0; i < SDL_arraysize(dst_freqs); ++i) {
+        const SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, dst_freqs[i] };
+        const int track_frames = (int)(((Sint64)num_frames * dst_freqs[i]) / src_spec.freq);
+        SDL_AudioStream *stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        int mismatches;
+        int amount;
+
+        SDLTest_AssertCheck(stream != NULL, "Create stream, got error: %s", stream ? "none" : SDL_GetError());
+        if (!stream) {
+            continue;
+        }
+
+        SDL_SetAudioStreamInputChannelMap(stream, swapped, 2);
+        SDL_PutAudioStreamData(stream, frames, num_frames * 2 * sizeof(float));
+        SDL_SetAudioStreamInputChannelMap(stream, NULL, 2);
+        SDL_PutAudioStreamData(stream, frames, num_frames * 2 * sizeof(float));
+        SDL_FlushAudioStream(stream);
+
+        amount = SDL_GetAudioStreamData(stream, output, num_frames * 2 * 2 * sizeof(float)) / (int)(2 * sizeof(float));
+        SDLTest_AssertCheck(amount >= track_frames * 2 - 2, "Get converted audio, expected about %d frames, got %d", track_frames * 2, amount);
+
+        mismatches = audio_countTrackMismatches(output, amount, track_frames);
+        SDLTest_AssertCheck(mismatches == 0, "Check each track used its own channel map at %d Hz, expected 0 mismatches, got %d", dst_freqs[i], mismatches);
+
+        SDL_DestroyAudioStream(stream);
+    }
+
+    /* A device mixes streams that match its format straight out of their queues */
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &device_spec);
+    SDLTest_AssertCheck(devid != 0, "Open playback device, got error: %s", devid ? "none" : SDL_GetError());
+    if (devid && SDL_GetAudioDeviceFormat(devid, &device_spec, NULL) && device_spec.channels == 2) {
+        const SDL_AudioSpec stream_spec = { SDL_AUDIO_F32, 2, device_spec.freq };
+        SDL_AudioStream *stream = SDL_CreateAudioStream(&stream_spec, &stream_spec);
+        const Uint64 start = SDL_GetTicks();
+        int mismatches;
+
+        SDL_SetAtomicInt(&capture.captured, 0);
+        SDL_SetAudioPostmixCallback(devid, audio_trackChannelMapsPostmix, &capture);
+
+        SDL_SetAudioStreamInputChannelMap(stream, swapped, 2);
+        SDL_PutAudioStreamData(stream, frames, num_frames * 2 * sizeof(float));
+        SDL_SetAudioStreamInputChannelMap(stream, NULL, 2);
+        SDL_PutAudioStreamData(stream, frames, num_frames * 2 * sizeof(float));
+        SDL_BindAudioStream(devid, stream);
+
+        while (SDL_GetAtomicInt(&capture.captured) < (int)SDL_arraysize(capture.frames) && SDL_GetTicks() - start < 5000) {
+            SDL_Delay(10);
+        }
+        SDL_PauseAudioDevice(devid);
+        SDL_SetAudioPostmixCallback(devid, NULL, NULL);
+
+        SDLTest_AssertCheck(SDL_GetAtomicInt(&capture.captured) == (int)SDL_arraysize(capture.frames), "Capture mixed audio, expected %d samples, got %d",
+                            (int)SDL_arraysize(capture.frames), SDL_GetAtomicInt(&capture.captured));
+        mismatches = audio_countTrackMismatches(capture.frames, SDL_GetAtomicInt(&capture.captured) / 2, num_frames);
+        SDLTest_AssertCheck(mismatches == 0, "Check each track used its own channel map when mixed by a device, expected 0 mismatches, got %d", mismatches);
+
+        SDL_DestroyAudioStream(stream);
+    }
+    SDL_CloseAudioDevice(devid);
+
+    SDL_free(frames);
+    SDL_free(output);
+    return TEST_COMPLETED;
+}
+#undef TRACK_TEST_FRAMES
+
 static const SDLTest_TestCaseReference audioTest1 = {
     audio_enumerateAndNameAudioDevices, "audio_enumerateAndNameAudioDevices", "Enumerate and name available audio devices (playback and recording)", TEST_ENABLED
 };
@@ -1551,13 +2297,42 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixFloat32, "audio_mixFloat32", "Check that mixing float32 audio adds and clamps exactly.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_streamWAV, "audio_streamWAV", "Check that streaming a WAVE file matches loading it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_ringBuffer, "audio_ringBuffer", "Check putting through an audio stream ring buffer.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check signal-to-noise ratio of each resampling quality.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_trackChannelMaps, "audio_trackChannelMaps", "Check that queued audio keeps the channel map it was put with.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_streamADPCMWAV, "audio_streamADPCMWAV", "Check that streaming an ADPCM WAVE file in pieces matches loading it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_ringBufferFrames, "audio_ringBufferFrames", "Check reading frames split by the end of an audio stream ring buffer.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22,
+    &audioTest23, &audioTest24, &audioTest25, NULL
 };
 
 /* Audio test suite (global) */
@@ -102,6 +102,149 @@ static int SDLCALL events_pushPumpAndPollUserevent(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test polling several events with a single call.
+ *
+ * \sa SDL_PollEvents
+ */
+static int SDLCALL events_pollEventsBatch(void *arg)
+{
+    SDL_Event event_in;
+    SDL_Event events[8];
+    int i, result, total, out_of_order;
+
+    /* Flush all events */
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    result = SDL_PollEvents(NULL, 1);
+    SDLTest_AssertCheck(result == -1, "Check SDL_PollEvents() with NULL events, expected -1, got %d", result);
+
+    /* Queue more events than fit in the array */
+    SDL_zero(event_in);
+    event_in.type = SDL_EVENT_USER;
+    for (i = 0; i < 20; ++i) {
+        event_in.common.timestamp = 0;
+        event_in.user.code = i;
+        SDL_PushEvent(&event_in);
+    }
+    SDLTest_AssertPass("Call to SDL_PushEvent() x20");
+
+    total = 0;
+    out_of_order = 0;
+    do {
+        result = SDL_PollEvents(events, SDL_arraysize(events));
+        SDLTest_AssertCheck(result >= 0, "Call to SDL_PollEvents(), expected >= 0, got %d", result);
+        for (i = 0; i < result; ++i) {
+            if (events[i].type == SDL_EVENT_USER) {
+                if (events[i].user.code != total) {
+                    ++out_of_order;
+                }
+                ++total;
+            }
+        }
+    } while (result == SDL_arraysize(events));
+
+    SDLTest_AssertCheck(total == 20, "Check all user events were polled, expected 20, got %d", total);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events were polled in order, got %d out of order", out_of_order);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER), "Check SDL_HasEvent() returns false after polling");
+
+    /* The poll cycle ended, so nothing should be left for this cycle */
+    result = SDL_PollEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result >= 0, "Call to SDL_PollEvents() on an empty queue, expected >= 0, got %d", result);
+
+    /* Fill the array exactly: the end of the cycle must still be reported by the next call */
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    for (i = 0; i < SDL_arraysize(events); ++i) {
+        event_in.user.code = i;
+        SDL_PushEvent(&event_in);
+    }
+    result = SDL_PollEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result == SDL_arraysize(events), "Call to SDL_PollEvents() with a full cycle, expected %d, got %d", (int)SDL_arraysize(events), result);
+    SDL_PushEvent(&event_in);
+    result = SDL_PollEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result == 0, "Check SDL_PollEvents() reports the end of the cycle, expected 0, got %d", result);
+    result = SDL_PollEvents(events, SDL_arraysize(events));
+    SDLTest_AssertCheck(result == 1, "Check SDL_PollEvents() starts a new cycle, expected 1, got %d", result);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Test merging of consecutive motion events.
+ *
+ * \sa SDL_HINT_EVENT_COALESCE_MOTION
+ * \sa SDL_GetCoalescedEventCount
+ */
+static int SDLCALL events_coalesceMotion(void *arg)
+{
+    SDL_Event event_in;
+    SDL_Event events[8];
+    Uint64 coalesced;
+    int i, result;
+
+    SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    coalesced = SDL_GetCoalescedEventCount();
+
+    /* Three moves of the same mouse should become one event */
+    SDL_zero(event_in);
+    event_in.type = SDL_EVENT_MOUSE_MOTION;
+    event_in.motion.which = 1;
+    for (i = 1; i <= 3; ++i) {
+        event_in.common.timestamp = i;
+        event_in.motion.x = 10.0f * i;
+        event_in.motion.y = 20.0f * i;
+        event_in.motion.xrel = 0.5f * i;
+        event_in.motion.yrel = -1.0f * i;
+        SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+    }
+
+    /* A different mouse isn't merged */
+    event_in.motion.which = 2;
+    event_in.motion.xrel = 1.0f;
+    event_in.motion.yrel = 1.0f;
+    SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+
+    /* Motion is never merged across other events */
+    SDL_zero(event_in);
+    event_in.type = SDL_EVENT_USER;
+    SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+    event_in.type = SDL_EVENT_MOUSE_MOTION;
+    event_in.motion.which = 2;
+    event_in.motion.xrel = 4.0f;
+    SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == 4, "Check number of queued events, expected 4, got %d", result);
+    if (result == 4) {
+        SDLTest_AssertCheck(events[0].motion.which == 1 && events[0].motion.x == 30.0f && events[0].motion.y == 60.0f,
+                            "Check merged event has the latest position, got %g,%g", events[0].motion.x, events[0].motion.y);
+        SDLTest_AssertCheck(events[0].motion.xrel == 3.0f && events[0].motion.yrel == -6.0f,
+                            "Check merged event accumulated relative motion, expected 3,-6, got %g,%g", events[0].motion.xrel, events[0].motion.yrel);
+        SDLTest_AssertCheck(events[0].common.timestamp == 3, "Check merged event has the latest timestamp");
+        SDLTest_AssertCheck(events[1].motion.which == 2 && events[1].motion.xrel == 1.0f, "Check second mouse was not merged");
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_USER, "Check user event kept its place");
+        SDLTest_AssertCheck(events[3].type == SDL_EVENT_MOUSE_MOTION && events[3].motion.xrel == 4.0f, "Check motion after user event was not merged");
+    }
+    coalesced = SDL_GetCoalescedEventCount() - coalesced;
+    SDLTest_AssertCheck(coalesced == 2, "Check SDL_GetCoalescedEventCount(), expected 2 more, got %" SDL_PRIu64, coalesced);
+
+    /* Merging is off by default */
+    SDL_ResetHint(SDL_HINT_EVENT_COALESCE_MOTION);
+    event_in.motion.which = 1;
+    SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+    SDL_PeepEvents(&event_in, 1, SDL_ADDEVENT, 0, 0);
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION);
+    SDLTest_AssertCheck(result == 2, "Check motion is not merged with the hint reset, expected 2, got %d", result);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Adds and deletes an event watch function with NULL userdata
  *
@@ -308,6 +451,254 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+#define EVENT_STRESS_PRODUCERS 4
+#define EVENT_STRESS_EVENTS_PER_PRODUCER 25000
+
+typedef struct EventStressProducer_t
+{
+    Uint32 type;
+    Sint32 code;
+} EventStressProducer_t;
+
+static int SDLCALL EventStressProducerThread(void *userdata)
+{
+    EventStressProducer_t *producer = (EventStressProducer_t *)userdata;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = producer->type;
+    event.user.code = producer->code;
+    for (i = 0; i < EVENT_STRESS_EVENTS_PER_PRODUCER; ++i) {
+        event.common.timestamp = 0;
+        event.user.data1 = (void *)(uintptr_t)i;
+        while (!SDL_PushEvent(&event)) {
+            /* The queue is full, give the consumer a chance to catch up */
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static void events_runQueueStress(const char *ring_size)
+{
+    EventStressProducer_t producers[EVENT_STRESS_PRODUCERS];
+    SDL_Thread *threads[EVENT_STRESS_PRODUCERS];
+    int expected[EVENT_STRESS_PRODUCERS];
+    SDL_Event events[64];
+    SDL_Event marker;
+    const int total = EVENT_STRESS_PRODUCERS * EVENT_STRESS_EVENTS_PER_PRODUCER;
+    int received = 0;
+    int out_of_order = 0;
+    int i, result;
+    Uint64 start, elapsed;
+
+    SDL_SetHint(SDL_HINT_EVENT_QUEUE_RING_SIZE, ring_size);
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* This event is outside the range we peek at and should survive the stress run */
+    SDL_zero(marker);
+    marker.type = SDL_EVENT_USER + 1;
+    marker.user.code = 42;
+    SDL_PushEvent(&marker);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < EVENT_STRESS_PRODUCERS; ++i) {
+        producers[i].type = SDL_EVENT_USER;
+        producers[i].code = i;
+        expected[i] = 0;
+        threads[i] = SDL_CreateThread(EventStressProducerThread, "EventStressProducer", &producers[i]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Create producer thread %d", i);
+    }
+
+    while (received < total) {
+        result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+        if (result < 0) {
+            SDLTest_AssertCheck(result >= 0, "SDL_PeepEvents() failed: %s", SDL_GetError());
+            break;
+        }
+        for (i = 0; i < result; ++i) {
+            const Sint32 code = events[i].user.code;
+            if (code >= 0 && code < EVENT_STRESS_PRODUCERS) {
+                if ((int)(uintptr_t)events[i].user.data1 != expected[code]) {
+                    ++out_of_order;
+                }
+                expected[code] = (int)(uintptr_t)events[i].user.data1 + 1;
+            }
+        }
+        received += result;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < EVENT_STRESS_PRODUCERS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    SDLTest_AssertCheck(received == total, "Check received events, expected %d, got %d", total, received);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events arrived in order per producer, got %d out of order", out_of_order);
+    SDLTest_Log("Event queue (ring size %s): %d events in %" SDL_PRIu64 " us, %.0f events/second",
+                ring_size, received, elapsed / SDL_NS_PER_US, elapsed ? (double)received * SDL_NS_PER_SECOND / elapsed : 0.0);
+
+    result = SDL_PeepEvents(events, 1, SDL_GETEVENT, SDL_EVENT_USER + 1, SDL_EVENT_USER + 1);
+    SDLTest_AssertCheck(result == 1 && events[0].user.code == 42, "Check filtered event was left in the queue");
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+}
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+/**
+ * Pushes events from several threads at once and checks that none are lost or reordered.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ * \sa SDL_HINT_EVENT_QUEUE_RING_SIZE
+ */
+static int SDLCALL events_queueStress(void *arg)
+{
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+    events_runQueueStress("0");
+    events_runQueueStress("1024");
+    events_runQueueStress("16");
+    SDL_ResetHint(SDL_HINT_EVENT_QUEUE_RING_SIZE);
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+    return TEST_COMPLETED;
+}
+
+static const void * SDLCALL events_clipboardDataCallback(void *userdata, const char *mime_type, size_t *size)
+{
+    *size = 0;
+    return NULL;
+}
+
+/* Announces mime types "x-test/<tag>-<index>+" padded to `length` characters in a clipboard update event */
+static bool events_setTestMimeTypes(int tag, int count, int length)
+{
+    static char storage[4][32 * 1024];
+    const char *mime_types[SDL_arraysize(storage)];
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        SDL_memset(storage[i], 'a' + i, length);
+        SDL_snprintf(storage[i], length, "x-test/%d-%d", tag, i);
+        storage[i][SDL_strlen(storage[i])] = '+';
+        storage[i][length] = '\0';
+        mime_types[i] = storage[i];
+    }
+    return SDL_SetClipboardData(events_clipboardDataCallback, NULL, NULL, mime_types, count);
+}
+
+/* Checks the mime types of a clipboard update event made by events_setTestMimeTypes() */
+static bool events_checkTestMimeTypes(const SDL_Event *event, int tag, int count, int length)
+{
+    int i, j;
+
+    if (event->type != SDL_EVENT_CLIPBOARD_UPDATE || event->clipboard.num_mime_types != (Uint32)count ||
+        ((uintptr_t)event->clipboard.mime_types % sizeof(void *)) != 0) {
+        return false;
+    }
+    for (i = 0; i < count; ++i) {
+        char prefix[64];
+        const char *mime_type = event->clipboard.mime_types[i];
+        const int prefix_length = SDL_snprintf(prefix, sizeof(prefix), "x-test/%d-%d+", tag, i);
+
+        if ((int)SDL_strlen(mime_type) != length || SDL_strncmp(mime_type, prefix, prefix_length) != 0) {
+            return false;
+        }
+        for (j = prefix_length; j < length; ++j) {
+            if (mime_type[j] != 'a' + i) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* Takes the next clipboard update event off the queue, its memory stays valid until the next pump */
+static bool events_getClipboardUpdate(SDL_Event *event)
+{
+    return SDL_PeepEvents(event, 1, SDL_GETEVENT, SDL_EVENT_CLIPBOARD_UPDATE, SDL_EVENT_CLIPBOARD_UPDATE) == 1;
+}
+
+/* Queues clipboard updates that need more than one arena chunk, then polls and checks them */
+static int events_queueTestMimeTypes(int num_events)
+{
+    SDL_Event event;
+    int i, intact = 0;
+
+    for (i = 0; i < num_events; ++i) {
+        events_setTestMimeTypes(i, 3, 120);
+    }
+    /* One that's too large for a shared chunk */
+    events_setTestMimeTypes(num_events, 2, 20000);
+
+    for (i = 0; i <= num_events; ++i) {
+        if (!events_getClipboardUpdate(&event)) {
+            break;
+        }
+        if (events_checkTestMimeTypes(&event, i, (i < num_events) ? 3 : 2, (i < num_events) ? 120 : 20000)) {
+            ++intact;
+        }
+    }
+    /* Pumping frees the memory of the events taken off the queue */
+    SDL_PumpEvents();
+    return intact;
+}
+
+/**
+ * Tests the temporary memory that carries event data: allocation, reuse of
+ * freed memory and growing past one arena chunk. testeventmemory checks that
+ * it is actually freed, since that needs its own memory functions.
+ *
+ * \sa SDL_PumpEvents
+ * \sa SDL_PeepEvents
+ * \sa SDL_SetClipboardData
+ */
+static int SDLCALL events_temporaryMemory(void *arg)
+{
+    const void *reused = NULL;
+    SDL_Event event;
+    bool result;
+    int i, intact, same = 0;
+
+    SDL_SetEventEnabled(SDL_EVENT_CLIPBOARD_UPDATE, true);
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Allocation */
+    result = events_setTestMimeTypes(0, 3, 40);
+    SDLTest_AssertCheck(result, "Call to SDL_SetClipboardData(), got error: %s", result ? "none" : SDL_GetError());
+    result = events_getClipboardUpdate(&event);
+    SDLTest_AssertCheck(result, "Check a clipboard update event was queued");
+    SDLTest_AssertCheck(result && events_checkTestMimeTypes(&event, 0, 3, 40), "Check the event's mime types are intact");
+
+    /* Reuse: once an event's memory is freed, the next event gets the same memory.
+       Like a video backend, queue the event after pumping, which frees the previous one. */
+    for (i = 1; i <= 10; ++i) {
+        SDL_PumpEvents();
+        events_setTestMimeTypes(i, 3, 40);
+        if (events_getClipboardUpdate(&event) && events_checkTestMimeTypes(&event, i, 3, 40)) {
+            if (i == 1) {
+                reused = event.clipboard.mime_types;
+            } else if (event.clipboard.mime_types == reused) {
+                ++same;
+            }
+        }
+    }
+    SDL_PumpEvents();
+    SDLTest_AssertCheck(same == 9, "Check freed temporary memory is reused, expected 9 events at the same address, got %d", same);
+
+    /* Growth past the arena, with the event queue grown ahead of time */
+    intact = events_queueTestMimeTypes(64);
+    SDLTest_AssertCheck(intact == 65, "Check events spanning several arena chunks are intact, expected 65, got %d", intact);
+
+    SDL_ClearClipboardData();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -315,6 +706,14 @@ static const SDLTest_TestCaseReference eventsTest_pushPumpAndPollUserevent = {
     events_pushPumpAndPollUserevent, "events_pushPumpAndPollUserevent", "Pushes, pumps and polls a user event", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_pollEventsBatch = {
+    events_pollEventsBatch, "events_pollEventsBatch", "Pushes and polls several user events with one call", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_coalesceMotion = {
+    events_coalesceMotion, "events_coalesceMotion", "Merges consecutive motion events", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference eventsTest_addDelEventWatch = {
     events_addDelEventWatch, "events_addDelEventWatch", "Adds and deletes an event watch function with NULL userdata", TEST_ENABLED
 };
@@ -327,12 +726,24 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_queueStress = {
+    events_queueStress, "events_queueStress", "Push events from several threads with and without the lock-free ring", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_temporaryMemory = {
+    events_temporaryMemory, "events_temporaryMemory", "Allocates, reuses and frees the temporary memory of events", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
+    &eventsTest_pollEventsBatch,
+    &eventsTest_coalesceMotion,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_queueStress,
+    &eventsTest_temporaryMemory,
     NULL
 };
 
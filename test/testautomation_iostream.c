@@ -603,6 +603,138 @@ static int SDLCALL iostrm_testFileRead(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests reading from a memory mapped file.
+ *
+ * \sa SDL_IOFromFile
+ * \sa SDL_CloseIO
+ */
+static int SDLCALL iostrm_testFileMapped(void *arg)
+{
+    SDL_IOStream *rw;
+    const char *mem;
+    Sint64 size;
+    int result;
+
+    /* Read test. */
+    rw = SDL_IOFromFile(IOStreamReadTestFilename, "rbm");
+    SDLTest_AssertPass("Call to SDL_IOFromFile(..,\"rbm\") succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromFile in mapped read mode does not return NULL");
+
+    /* Bail out if NULL */
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* The mapping is exposed when the platform supports it */
+    mem = (const char *)SDL_GetPointerProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+    size = SDL_GetNumberProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 0);
+    if (mem) {
+        SDLTest_AssertCheck(size == (Sint64)SDL_strlen(IOStreamHelloWorldTestString), "Verify mapped size, expected %d, got %" SDL_PRIs64, (int)SDL_strlen(IOStreamHelloWorldTestString), size);
+        SDLTest_AssertCheck(SDL_memcmp(mem, IOStreamHelloWorldTestString, (size_t)size) == 0, "Verify mapped contents");
+    } else {
+        SDLTest_Log("File wasn't memory mapped on this platform");
+    }
+
+    /* Run generic tests */
+    testGenericIOStreamValidations(rw, false);
+
+    /* Close handle */
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    /* Mapping a file that doesn't exist should fail like a regular open. */
+    rw = SDL_IOFromFile(IOStreamWriteTestFilename, "rbm");
+    SDLTest_AssertPass("Call to SDL_IOFromFile(..,\"rbm\") succeeded");
+    SDLTest_AssertCheck(rw == NULL, "Verify opening a missing file with SDL_IOFromFile in mapped read mode returns NULL");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests a buffered stream on top of dynamic memory.
+ *
+ * \sa SDL_CreateBufferedIO
+ * \sa SDL_CloseIO
+ */
+static int SDLCALL iostrm_testBuffered(void *arg)
+{
+    SDL_IOStream *src, *rw;
+    Uint8 data[1000], check[1000];
+    Uint32 value = 0;
+    Sint64 pos;
+    size_t i, amount;
+    int result;
+
+    src = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(src != NULL, "Verify SDL_IOFromDynamicMem() does not return NULL");
+    if (src == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* A small buffer, so the generic tests cross its edges */
+    rw = SDL_CreateBufferedIO(src, 7, false);
+    SDLTest_AssertPass("Call to SDL_CreateBufferedIO(src, 7, false) succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify SDL_CreateBufferedIO() does not return NULL");
+    if (rw == NULL) {
+        SDL_CloseIO(src);
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetPointerProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_BUFFERED_SOURCE_POINTER, NULL) == src, "Verify source property");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_BUFFERED_SIZE_NUMBER, 0) == 7, "Verify buffer size property");
+
+    /* Run generic tests */
+    testGenericIOStreamValidations(rw, true);
+
+    /* Mix small and large writes, then read it all back in odd sized pieces */
+    for (i = 0; i < sizeof(data); ++i) {
+        data[i] = (Uint8)(i * 7 + 3);
+    }
+    SDL_SeekIO(rw, 0, SDL_IO_SEEK_SET);
+    for (i = 0; i < sizeof(data); i += amount) {
+        amount = SDL_min((i % 3) ? 3 : 20, sizeof(data) - i);
+        SDLTest_AssertCheck(SDL_WriteIO(rw, data + i, amount) == amount, "Verify write of %d bytes at %d", (int)amount, (int)i);
+    }
+    pos = SDL_TellIO(rw);
+    SDLTest_AssertCheck(pos == (Sint64)sizeof(data), "Verify position after writes, expected %d, got %" SDL_PRIs64, (int)sizeof(data), pos);
+    pos = SDL_GetIOSize(rw);
+    SDLTest_AssertCheck(pos == (Sint64)sizeof(data), "Verify size after writes, expected %d, got %" SDL_PRIs64, (int)sizeof(data), pos);
+
+    SDL_SeekIO(rw, 0, SDL_IO_SEEK_SET);
+    SDL_zeroa(check);
+    for (i = 0; i < sizeof(check); i += amount) {
+        amount = SDL_min((i % 2) ? 5 : 11, sizeof(check) - i);
+        SDLTest_AssertCheck(SDL_ReadIO(rw, check + i, amount) == amount, "Verify read of %d bytes at %d", (int)amount, (int)i);
+    }
+    SDLTest_AssertCheck(SDL_memcmp(data, check, sizeof(data)) == 0, "Verify data read back matches data written");
+    SDLTest_AssertCheck(SDL_ReadIO(rw, check, 1) == 0, "Verify read at end of stream returns 0");
+    SDLTest_AssertCheck(SDL_GetIOStatus(rw) == SDL_IO_STATUS_EOF, "Verify status is EOF at end of stream");
+
+    /* Overwrite in the middle of buffered read data */
+    SDL_SeekIO(rw, 100, SDL_IO_SEEK_SET);
+    SDL_ReadU32LE(rw, &value);
+    SDL_WriteU32LE(rw, 0xDEADBEEF);
+    SDL_SeekIO(rw, -4, SDL_IO_SEEK_CUR);
+    SDL_ReadU32LE(rw, &value);
+    SDLTest_AssertCheck(value == 0xDEADBEEF, "Verify overwritten value, got 0x%08" SDL_PRIx32, value);
+
+    /* The source is left where the buffered stream was */
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+    pos = SDL_TellIO(src);
+    SDLTest_AssertCheck(pos == 108, "Verify source position, expected 108, got %" SDL_PRIs64, pos);
+    SDL_SeekIO(src, 104, SDL_IO_SEEK_SET);
+    SDL_ReadU32LE(src, &value);
+    SDLTest_AssertCheck(value == 0xDEADBEEF, "Verify overwritten value in source, got 0x%08" SDL_PRIx32, value);
+
+    result = SDL_CloseIO(src);
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Tests writing from file.
  *
@@ -913,10 +1045,19 @@ static const SDLTest_TestCaseReference iostrmTest12 = {
     iostrm_testConstMemEmpty, "iostrm_testConstMemEmpty", "Tests opening empty (const) memory stream", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference iostrmTest13 = {
+    iostrm_testFileMapped, "iostrm_testFileMapped", "Tests reading from a memory mapped file", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest14 = {
+    iostrm_testBuffered, "iostrm_testBuffered", "Tests a buffered stream on top of dynamic memory", TEST_ENABLED
+};
+
 /* Sequence of IOStream test cases */
 static const SDLTest_TestCaseReference *iostrmTests[] = {
     &iostrmTest1, &iostrmTest2, &iostrmTest3, &iostrmTest4, &iostrmTest5, &iostrmTest6,
-    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12, NULL
+    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12,
+    &iostrmTest13, &iostrmTest14, NULL
 };
 
 /* IOStream test suite (global) */
@@ -1176,6 +1176,36 @@ static int SDLCALL pixels_saveLoadPNG(void *arg)
         }
     }
 
+    /* Loading from memory leaves the stream right after the image */
+    surface = SDL_CreateSurface(3, 2, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (surface) {
+        static const char trailer[] = "trailing data";
+        SDL_IOStream *dynamic = SDL_IOFromDynamicMem();
+        SDL_IOStream *src;
+        Sint64 png_size;
+        Uint8 *png;
+        char buffer[sizeof(trailer)];
+
+        SDL_ClearSurface(surface, 1.0f, 0.5f, 0.25f, 1.0f);
+        result = SDL_SavePNG_IO(surface, dynamic, false);
+        SDLTest_AssertCheck(result, "Verify SDL_SavePNG_IO() succeeded");
+        SDL_DestroySurface(surface);
+        png_size = SDL_TellIO(dynamic);
+        SDL_WriteIO(dynamic, trailer, sizeof(trailer));
+        png = (Uint8 *)SDL_GetPointerProperty(SDL_GetIOProperties(dynamic), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+
+        src = SDL_IOFromConstMem(png, (size_t)png_size + sizeof(trailer));
+        surface = SDL_LoadPNG_IO(src, false);
+        SDLTest_AssertCheck(surface != NULL, "Verify SDL_LoadPNG_IO() succeeded");
+        SDLTest_AssertCheck(SDL_TellIO(src) == png_size, "Verify stream position after SDL_LoadPNG_IO(), expected %" SDL_PRIs64 ", got %" SDL_PRIs64, png_size, SDL_TellIO(src));
+        SDLTest_AssertCheck(SDL_ReadIO(src, buffer, sizeof(buffer)) == sizeof(buffer) && SDL_memcmp(buffer, trailer, sizeof(trailer)) == 0,
+                            "Verify the data after the image can be read");
+        SDL_DestroySurface(surface);
+        SDL_CloseIO(src);
+        SDL_CloseIO(dynamic);
+    }
+
     return TEST_COMPLETED;
 }
 
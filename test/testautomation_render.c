@@ -2304,6 +2304,424 @@ static int SDLCALL render_testColorspaceSRGB(void *arg)
     return TEST_COMPLETED;
 }
 
+static SDL_Texture *CreateSoftwareThreadsTexture(SDL_Renderer *software_renderer)
+{
+    SDL_Surface *surface = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Texture *texture;
+    int x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            /* Transparent corners, so the texture is RLE encoded */
+            const Uint32 a = ((x < 8 && y < 8) || (x >= 24 && y >= 24)) ? 0 : (Uint32)(64 + x * 6);
+            row[x] = (a << 24) | ((Uint32)(x * 8) << 16) | ((Uint32)(y * 8) << 8) | (Uint32)((x ^ y) * 8);
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(software_renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void DrawSoftwareThreadsScene(SDL_Renderer *software_renderer, SDL_Texture *texture)
+{
+    const SDL_Rect viewport = { 40, 30, 220, 150 };
+    const SDL_Rect cliprect = { 10, 12, 150, 100 };
+    SDL_Vertex verts[6];
+    SDL_FRect rect;
+    int i;
+
+    SDL_SetRenderDrawColor(software_renderer, 32, 64, 96, 255);
+    SDL_RenderClear(software_renderer);
+
+    /* Blended fills and copies that straddle the tile edges */
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 20; ++i) {
+        SDL_SetRenderDrawColor(software_renderer, (Uint8)(i * 12), (Uint8)(255 - i * 12), 128, 160);
+        rect.x = (float)(i * 15 - 10);
+        rect.y = (float)(i * 9 - 5);
+        rect.w = 70.0f;
+        rect.h = 50.0f;
+        SDL_RenderFillRect(software_renderer, &rect);
+    }
+    for (i = 0; i < 24; ++i) {
+        SDL_SetTextureColorMod(texture, (Uint8)(255 - i * 8), 255, (Uint8)(i * 10));
+        SDL_SetTextureAlphaMod(texture, (Uint8)(128 + i * 5));
+        SDL_SetTextureBlendMode(texture, (i % 3) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_ADD);
+        rect.x = (float)(i * 13 - 8);
+        rect.y = (float)((i * 29) % 190 - 8);
+        rect.w = 32.0f;
+        rect.h = 32.0f;
+        SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+    }
+
+    /* Commands that are drawn on the calling thread in between */
+    SDL_SetTextureColorMod(texture, 255, 255, 255);
+    SDL_SetTextureAlphaMod(texture, 255);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    rect.x = 100.0f;
+    rect.y = 90.0f;
+    rect.w = 90.0f;
+    rect.h = 60.0f;
+    SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+    SDL_SetRenderDrawColor(software_renderer, 255, 255, 0, 200);
+    SDL_RenderLine(software_renderer, 0.0f, 199.0f, 299.0f, 0.0f);
+
+    /* Geometry with a viewport and a clip rectangle */
+    SDL_SetRenderViewport(software_renderer, &viewport);
+    SDL_SetRenderClipRect(software_renderer, &cliprect);
+    for (i = 0; i < 6; ++i) {
+        verts[i].position.x = (i % 3 == 0) ? -20.5f : (i % 3 == 1) ? 180.0f : 60.5f + i;
+        verts[i].position.y = (i % 3 == 0) ? 10.0f + i * 10 : (i % 3 == 1) ? 30.5f : 140.0f - i * 5;
+        verts[i].color.r = (i & 1) ? 1.0f : 0.25f;
+        verts[i].color.g = (i & 2) ? 1.0f : 0.5f;
+        verts[i].color.b = (i & 4) ? 1.0f : 0.75f;
+        verts[i].color.a = 0.75f;
+        verts[i].tex_coord.x = (i % 3 == 1) ? 1.0f : 0.0f;
+        verts[i].tex_coord.y = (i % 3 == 2) ? 1.0f : 0.0f;
+    }
+    SDL_RenderGeometry(software_renderer, NULL, verts, 3, NULL, 0);
+    SDL_RenderGeometry(software_renderer, texture, verts + 3, 3, NULL, 0);
+    rect.x = 120.0f;
+    rect.y = 80.0f;
+    rect.w = 32.0f;
+    rect.h = 32.0f;
+    SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+    SDL_RenderTextureRotated(software_renderer, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+    SDL_SetRenderClipRect(software_renderer, NULL);
+    SDL_SetRenderViewport(software_renderer, NULL);
+}
+
+/**
+ * Tests that the software renderer draws the same image when it splits
+ * the target into tiles that are drawn on several threads.
+ *
+ * \sa SDL_CreateSoftwareRenderer
+ */
+static int SDLCALL render_testSoftwareThreads(void *arg)
+{
+    static const char *threads[] = { "1", "4" };
+    SDL_Surface *surfaces[SDL_arraysize(threads)];
+    int i, y, mismatched_rows = 0;
+
+    for (i = 0; i < SDL_arraysize(threads); ++i) {
+        SDL_Renderer *software_renderer;
+        SDL_Texture *texture;
+
+        SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads[i]);
+        surfaces[i] = SDL_CreateSurface(300, 200, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surfaces[i] != NULL, "Validate result from SDL_CreateSurface, expected: not NULL");
+        if (!surfaces[i]) {
+            return TEST_ABORTED;
+        }
+        software_renderer = SDL_CreateSoftwareRenderer(surfaces[i]);
+        SDLTest_AssertCheck(software_renderer != NULL, "Validate result from SDL_CreateSoftwareRenderer, expected: not NULL");
+        if (!software_renderer) {
+            return TEST_ABORTED;
+        }
+        texture = CreateSoftwareThreadsTexture(software_renderer);
+        SDLTest_AssertCheck(texture != NULL, "Validate result from SDL_CreateTextureFromSurface, expected: not NULL");
+        if (!texture) {
+            return TEST_ABORTED;
+        }
+
+        SDLTest_AssertPass("Drawing the scene with %s thread(s)", threads[i]);
+        DrawSoftwareThreadsScene(software_renderer, texture);
+        CHECK_FUNC(SDL_FlushRenderer, (software_renderer));
+
+        SDL_DestroyTexture(texture);
+        SDL_DestroyRenderer(software_renderer);
+    }
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+
+    for (y = 0; y < surfaces[0]->h; ++y) {
+        const Uint8 *a = (const Uint8 *)surfaces[0]->pixels + y * surfaces[0]->pitch;
+        const Uint8 *b = (const Uint8 *)surfaces[1]->pixels + y * surfaces[1]->pitch;
+        if (SDL_memcmp(a, b, surfaces[0]->w * 4) != 0) {
+            ++mismatched_rows;
+        }
+    }
+    SDLTest_AssertCheck(mismatched_rows == 0, "Check that the tiled output matches, expected 0 mismatched rows, got %d", mismatched_rows);
+
+    for (i = 0; i < SDL_arraysize(threads); ++i) {
+        SDL_DestroySurface(surfaces[i]);
+    }
+    return TEST_COMPLETED;
+}
+
+static void DrawCommandOptimizationScene(SDL_Renderer *software_renderer, SDL_Texture **textures)
+{
+    SDL_Vertex verts[3];
+    SDL_FRect rect;
+    int i, j;
+
+    DrawSoftwareThreadsScene(software_renderer, textures[0]);
+
+    /* Sprites alternating between two textures, some of them overlapping */
+    SDL_SetTextureBlendMode(textures[0], SDL_BLENDMODE_BLEND);
+    SDL_SetTextureBlendMode(textures[1], SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 40; ++i) {
+        rect.x = (float)((i % 8) * 36 + ((i / 8 == 3) ? 20 : 0));
+        rect.y = (float)((i / 8) * 36 + 10);
+        rect.w = 32.0f;
+        rect.h = 32.0f;
+        SDL_RenderTexture(software_renderer, textures[i & 1], NULL, &rect);
+    }
+
+    /* Redundant state changes around geometry in two colors */
+    for (i = 0; i < 30; ++i) {
+        SDL_SetRenderDrawColor(software_renderer, 255, 0, 0, 255);
+        SDL_SetRenderViewport(software_renderer, NULL);
+        SDL_SetRenderClipRect(software_renderer, NULL);
+        for (j = 0; j < 3; ++j) {
+            verts[j].position.x = (float)((i % 10) * 30 + ((j == 1) ? 25 : 0));
+            verts[j].position.y = (float)((i / 10) * 30 + 100 + ((j == 2) ? 25 : 0));
+            verts[j].color.r = (i & 1) ? 1.0f : 0.0f;
+            verts[j].color.g = 0.5f;
+            verts[j].color.b = (i & 1) ? 0.0f : 1.0f;
+            verts[j].color.a = 0.5f;
+            verts[j].tex_coord.x = 0.0f;
+            verts[j].tex_coord.y = 0.0f;
+        }
+        SDL_RenderGeometry(software_renderer, (i % 3) ? NULL : textures[1], verts, 3, NULL, 0);
+    }
+}
+
+/**
+ * Tests that reordering and merging the render commands doesn't change
+ * what the software renderer draws.
+ *
+ * \sa SDL_GetRenderCommandStats
+ */
+static int SDLCALL render_testCommandOptimization(void *arg)
+{
+    static const char *optimize[] = { "0", "1" };
+    SDL_RenderCommandStats stats[SDL_arraysize(optimize)];
+    SDL_Surface *surfaces[SDL_arraysize(optimize)];
+    int i, y, mismatched_rows = 0;
+
+    for (i = 0; i < SDL_arraysize(optimize); ++i) {
+        SDL_Renderer *software_renderer;
+        SDL_Texture *textures[2];
+
+        SDL_SetHint(SDL_HINT_RENDER_OPTIMIZE_COMMANDS, optimize[i]);
+        surfaces[i] = SDL_CreateSurface(300, 200, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surfaces[i] != NULL, "Validate result from SDL_CreateSurface, expected: not NULL");
+        if (!surfaces[i]) {
+            return TEST_ABORTED;
+        }
+        software_renderer = SDL_CreateSoftwareRenderer(surfaces[i]);
+        SDLTest_AssertCheck(software_renderer != NULL, "Validate result from SDL_CreateSoftwareRenderer, expected: not NULL");
+        if (!software_renderer) {
+            return TEST_ABORTED;
+        }
+        textures[0] = CreateSoftwareThreadsTexture(software_renderer);
+        textures[1] = CreateSoftwareThreadsTexture(software_renderer);
+        SDLTest_AssertCheck(textures[0] != NULL && textures[1] != NULL, "Validate result from SDL_CreateTextureFromSurface, expected: not NULL");
+        if (!textures[0] || !textures[1]) {
+            return TEST_ABORTED;
+        }
+        SDL_SetTextureColorMod(textures[1], 255, 128, 64);
+
+        SDLTest_AssertPass("Drawing the scene with command optimization %s", optimize[i]);
+        DrawCommandOptimizationScene(software_renderer, textures);
+        SDL_RenderPresent(software_renderer);
+        CHECK_FUNC(SDL_GetRenderCommandStats, (software_renderer, &stats[i]));
+
+        SDL_DestroyTexture(textures[0]);
+        SDL_DestroyTexture(textures[1]);
+        SDL_DestroyRenderer(software_renderer);
+    }
+    SDL_ResetHint(SDL_HINT_RENDER_OPTIMIZE_COMMANDS);
+
+    SDLTest_AssertCheck(stats[0].commands_queued > 0 && stats[0].commands_submitted == stats[0].commands_queued,
+                        "Check that all commands are submitted without the optimization, expected %d, got %d", stats[0].commands_queued, stats[0].commands_submitted);
+    SDLTest_AssertCheck(stats[1].commands_queued == stats[0].commands_queued,
+                        "Check that the same commands were queued, expected %d, got %d", stats[0].commands_queued, stats[1].commands_queued);
+    SDLTest_AssertCheck(stats[1].commands_submitted < stats[1].commands_queued,
+                        "Check that fewer commands are submitted, queued %d, got %d", stats[1].commands_queued, stats[1].commands_submitted);
+    SDLTest_AssertCheck(stats[1].commands_dropped > 0, "Check that redundant state changes were dropped, got %d", stats[1].commands_dropped);
+    SDLTest_AssertCheck(stats[1].draws_reordered > 0, "Check that draws were reordered, got %d", stats[1].draws_reordered);
+    SDLTest_AssertCheck(stats[1].draws_merged > 0, "Check that draws were merged, got %d", stats[1].draws_merged);
+
+    for (y = 0; y < surfaces[0]->h; ++y) {
+        const Uint8 *a = (const Uint8 *)surfaces[0]->pixels + y * surfaces[0]->pitch;
+        const Uint8 *b = (const Uint8 *)surfaces[1]->pixels + y * surfaces[1]->pitch;
+        if (SDL_memcmp(a, b, surfaces[0]->w * 4) != 0) {
+            ++mismatched_rows;
+        }
+    }
+    SDLTest_AssertCheck(mismatched_rows == 0, "Check that the optimized output matches, expected 0 mismatched rows, got %d", mismatched_rows);
+
+    for (i = 0; i < SDL_arraysize(optimize); ++i) {
+        SDL_DestroySurface(surfaces[i]);
+    }
+    return TEST_COMPLETED;
+}
+
+static void SetTriangleVertex(SDL_Vertex *vertex, float x, float y, float r, float g, float b, float a, float u, float v)
+{
+    vertex->position.x = x;
+    vertex->position.y = y;
+    vertex->color.r = r;
+    vertex->color.g = g;
+    vertex->color.b = b;
+    vertex->color.a = a;
+    vertex->tex_coord.x = u;
+    vertex->tex_coord.y = v;
+}
+
+static SDL_Texture *CreateSoftwareTrianglesTexture(SDL_Renderer *software_renderer)
+{
+    Uint16 pixels[16 * 16];
+    SDL_Texture *texture;
+    int x, y;
+
+    for (y = 0; y < 16; ++y) {
+        for (x = 0; x < 16; ++x) {
+            pixels[y * 16 + x] = (Uint16)(((x * 2) << 11) | ((y * 4) << 5) | ((x ^ y) * 2));
+        }
+    }
+    texture = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_RGB565, SDL_TEXTUREACCESS_STATIC, 16, 16);
+    if (texture && !SDL_UpdateTexture(texture, NULL, pixels, sizeof(pixels[0]) * 16)) {
+        SDL_DestroyTexture(texture);
+        texture = NULL;
+    }
+    return texture;
+}
+
+static void DrawSoftwareTrianglesScene(SDL_Renderer *software_renderer, SDL_Texture **textures)
+{
+    SDL_Vertex verts[6];
+    int i;
+
+    SDL_SetRenderDrawColor(software_renderer, 32, 48, 64, 255);
+    SDL_RenderClear(software_renderer);
+
+    /* Gouraud fills, opaque and blended */
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_NONE);
+    SetTriangleVertex(&verts[0], 4.0f, 4.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+    SetTriangleVertex(&verts[1], 95.5f, 10.25f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+    SetTriangleVertex(&verts[2], 30.75f, 90.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+    SDL_RenderGeometry(software_renderer, NULL, verts, 3, NULL, 0);
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    SetTriangleVertex(&verts[0], 50.0f, 2.0f, 1.0f, 1.0f, 0.0f, 0.25f, 0.0f, 0.0f);
+    SetTriangleVertex(&verts[1], 110.0f, 80.5f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+    SetTriangleVertex(&verts[2], 12.5f, 70.0f, 1.0f, 0.0f, 1.0f, 0.5f, 0.0f, 0.0f);
+    SDL_RenderGeometry(software_renderer, NULL, verts, 3, NULL, 0);
+
+    /* Textured triangles, modulated and blended, from 8888 and non-8888 textures */
+    for (i = 0; i < 2; ++i) {
+        const float x = 120.0f + i * 90.0f;
+
+        SDL_SetTextureBlendMode(textures[i], SDL_BLENDMODE_NONE);
+        SetTriangleVertex(&verts[0], x, 4.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+        SetTriangleVertex(&verts[1], x + 80.0f, 6.5f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f);
+        SetTriangleVertex(&verts[2], x + 10.25f, 60.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f);
+        SDL_RenderGeometry(software_renderer, textures[i], verts, 3, NULL, 0);
+
+        SetTriangleVertex(&verts[0], x + 80.0f, 6.5f, 1.0f, 0.5f, 0.25f, 1.0f, 1.0f, 0.0f);
+        SetTriangleVertex(&verts[1], x + 75.5f, 70.0f, 0.25f, 1.0f, 0.5f, 1.0f, 1.0f, 1.0f);
+        SetTriangleVertex(&verts[2], x + 10.25f, 60.0f, 0.5f, 0.25f, 1.0f, 1.0f, 0.0f, 1.0f);
+        SDL_RenderGeometry(software_renderer, textures[i], verts, 3, NULL, 0);
+
+        SDL_SetTextureBlendMode(textures[i], SDL_BLENDMODE_BLEND);
+        SetTriangleVertex(&verts[0], x - 20.0f, 30.0f, 1.0f, 1.0f, 1.0f, 0.75f, 0.0f, 0.0f);
+        SetTriangleVertex(&verts[1], x + 60.0f, 40.0f, 1.0f, 0.75f, 0.5f, 0.5f, 1.0f, 0.25f);
+        SetTriangleVertex(&verts[2], x + 20.0f, 95.5f, 0.5f, 1.0f, 1.0f, 1.0f, 0.25f, 1.0f);
+        SDL_RenderGeometry(software_renderer, textures[i], verts, 3, NULL, 0);
+    }
+
+    /* Quads with texture coordinates outside the texture, clamped and wrapped */
+    for (i = 0; i < 4; ++i) {
+        const SDL_TextureAddressMode mode = (i & 1) ? SDL_TEXTURE_ADDRESS_WRAP : SDL_TEXTURE_ADDRESS_CLAMP;
+        const float x = 10.0f + i * 70.0f;
+        const float y = 110.0f;
+        const float c = (i & 2) ? 0.75f : 1.0f;
+
+        SDL_SetTextureBlendMode(textures[i / 2], SDL_BLENDMODE_BLEND);
+        SDL_SetRenderTextureAddressMode(software_renderer, mode, mode);
+        SetTriangleVertex(&verts[0], x, y, c, c, c, 1.0f, -0.5f, -0.5f);
+        SetTriangleVertex(&verts[1], x + 64.0f, y, c, c, c, 1.0f, 1.5f, -0.5f);
+        SetTriangleVertex(&verts[2], x + 64.0f, y + 64.0f, c, c, c, 1.0f, 1.5f, 1.5f);
+        verts[3] = verts[0];
+        verts[4] = verts[2];
+        SetTriangleVertex(&verts[5], x, y + 64.0f, c, c, c, 1.0f, -0.5f, 1.5f);
+        SDL_RenderGeometry(software_renderer, textures[i / 2], verts, 6, NULL, 0);
+    }
+    SDL_SetRenderTextureAddressMode(software_renderer, SDL_TEXTURE_ADDRESS_AUTO, SDL_TEXTURE_ADDRESS_AUTO);
+}
+
+/**
+ * Tests the software triangle rasterizer against reference output on 8888
+ * and non-8888 targets: Gouraud fills, modulated and blended textured
+ * triangles, and clamped and wrapped texture coordinates.
+ *
+ * The reference checksums are of the images drawn by the original
+ * rasterizer, which tested every pixel of a triangle's bounding box.
+ *
+ * \sa SDL_RenderGeometry
+ */
+static int SDLCALL render_testSoftwareTriangles(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormat format;
+        Uint32 crc;
+    } targets[] = {
+        { SDL_PIXELFORMAT_ARGB8888, 0x06053f80 },
+        { SDL_PIXELFORMAT_XRGB8888, 0x32b4ecb3 },
+        { SDL_PIXELFORMAT_RGB565, 0x2846b28c },
+        { SDL_PIXELFORMAT_RGB24, 0x76409018 },
+    };
+    int i, y;
+
+    for (i = 0; i < SDL_arraysize(targets); ++i) {
+        SDL_Surface *surface;
+        SDL_Renderer *software_renderer;
+        SDL_Texture *textures[2];
+        Uint32 crc = 0;
+
+        surface = SDL_CreateSurface(300, 200, targets[i].format);
+        SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_CreateSurface, expected: not NULL");
+        if (!surface) {
+            return TEST_ABORTED;
+        }
+        software_renderer = SDL_CreateSoftwareRenderer(surface);
+        SDLTest_AssertCheck(software_renderer != NULL, "Validate result from SDL_CreateSoftwareRenderer, expected: not NULL");
+        if (!software_renderer) {
+            SDL_DestroySurface(surface);
+            return TEST_ABORTED;
+        }
+        textures[0] = CreateSoftwareThreadsTexture(software_renderer);
+        textures[1] = CreateSoftwareTrianglesTexture(software_renderer);
+        SDLTest_AssertCheck(textures[0] != NULL && textures[1] != NULL, "Validate texture creation, expected: not NULL");
+        if (!textures[0] || !textures[1]) {
+            SDL_DestroyRenderer(software_renderer);
+            SDL_DestroySurface(surface);
+            return TEST_ABORTED;
+        }
+
+        DrawSoftwareTrianglesScene(software_renderer, textures);
+        CHECK_FUNC(SDL_FlushRenderer, (software_renderer));
+
+        for (y = 0; y < surface->h; ++y) {
+            crc = SDL_crc32(crc, (const Uint8 *)surface->pixels + y * surface->pitch, surface->w * SDL_BYTESPERPIXEL(surface->format));
+        }
+        SDLTest_AssertCheck(crc == targets[i].crc, "Check the %s image against the reference, expected: 0x%.8" SDL_PRIx32 ", got: 0x%.8" SDL_PRIx32,
+                            SDL_GetPixelFormatName(targets[i].format), targets[i].crc, crc);
+
+        SDL_DestroyTexture(textures[0]);
+        SDL_DestroyTexture(textures[1]);
+        SDL_DestroyRenderer(software_renderer);
+        SDL_DestroySurface(surface);
+    }
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2383,6 +2801,18 @@ static const SDLTest_TestCaseReference renderTestColorspaceSRGB = {
     render_testColorspaceSRGB, "render_testColorspaceSRGB", "Tests colorspace support (linear -> sRGB)", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestSoftwareThreads = {
+    render_testSoftwareThreads, "render_testSoftwareThreads", "Tests tile-parallel drawing in the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestCommandOptimization = {
+    render_testCommandOptimization, "render_testCommandOptimization", "Tests reordering and merging of render commands", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareTriangles = {
+    render_testSoftwareTriangles, "render_testSoftwareTriangles", "Tests the software triangle rasterizer against reference output", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestGetNumRenderDrivers,
@@ -2404,6 +2834,9 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestRGBSurfaceNoAlpha,
     &renderTestColorspaceLinear,
     &renderTestColorspaceSRGB,
+    &renderTestSoftwareThreads,
+    &renderTestCommandOptimization,
+    &renderTestSoftwareTriangles,
     NULL
 };
 
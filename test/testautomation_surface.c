@@ -2009,6 +2009,132 @@ static int SDLCALL surface_testScale(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Fixed point bilinear model of the SSE2 scaler in SDL_stretch.c, which the
+   AVX2 and AVX-512 scalers must match exactly. */
+static void GetScaleCoordinate(int src_n, int dst_n, int i, int *index0, int *index1, int *frac, bool right_pad_uses_last)
+{
+    int step = (int)(((Uint32)src_n << 16) / (Uint32)dst_n);
+    int x0 = (int)(((Sint64)step * 0x8000 + 0x8000) >> 16) - 0x8000;
+    Sint64 fp = x0 + (Sint64)i * step;
+
+    if (fp < 0) {
+        *index0 = 0;
+        *index1 = right_pad_uses_last ? 1 : 0;
+        *frac = 0;
+    } else if ((int)((Uint32)fp >> 16) > src_n - 2) {
+        if (right_pad_uses_last) {
+            /* Horizontally, the right edge blends fully into the last column */
+            *index0 = src_n - 2;
+            *index1 = src_n - 1;
+            *frac = 128;
+        } else {
+            /* Vertically, the bottom edge repeats the last row */
+            *index0 = src_n - 1;
+            *index1 = src_n - 1;
+            *frac = 0;
+        }
+    } else {
+        *index0 = (int)((Uint32)fp >> 16);
+        *index1 = *index0 + 1;
+        *frac = (int)((Uint32)(fp >> 9) & 127);
+    }
+}
+
+static Uint32 ScaleLinearReferencePixel(const SDL_Surface *src, int src_w, int src_h, int dst_w, int dst_h, int x, int y)
+{
+    int row0, row1, frac_h, col0, col1, frac_w;
+    const Uint8 *r0, *r1;
+    Uint32 result = 0;
+    int c;
+
+    GetScaleCoordinate(src_h, dst_h, y, &row0, &row1, &frac_h, false);
+    GetScaleCoordinate(src_w, dst_w, x, &col0, &col1, &frac_w, true);
+    r0 = (const Uint8 *)src->pixels + row0 * src->pitch;
+    r1 = (const Uint8 *)src->pixels + row1 * src->pitch;
+
+    for (c = 0; c < 4; ++c) {
+        int k0 = r0[col0 * 4 + c] * (128 - frac_h) + r1[col0 * 4 + c] * frac_h;
+        int k1 = r0[col1 * 4 + c] * (128 - frac_h) + r1[col1 * 4 + c] * frac_h;
+        int value = (k0 * (128 - frac_w) + k1 * frac_w) >> 14;
+        ((Uint8 *)&result)[c] = (Uint8)value;
+    }
+    return result;
+}
+
+static int SDLCALL surface_testScaleLinearBitExact(void *arg)
+{
+    static const struct
+    {
+        int src_w, src_h, dst_w, dst_h;
+    } sizes[] = {
+        { 64, 64, 32, 32 },
+        { 61, 37, 129, 71 },
+        { 1023, 517, 333, 211 },
+        { 300, 200, 17, 9 },
+        { 2, 2, 45, 33 },
+        { 640, 480, 1920, 1080 },
+        { 97, 13, 96, 12 },
+    };
+    static const char *threads[] = { "1", "4" };
+    int i, j;
+
+    if (!SDL_HasSSE2()) {
+        SDLTest_Log("SSE2 not available, the scalar scaler isn't bit-exact with SSE2, skipping");
+        return TEST_SKIPPED;
+    }
+
+    for (i = 0; i < SDL_arraysize(sizes); ++i) {
+        SDL_Surface *src = SDL_CreateSurface(sizes[i].src_w, sizes[i].src_h, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Surface *dst = SDL_CreateSurface(sizes[i].dst_w, sizes[i].dst_h, SDL_PIXELFORMAT_ARGB8888);
+        Uint32 seed = 0x12345678;
+        int x, y;
+
+        SDLTest_AssertCheck(src != NULL && dst != NULL, "SDL_CreateSurface()");
+        if (!src || !dst) {
+            SDL_DestroySurface(src);
+            SDL_DestroySurface(dst);
+            return TEST_ABORTED;
+        }
+
+        for (y = 0; y < src->h; ++y) {
+            Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+            for (x = 0; x < src->w; ++x) {
+                seed = seed * 1103515245 + 12345;
+                row[x] = seed ^ (seed >> 16);
+            }
+        }
+
+        for (j = 0; j < SDL_arraysize(threads); ++j) {
+            int mismatches = 0;
+            int first_x = 0, first_y = 0;
+
+            SDL_SetHint(SDL_HINT_SURFACE_STRETCH_THREADS, threads[j]);
+            SDL_ClearSurface(dst, 0.0f, 0.0f, 0.0f, 0.0f);
+            SDLTest_AssertCheck(SDL_StretchSurface(src, NULL, dst, NULL, SDL_SCALEMODE_LINEAR), "SDL_StretchSurface()");
+
+            for (y = 0; y < dst->h; ++y) {
+                const Uint32 *row = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                for (x = 0; x < dst->w; ++x) {
+                    if (row[x] != ScaleLinearReferencePixel(src, src->w, src->h, dst->w, dst->h, x, y)) {
+                        if (mismatches++ == 0) {
+                            first_x = x;
+                            first_y = y;
+                        }
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Checking %dx%d -> %dx%d linear scaling with %s thread(s), expected 0 mismatches, got %d (first at %d,%d)",
+                                src->w, src->h, dst->w, dst->h, threads[j], mismatches, first_x, first_y);
+        }
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+    }
+    SDL_ResetHint(SDL_HINT_SURFACE_STRETCH_THREADS);
+
+    return TEST_COMPLETED;
+}
+
 #define GENERATE_SHIFTS
 
 static Uint32 Calculate(int v, int bits, int vmax, int shift)
@@ -2098,6 +2224,357 @@ static int SDLCALL surface_test16BitTo32Bit(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests blending with a colorkey, including to a 10-bit surface.
+ *
+ * \sa SDL_SetSurfaceColorKey
+ * \sa SDL_BlitSurface
+ */
+static int SDLCALL surface_testBlitColorkeyBlend(void *arg)
+{
+    static const SDL_PixelFormat dst_formats[] = {
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_ARGB2101010
+    };
+    const int w = 67, h = 3;
+    const Uint32 key = 0xFF123456;
+    SDL_Surface *src;
+    Uint32 *srcpixels;
+    int i, x, y;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "SDL_CreateSurface(ARGB8888)");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < h; ++y) {
+        srcpixels = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < w; ++x) {
+            if ((x % 3) == 0) {
+                /* The colorkey ignores alpha */
+                srcpixels[x] = (key & 0x00FFFFFF) | ((Uint32)SDLTest_RandomUint8() << 24);
+            } else {
+                srcpixels[x] = (Uint32)SDLTest_RandomUint32();
+            }
+        }
+    }
+    SDL_SetSurfaceColorKey(src, true, key);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+
+    for (i = 0; i < SDL_arraysize(dst_formats); ++i) {
+        const SDL_PixelFormat format = dst_formats[i];
+        const bool is_10bit = SDL_ISPIXELFORMAT_10BIT(format);
+        SDL_Surface *dst = SDL_CreateSurface(w, h, format);
+        SDL_Surface *orig;
+        int mismatches = 0;
+        bool result;
+
+        SDLTest_AssertCheck(dst != NULL, "SDL_CreateSurface(%s)", SDL_GetPixelFormatName(format));
+        if (!dst) {
+            continue;
+        }
+        /* Keep both surfaces in sRGB so this isn't a tonemapping blit */
+        SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_SRGB);
+        for (y = 0; y < h; ++y) {
+            Uint32 *dstpixels = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+            for (x = 0; x < w; ++x) {
+                dstpixels[x] = (Uint32)SDLTest_RandomUint32();
+            }
+        }
+        orig = SDL_DuplicateSurface(dst);
+        SDLTest_AssertCheck(orig != NULL, "SDL_DuplicateSurface()");
+        if (!orig) {
+            SDL_DestroySurface(dst);
+            continue;
+        }
+
+        result = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(result, "SDL_BlitSurface() to %s, expected: true, got: %s", SDL_GetPixelFormatName(format), result ? "true" : "false");
+
+        for (y = 0; y < h; ++y) {
+            const Uint32 *dstpixels = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+            const Uint32 *origpixels = (const Uint32 *)((const Uint8 *)orig->pixels + y * orig->pitch);
+            srcpixels = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+            for (x = 0; x < w; ++x) {
+                Uint32 sR, sG, sB, sA, dR, dG, dB, R, G, B;
+
+                if ((x % 3) == 0) {
+                    if (dstpixels[x] != origpixels[x]) {
+                        ++mismatches;
+                    }
+                    continue;
+                }
+                sA = (srcpixels[x] >> 24) & 0xFF;
+                sR = (srcpixels[x] >> 16) & 0xFF;
+                sG = (srcpixels[x] >> 8) & 0xFF;
+                sB = srcpixels[x] & 0xFF;
+                if (is_10bit) {
+                    dR = (origpixels[x] >> 22) & 0xFF;
+                    dG = (origpixels[x] >> 12) & 0xFF;
+                    dB = (origpixels[x] >> 2) & 0xFF;
+                    R = (dstpixels[x] >> 22) & 0xFF;
+                    G = (dstpixels[x] >> 12) & 0xFF;
+                    B = (dstpixels[x] >> 2) & 0xFF;
+                } else {
+                    const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(format);
+                    Uint8 r, g, b;
+
+                    SDL_GetRGB(origpixels[x], details, NULL, &r, &g, &b);
+                    dR = r;
+                    dG = g;
+                    dB = b;
+                    SDL_GetRGB(dstpixels[x], details, NULL, &r, &g, &b);
+                    R = r;
+                    G = g;
+                    B = b;
+                }
+                /* Allow for rounding differences between blitters */
+                dR = (sR * sA + (255 - sA) * dR) / 255;
+                dG = (sG * sA + (255 - sA) * dG) / 255;
+                dB = (sB * sA + (255 - sA) * dB) / 255;
+                if (SDL_abs((int)R - (int)dR) > 2 || SDL_abs((int)G - (int)dG) > 2 || SDL_abs((int)B - (int)dB) > 2) {
+                    ++mismatches;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Check blended pixels for %s, expected: 0 mismatches, got: %d", SDL_GetPixelFormatName(format), mismatches);
+
+        SDL_DestroySurface(orig);
+        SDL_DestroySurface(dst);
+    }
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/* Blits a colorkeyed surface without blending and returns how many pixels don't match */
+static int CheckColorkeyBlit(SDL_PixelFormat src_format, SDL_PixelFormat dst_format, int scale, Uint8 mod)
+{
+    const int w = 17, h = 3;
+    SDL_Surface *src = SDL_CreateSurface(w, h, src_format);
+    SDL_Surface *dst = SDL_CreateSurface(w * scale, h * scale, dst_format);
+    SDL_Surface *orig = NULL;
+    int x, y, mismatches = -1;
+    bool result;
+
+    SDLTest_AssertCheck(src && dst, "SDL_CreateSurface(%s) and SDL_CreateSurface(%s)", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+    if (!src || !dst) {
+        goto done;
+    }
+    /* Keep both surfaces in sRGB so this isn't a tonemapping blit */
+    SDL_SetSurfaceColorspace(src, SDL_COLORSPACE_SRGB);
+    SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_SRGB);
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            if ((x % 3) == 0) {
+                SDL_WriteSurfacePixel(src, x, y, 0x12, 0x34, 0x56, 0xFF);
+            } else {
+                SDL_WriteSurfacePixel(src, x, y, SDLTest_RandomIntegerInRange(0x80, 0xFF), SDLTest_RandomUint8(), SDLTest_RandomUint8(), 0xFF);
+            }
+        }
+    }
+    for (y = 0; y < dst->h; ++y) {
+        for (x = 0; x < dst->w; ++x) {
+            SDL_WriteSurfacePixel(dst, x, y, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), 0xFF);
+        }
+    }
+    orig = SDL_DuplicateSurface(dst);
+    SDLTest_AssertCheck(orig != NULL, "SDL_DuplicateSurface()");
+    if (!orig) {
+        goto done;
+    }
+
+    SDL_SetSurfaceColorKey(src, true, SDL_MapSurfaceRGB(src, 0x12, 0x34, 0x56));
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorMod(src, mod, mod, mod);
+    if (scale > 1) {
+        result = SDL_BlitSurfaceScaled(src, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+    } else {
+        result = SDL_BlitSurface(src, NULL, dst, NULL);
+    }
+    SDLTest_AssertCheck(result, "Blit %s to %s, expected: true, got: %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), result ? "true" : "false");
+
+    mismatches = 0;
+    for (y = 0; y < dst->h; ++y) {
+        for (x = 0; x < dst->w; ++x) {
+            Uint8 r, g, b, er, eg, eb;
+
+            if (((x / scale) % 3) == 0) {
+                SDL_ReadSurfacePixel(orig, x, y, &er, &eg, &eb, NULL);
+            } else {
+                SDL_ReadSurfacePixel(src, x / scale, y / scale, &er, &eg, &eb, NULL);
+                er = (Uint8)(er * mod / 255);
+                eg = (Uint8)(eg * mod / 255);
+                eb = (Uint8)(eb * mod / 255);
+            }
+            SDL_ReadSurfacePixel(dst, x, y, &r, &g, &b, NULL);
+            /* Allow for rounding differences between blitters */
+            if (SDL_abs(r - er) > 2 || SDL_abs(g - eg) > 2 || SDL_abs(b - eb) > 2) {
+                ++mismatches;
+            }
+        }
+    }
+
+done:
+    SDL_DestroySurface(orig);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(src);
+    return mismatches;
+}
+
+/**
+ * Tests colorkey blits without blending, combined with scaling, color
+ * modulation and 10-bit formats.
+ *
+ * \sa SDL_SetSurfaceColorKey
+ * \sa SDL_SetSurfaceColorMod
+ * \sa SDL_BlitSurface
+ * \sa SDL_BlitSurfaceScaled
+ */
+static int SDLCALL surface_testBlitColorkeyNoBlend(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_PixelFormat dst_format;
+        int scale;
+        Uint8 mod;
+    } tests[] = {
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, 2, 0xFF },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, 1, 0x80 },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, 2, 0x80 },
+        { SDL_PIXELFORMAT_ARGB2101010, SDL_PIXELFORMAT_XRGB8888, 1, 0xFF },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB2101010, 1, 0xFF },
+        { SDL_PIXELFORMAT_ARGB2101010, SDL_PIXELFORMAT_ARGB2101010, 2, 0x80 },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR2101010, 1, 0xFF },
+        { SDL_PIXELFORMAT_XRGB2101010, SDL_PIXELFORMAT_XRGB8888, 1, 0xFF },
+    };
+    int i;
+
+    for (i = 0; i < SDL_arraysize(tests); ++i) {
+        const int mismatches = CheckColorkeyBlit(tests[i].src_format, tests[i].dst_format, tests[i].scale, tests[i].mod);
+        SDLTest_AssertCheck(mismatches == 0, "Check %s to %s, scale %d, color mod 0x%.2x, expected: 0 mismatches, got: %d",
+                            SDL_GetPixelFormatName(tests[i].src_format), SDL_GetPixelFormatName(tests[i].dst_format),
+                            tests[i].scale, tests[i].mod, mismatches);
+    }
+    return TEST_COMPLETED;
+}
+
+/* Sum of how far each 4x4 block's average red differs from the source */
+static int GetBlockAverageError(SDL_Surface *src, SDL_Surface *dst, const SDL_Palette *palette)
+{
+    int x, y, i, j, error = 0;
+
+    for (y = 0; y + 4 <= dst->h; y += 4) {
+        for (x = 0; x + 4 <= dst->w; x += 4) {
+            int src_sum = 0, dst_sum = 0;
+            for (j = 0; j < 4; ++j) {
+                const Uint8 *dstpixels = (const Uint8 *)dst->pixels + (y + j) * dst->pitch;
+                for (i = 0; i < 4; ++i) {
+                    Uint8 r, g, b, a;
+                    SDL_ReadSurfacePixel(src, x + i, y + j, &r, &g, &b, &a);
+                    src_sum += r;
+                    dst_sum += palette->colors[dstpixels[x + i]].r;
+                }
+            }
+            error += SDL_abs(src_sum - dst_sum) / 16;
+        }
+    }
+    return error;
+}
+
+/**
+ * Tests that blits to a palettized surface pick the nearest palette color
+ * and that ordered dithering adds intermediate shades to gradients.
+ *
+ * \sa SDL_BlitSurface
+ * \sa SDL_MapRGBA
+ */
+static int SDLCALL surface_testPaletteNearestColor(void *arg)
+{
+    const int w = 256, h = 16;
+    SDL_Surface *src = NULL;
+    SDL_Surface *dst = NULL;
+    SDL_Palette *palette;
+    const SDL_PixelFormatDetails *fmt;
+    Uint8 *srcpixels;
+    Uint8 *dstpixels;
+    int i, x, y, mismatches, plain_error, dither_error;
+    bool result;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA8888);
+    SDLTest_AssertCheck(src != NULL, "SDL_CreateSurface(RGBA8888)");
+    dst = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(dst != NULL, "SDL_CreateSurface(INDEX8)");
+    if (!src || !dst) {
+        goto cleanup;
+    }
+    palette = SDL_CreateSurfacePalette(dst);
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreateSurfacePalette()");
+    if (!palette) {
+        goto cleanup;
+    }
+    for (i = 0; i < palette->ncolors; ++i) {
+        palette->colors[i].r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        palette->colors[i].g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        palette->colors[i].b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        palette->colors[i].a = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+    }
+    SDL_SetPaletteColors(palette, palette->colors, 0, palette->ncolors);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+
+    /* Random pixels should map exactly like SDL_MapRGBA() */
+    fmt = SDL_GetPixelFormatDetails(dst->format);
+    for (y = 0; y < h; ++y) {
+        srcpixels = (Uint8 *)src->pixels + y * src->pitch;
+        for (x = 0; x < w * 4; ++x) {
+            srcpixels[x] = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        }
+    }
+    result = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(result, "SDL_BlitSurface(), expected: true, got: %s", result ? "true" : "false");
+    mismatches = 0;
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            Uint8 r, g, b, a;
+            SDL_ReadSurfacePixel(src, x, y, &r, &g, &b, &a);
+            dstpixels = (Uint8 *)dst->pixels + y * dst->pitch;
+            if (dstpixels[x] != SDL_MapRGBA(fmt, palette, r, g, b, a)) {
+                ++mismatches;
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Check nearest palette colors, expected: 0 mismatches, got: %d", mismatches);
+
+    /* A smooth gradient against a coarse palette should use more indices when dithered */
+    for (i = 0; i < palette->ncolors; ++i) {
+        palette->colors[i].r = (Uint8)(((i >> 5) & 7) * 255 / 7);
+        palette->colors[i].g = (Uint8)(((i >> 2) & 7) * 255 / 7);
+        palette->colors[i].b = (Uint8)((i & 3) * 255 / 3);
+        palette->colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    SDL_SetPaletteColors(palette, palette->colors, 0, palette->ncolors);
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            SDL_WriteSurfacePixel(src, x, y, (Uint8)x, (Uint8)x, (Uint8)x, SDL_ALPHA_OPAQUE);
+        }
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    plain_error = GetBlockAverageError(src, dst, palette);
+
+    SDL_SetBooleanProperty(SDL_GetSurfaceProperties(src), SDL_PROP_SURFACE_DITHER_BOOLEAN, true);
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    dither_error = GetBlockAverageError(src, dst, palette);
+    SDLTest_AssertCheck(dither_error < plain_error / 2, "Check dithered error, expected less than %d, got: %d", plain_error / 2, dither_error);
+
+cleanup:
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    return TEST_COMPLETED;
+}
+
 
 /* ================= Test References ================== */
 
@@ -2226,10 +2703,26 @@ static const SDLTest_TestCaseReference surfaceTestScale = {
     surface_testScale, "surface_testScale", "Test scaling operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestScaleLinearBitExact = {
+    surface_testScaleLinearBitExact, "surface_testScaleLinearBitExact", "Test that SIMD linear scaling is bit-exact.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTest16BitTo32Bit = {
     surface_test16BitTo32Bit, "surface_test16BitTo32Bit", "Test conversion from 16-bit to 32-bit pixels.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestBlitColorkeyBlend = {
+    surface_testBlitColorkeyBlend, "surface_testBlitColorkeyBlend", "Test blending with a colorkey, including to 10-bit surfaces.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitColorkeyNoBlend = {
+    surface_testBlitColorkeyNoBlend, "surface_testBlitColorkeyNoBlend", "Test colorkey blits with scaling, color modulation and 10-bit surfaces.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestPaletteNearestColor = {
+    surface_testPaletteNearestColor, "surface_testPaletteNearestColor", "Test nearest color matching and dithering for palettized blits.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestInvalidFormat,
@@ -2263,7 +2756,11 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
+    &surfaceTestScaleLinearBitExact,
     &surfaceTest16BitTo32Bit,
+    &surfaceTestBlitColorkeyBlend,
+    &surfaceTestBlitColorkeyNoBlend,
+    &surfaceTestPaletteNearestColor,
     NULL
 };
 
@@ -114,6 +114,15 @@ static Uint32 SDLCALL timerTestCallback(void *param, SDL_TimerID timerID, Uint32
     return 0;
 }
 
+/* Counts the calls of each timer in timer_removeManyTimers() */
+static SDL_AtomicInt g_timerCalls[32];
+
+static Uint32 SDLCALL timerCountingCallback(void *param, SDL_TimerID timerID, Uint32 interval)
+{
+    SDL_AddAtomicInt((SDL_AtomicInt *)param, 1);
+    return 0;
+}
+
 #endif
 
 /**
@@ -174,6 +183,49 @@ static int SDLCALL timer_addRemoveTimer(void *arg)
 #endif
 }
 
+/**
+ * Remove timers that are scheduled between others, so they come out of the
+ * middle of the timer queue, and check that exactly the others fire.
+ */
+static int SDLCALL timer_removeManyTimers(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_TimerID ids[SDL_arraysize(g_timerCalls)];
+    int i, removed = 0, wrong = 0;
+
+    for (i = 0; i < SDL_arraysize(ids); ++i) {
+        SDL_SetAtomicInt(&g_timerCalls[i], 0);
+        /* Shuffle the due times, so the removed timers are all over the queue */
+        ids[i] = SDL_AddTimer(50 + ((i * 7) % SDL_arraysize(ids)) * 2, timerCountingCallback, &g_timerCalls[i]);
+    }
+    SDLTest_AssertPass("Call to SDL_AddTimer() x%d", (int)SDL_arraysize(ids));
+
+    for (i = 1; i < SDL_arraysize(ids); i += 2) {
+        if (SDL_RemoveTimer(ids[i])) {
+            ++removed;
+        }
+    }
+    SDLTest_AssertCheck(removed == SDL_arraysize(ids) / 2, "Check every other timer was removed, expected %d, got %d", (int)SDL_arraysize(ids) / 2, removed);
+
+    SDL_Delay(400);
+    SDLTest_AssertPass("Call to SDL_Delay(400)");
+
+    for (i = 0; i < SDL_arraysize(ids); ++i) {
+        const int expected = (i % 2) ? 0 : 1;
+        if (SDL_GetAtomicInt(&g_timerCalls[i]) != expected) {
+            SDLTest_LogError("Timer %d was called %d times, expected %d", i, SDL_GetAtomicInt(&g_timerCalls[i]), expected);
+            ++wrong;
+        }
+    }
+    SDLTest_AssertCheck(wrong == 0, "Check only the remaining timers were called once, %d were wrong", wrong);
+
+    return TEST_COMPLETED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -193,9 +245,13 @@ static const SDLTest_TestCaseReference timerTest4 = {
     timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    timer_removeManyTimers, "timer_removeManyTimers", "Remove timers from the middle of the timer queue", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, NULL
 };
 
 /* Timer test suite (global) */
@@ -0,0 +1,238 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measure blit throughput between pairs of pixel formats and list the
+   combinations that still end up in the generic SDL_Blit_Slow() and
+   SDL_Blit_Slow_Float() blitters.
+
+   SDL logs a debug message in the video category when it picks one of
+   those, so this program raises that priority and watches for it. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define WIDTH  256
+#define HEIGHT 256
+
+typedef enum
+{
+    MODE_COPY,
+    MODE_BLEND,
+    MODE_MODULATE_BLEND,
+    MODE_COLORKEY_BLEND,
+    MODE_SCALE_BLEND,
+    NUM_MODES
+} BlitMode;
+
+static const char *mode_names[NUM_MODES] = {
+    "copy",
+    "blend",
+    "modulate+blend",
+    "colorkey+blend",
+    "scale+blend",
+};
+
+static const SDL_PixelFormat formats[] = {
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_ARGB1555,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_XRGB2101010,
+    SDL_PIXELFORMAT_ARGB2101010,
+    SDL_PIXELFORMAT_ABGR2101010,
+    SDL_PIXELFORMAT_RGBA64,
+    SDL_PIXELFORMAT_RGBA64_FLOAT,
+    SDL_PIXELFORMAT_RGBA128_FLOAT,
+};
+
+static SDL_LogOutputFunction default_output;
+static void *default_userdata;
+static bool hit_slow_path;
+static bool verbose;
+
+static void SDLCALL LogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    if (category == SDL_LOG_CATEGORY_VIDEO && SDL_strncmp(message, "Using SDL_Blit_Slow", 19) == 0) {
+        hit_slow_path = true;
+        if (!verbose) {
+            return;
+        }
+    }
+    default_output(default_userdata, category, priority, message);
+}
+
+static SDL_Surface *CreateTestSurface(SDL_PixelFormat format, bool same_colorspace)
+{
+    SDL_Surface *surface = SDL_CreateSurface(WIDTH, HEIGHT, format);
+    Uint32 seed = 0x12345678;
+    int x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+    if (same_colorspace) {
+        SDL_SetSurfaceColorspace(surface, SDL_COLORSPACE_SRGB);
+    }
+    for (y = 0; y < surface->h; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->pitch; ++x) {
+            seed = seed * 1664525u + 1013904223u;
+            row[x] = (Uint8)(seed >> 24);
+        }
+    }
+    return surface;
+}
+
+static bool SetupBlit(SDL_Surface *src, BlitMode mode)
+{
+    switch (mode) {
+    case MODE_COPY:
+        return SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    case MODE_MODULATE_BLEND:
+        if (!SDL_SetSurfaceColorMod(src, 192, 128, 64)) {
+            return false;
+        }
+        break;
+    case MODE_COLORKEY_BLEND:
+        if (!SDL_SetSurfaceColorKey(src, true, SDL_MapSurfaceRGB(src, 0x12, 0x34, 0x56))) {
+            return false;
+        }
+        break;
+    default:
+        break;
+    }
+    return SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+}
+
+static bool DoBlit(SDL_Surface *src, SDL_Surface *dst, BlitMode mode)
+{
+    if (mode == MODE_SCALE_BLEND) {
+        const SDL_Rect dstrect = { 0, 0, WIDTH, HEIGHT };
+        const SDL_Rect srcrect = { 0, 0, WIDTH / 2, HEIGHT / 2 };
+        return SDL_BlitSurfaceScaled(src, &srcrect, dst, &dstrect, SDL_SCALEMODE_NEAREST);
+    }
+    return SDL_BlitSurface(src, NULL, dst, NULL);
+}
+
+static bool RunBlit(SDL_PixelFormat src_format, SDL_PixelFormat dst_format, BlitMode mode,
+                    int iterations, bool same_colorspace, int *slow_count)
+{
+    SDL_Surface *src = CreateTestSurface(src_format, same_colorspace);
+    SDL_Surface *dst = CreateTestSurface(dst_format, same_colorspace);
+    Uint64 start, elapsed;
+    bool result = true;
+    int i;
+
+    if (!src || !dst || !SetupBlit(src, mode)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up blit: %s", SDL_GetError());
+        result = false;
+        goto done;
+    }
+
+    hit_slow_path = false;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        if (!DoBlit(src, dst, mode)) {
+            /* Not every combination is supported, that's fine */
+            goto done;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    SDL_Log("%-28s -> %-28s %-15s %8.1f Mpixels/s%s",
+            SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), mode_names[mode],
+            (double)WIDTH * HEIGHT * iterations * 1000.0 / (double)elapsed,
+            hit_slow_path ? "  SLOW PATH" : "");
+    if (hit_slow_path) {
+        ++*slow_count;
+    }
+
+done:
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int iterations = 10;
+    bool same_colorspace = false;
+    int slow_count = 0;
+    int total = 0;
+    int result = 0;
+    int i, j, mode;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--same-colorspace") == 0) {
+                same_colorspace = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--verbose") == 0) {
+                verbose = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--iterations N]", "[--same-colorspace]", "[--verbose]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_GetLogOutputFunction(&default_output, &default_userdata);
+    SDL_SetLogOutputFunction(LogOutput, NULL);
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_VIDEO, SDL_LOG_PRIORITY_DEBUG);
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            for (mode = 0; mode < NUM_MODES; ++mode) {
+                if (!RunBlit(formats[i], formats[j], (BlitMode)mode, iterations, same_colorspace, &slow_count)) {
+                    result = 1;
+                }
+                ++total;
+            }
+        }
+    }
+    SDL_Log("%d of %d combinations use the slow path", slow_count, total);
+
+    SDL_SetLogOutputFunction(default_output, default_userdata);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,347 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Build a small directory tree and check that globbing it through a
+   directory cache gives the same results as SDL_GlobDirectory(), before and
+   after the tree changes. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#ifdef SDL_PLATFORM_LINUX
+#include <unistd.h>
+#endif
+
+#define TEST_DIR "dircache.tmp"
+
+static const char *tree_files[] = {
+    "a/x.txt",
+    "a/y.png",
+    "a/b/z.txt",
+    "a/b/deep/w.txt",
+    "c/X.TXT",
+    "top.txt",
+};
+
+static const char *patterns[] = {
+    NULL,
+    "*.txt",
+    "a/*.txt",
+    "a/b/*",
+    "*/*.txt",
+    "a/b/deep/w.txt",
+    "?/x.txt",
+    "missing/*",
+};
+
+static int SDLCALL CompareStrings(const void *a, const void *b)
+{
+    return SDL_strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+static bool SameLists(char **a, int acount, char **b, int bcount)
+{
+    int i;
+
+    if (!a || !b || acount != bcount) {
+        return false;
+    }
+    SDL_qsort(a, acount, sizeof(char *), CompareStrings);
+    SDL_qsort(b, bcount, sizeof(char *), CompareStrings);
+    for (i = 0; i < acount; ++i) {
+        if (SDL_strcmp(a[i], b[i]) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckPattern(SDL_DirectoryCache *cache, SDL_Storage *storage, const char *pattern, SDL_GlobFlags flags)
+{
+    char **expected;
+    char **globbed;
+    int expected_count = 0;
+    int globbed_count = 0;
+    bool result;
+
+    if (storage) {
+        expected = SDL_GlobStorageDirectory(storage, NULL, pattern, flags, &expected_count);
+    } else {
+        expected = SDL_GlobDirectory(TEST_DIR, pattern, flags, &expected_count);
+    }
+    globbed = SDL_GlobDirectoryCache(cache, pattern, flags, &globbed_count);
+    result = SameLists(expected, expected_count, globbed, globbed_count);
+    if (!result) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pattern \"%s\" (flags %u) found %d entries, expected %d",
+                     pattern ? pattern : "(null)", (unsigned int)flags, globbed_count, expected_count);
+    }
+    SDL_free(expected);
+    SDL_free(globbed);
+    return result;
+}
+
+static bool CheckAllPatterns(SDL_DirectoryCache *cache, SDL_Storage *storage)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(patterns); ++i) {
+        if (!CheckPattern(cache, storage, patterns[i], 0) ||
+            !CheckPattern(cache, storage, patterns[i], SDL_GLOB_CASEINSENSITIVE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool WriteTreeFile(const char *file)
+{
+    char *path = NULL;
+    bool result;
+
+    if (SDL_asprintf(&path, "%s/%s", TEST_DIR, file) < 0) {
+        return false;
+    }
+    result = SDL_SaveFile(path, file, SDL_strlen(file));
+    SDL_free(path);
+    return result;
+}
+
+static bool CreateTree(void)
+{
+    int i;
+
+    if (!SDL_CreateDirectory(TEST_DIR "/a/b/deep") || !SDL_CreateDirectory(TEST_DIR "/c")) {
+        return false;
+    }
+    for (i = 0; i < SDL_arraysize(tree_files); ++i) {
+        if (!WriteTreeFile(tree_files[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void RemoveTree(void)
+{
+    static const char *dirs[] = { "a/b/deep", "a/b", "a", "c", "new" };
+    char *path = NULL;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(tree_files); ++i) {
+        if (SDL_asprintf(&path, "%s/%s", TEST_DIR, tree_files[i]) >= 0) {
+            SDL_RemovePath(path);
+            SDL_free(path);
+        }
+    }
+    SDL_RemovePath(TEST_DIR "/a/new.txt");
+    SDL_RemovePath(TEST_DIR "/new/n.txt");
+    SDL_RemovePath(TEST_DIR "/link");
+    SDL_RemovePath(TEST_DIR "/real/new.txt");
+    SDL_RemovePath(TEST_DIR "/real");
+    for (i = 0; i < SDL_arraysize(dirs); ++i) {
+        if (SDL_asprintf(&path, "%s/%s", TEST_DIR, dirs[i]) >= 0) {
+            SDL_RemovePath(path);
+            SDL_free(path);
+        }
+    }
+    SDL_RemovePath(TEST_DIR);
+}
+
+static bool TestCache(SDL_DirectoryCache *cache, SDL_Storage *storage)
+{
+    if (!CheckAllPatterns(cache, storage)) {
+        return false;
+    }
+
+    /* Change the tree, then check that the cache picks it up after being invalidated */
+    if (!WriteTreeFile("a/new.txt") || !SDL_CreateDirectory(TEST_DIR "/new") || !WriteTreeFile("new/n.txt") ||
+        !SDL_RemovePath(TEST_DIR "/a/y.png")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't change the test tree: %s", SDL_GetError());
+        return false;
+    }
+    if (!SDL_InvalidateDirectoryCache(cache, "a") || !SDL_InvalidateDirectoryCache(cache, NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_InvalidateDirectoryCache() failed: %s", SDL_GetError());
+        return false;
+    }
+    if (!CheckAllPatterns(cache, storage) || !CheckPattern(cache, storage, "new/*", 0)) {
+        return false;
+    }
+
+    /* Put the tree back the way it was */
+    if (!SDL_RemovePath(TEST_DIR "/a/new.txt") || !SDL_RemovePath(TEST_DIR "/new/n.txt") ||
+        !SDL_RemovePath(TEST_DIR "/new") || !WriteTreeFile("a/y.png")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't restore the test tree: %s", SDL_GetError());
+        return false;
+    }
+    SDL_InvalidateDirectoryCache(cache, NULL);
+    return CheckAllPatterns(cache, storage);
+}
+
+static bool GlobHas(SDL_DirectoryCache *cache, const char *pattern, const char *path)
+{
+    char **globbed;
+    int i, count = 0;
+    bool found = false;
+
+    globbed = SDL_GlobDirectoryCache(cache, pattern, 0, &count);
+    if (globbed) {
+        for (i = 0; i < count; ++i) {
+            if (SDL_strcmp(globbed[i], path) == 0) {
+                found = true;
+            }
+        }
+        SDL_free(globbed);
+    }
+    return found;
+}
+
+/* A directory reached through a symlink shares its watch with the real path.
+   Dropping the symlink must not stop changes to the real path from showing up. */
+static bool TestSymlinkWatch(SDL_DirectoryCache *cache)
+{
+#ifdef SDL_PLATFORM_LINUX
+    bool found;
+
+    if (!SDL_CreateDirectory(TEST_DIR "/real")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create " TEST_DIR "/real: %s", SDL_GetError());
+        return false;
+    }
+    if (symlink("real", TEST_DIR "/link") != 0) {
+        SDL_Log("Couldn't create a symlink, skipping the symlink watch test");
+        SDL_RemovePath(TEST_DIR "/real");
+        return true;
+    }
+
+    /* Watch the symlink first, so it's the one that added the watch */
+    SDL_free(SDL_GlobDirectoryCache(cache, "link/*.txt", 0, NULL));
+    SDL_free(SDL_GlobDirectoryCache(cache, "real/*.txt", 0, NULL));
+
+    /* The cache notices the symlink is gone and frees its listing */
+    SDL_RemovePath(TEST_DIR "/link");
+    if (GlobHas(cache, "*", "link")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Directory cache didn't notice a removed symlink");
+        return false;
+    }
+
+    if (!WriteTreeFile("real/new.txt")) {
+        return false;
+    }
+    found = GlobHas(cache, "real/*.txt", "real/new.txt");
+    SDL_RemovePath(TEST_DIR "/real/new.txt");
+    SDL_RemovePath(TEST_DIR "/real");
+    SDL_InvalidateDirectoryCache(cache, NULL);
+    if (!found) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Directory cache stopped noticing changes after a symlink to the same directory went away");
+        return false;
+    }
+#endif
+    return true;
+}
+
+static bool TestWatch(SDL_DirectoryCache *cache)
+{
+    char **globbed;
+    int count = 0;
+    bool found = false;
+
+    /* Fill the cache, then change the tree without telling it */
+    SDL_free(SDL_GlobDirectoryCache(cache, "a/*.txt", 0, NULL));
+    if (!WriteTreeFile("a/new.txt")) {
+        return false;
+    }
+    globbed = SDL_GlobDirectoryCache(cache, "a/*.txt", 0, &count);
+    if (globbed) {
+        int i;
+        for (i = 0; i < count; ++i) {
+            if (SDL_strcmp(globbed[i], "a/new.txt") == 0) {
+                found = true;
+            }
+        }
+        SDL_free(globbed);
+    }
+    SDL_RemovePath(TEST_DIR "/a/new.txt");
+    SDL_InvalidateDirectoryCache(cache, NULL);
+
+    /* Only some platforms can notice changes, so this is informational */
+    SDL_Log("Directory cache %s changes on its own", found ? "noticed" : "didn't notice");
+    if (found) {
+        return TestSymlinkWatch(cache);
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_DirectoryCache *cache = NULL;
+    SDL_Storage *storage = NULL;
+    int result = 1;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
+        return 1;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    RemoveTree();
+    if (!CreateTree()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create the test tree: %s", SDL_GetError());
+        goto done;
+    }
+
+    cache = SDL_CreateDirectoryCache(TEST_DIR);
+    if (!cache) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateDirectoryCache() failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (!TestCache(cache, NULL) || !TestWatch(cache)) {
+        goto done;
+    }
+    SDL_DestroyDirectoryCache(cache);
+    cache = NULL;
+
+    storage = SDL_OpenFileStorage(TEST_DIR);
+    if (!storage) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenFileStorage() failed: %s", SDL_GetError());
+        goto done;
+    }
+    cache = SDL_CreateStorageDirectoryCache(storage, NULL);
+    if (!cache) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateStorageDirectoryCache() failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (!TestCache(cache, storage)) {
+        goto done;
+    }
+
+    SDL_Log("All directory cache tests passed");
+    result = 0;
+
+done:
+    SDL_DestroyDirectoryCache(cache);
+    SDL_CloseStorage(storage);
+    RemoveTree();
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,158 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check that the temporary memory carried by events is freed once the events
+   have been taken off the queue and the queue has been pumped again.
+
+   This counts live allocations with its own memory functions, which have to be
+   installed before SDL allocates anything, so it can't be part of testautomation. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_EVENTS 64
+
+static SDL_malloc_func orig_malloc;
+static SDL_calloc_func orig_calloc;
+static SDL_realloc_func orig_realloc;
+static SDL_free_func orig_free;
+static SDL_AtomicInt live_allocations;
+
+static void * SDLCALL counting_malloc(size_t size)
+{
+    void *mem = orig_malloc(size);
+    if (mem) {
+        SDL_AddAtomicInt(&live_allocations, 1);
+    }
+    return mem;
+}
+
+static void * SDLCALL counting_calloc(size_t nmemb, size_t size)
+{
+    void *mem = orig_calloc(nmemb, size);
+    if (mem) {
+        SDL_AddAtomicInt(&live_allocations, 1);
+    }
+    return mem;
+}
+
+static void * SDLCALL counting_realloc(void *ptr, size_t size)
+{
+    void *mem = orig_realloc(ptr, size);
+    if (mem && !ptr) {
+        SDL_AddAtomicInt(&live_allocations, 1);
+    }
+    return mem;
+}
+
+static void SDLCALL counting_free(void *ptr)
+{
+    if (ptr) {
+        SDL_AddAtomicInt(&live_allocations, -1);
+    }
+    orig_free(ptr);
+}
+
+static const void * SDLCALL clipboard_data_callback(void *userdata, const char *mime_type, size_t *size)
+{
+    *size = 0;
+    return NULL;
+}
+
+/* Announces `count` mime types of `length` characters, which the clipboard update event carries in temporary memory */
+static bool set_mime_types(int tag, int count, int length)
+{
+    static char storage[2][32 * 1024];
+    const char *mime_types[SDL_arraysize(storage)];
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        SDL_memset(storage[i], 'a' + i, length);
+        SDL_snprintf(storage[i], length, "x-test/%d-%d", tag, i);
+        storage[i][SDL_strlen(storage[i])] = '+';
+        storage[i][length] = '\0';
+        mime_types[i] = storage[i];
+    }
+    return SDL_SetClipboardData(clipboard_data_callback, NULL, NULL, mime_types, count);
+}
+
+/* Queues clipboard updates that need several arena chunks and one dedicated chunk, then takes them off the queue */
+static int queue_and_get_events(void)
+{
+    SDL_Event event;
+    int i, received = 0;
+
+    for (i = 0; i < NUM_EVENTS; ++i) {
+        set_mime_types(i, 2, 120);
+    }
+    set_mime_types(NUM_EVENTS, 2, 20000);
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_CLIPBOARD_UPDATE, SDL_EVENT_CLIPBOARD_UPDATE) == 1) {
+        if (event.clipboard.num_mime_types == 2) {
+            ++received;
+        }
+    }
+    /* Pumping frees the memory of the events taken off the queue */
+    SDL_PumpEvents();
+    return received;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int baseline, received, result = 0;
+
+    /* Count allocations from the very start, so every free has a matching allocation */
+    SDL_GetMemoryFunctions(&orig_malloc, &orig_calloc, &orig_realloc, &orig_free);
+    SDL_SetMemoryFunctions(counting_malloc, counting_calloc, counting_realloc, counting_free);
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
+        return 1;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_SetEventEnabled(SDL_EVENT_CLIPBOARD_UPDATE, true);
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* The first round grows the event queue and the arena ahead of time */
+    received = queue_and_get_events();
+    baseline = SDL_GetAtomicInt(&live_allocations);
+
+    received += queue_and_get_events();
+    if (received != 2 * (NUM_EVENTS + 1)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d clipboard updates, got %d", 2 * (NUM_EVENTS + 1), received);
+        result = 1;
+    }
+    if (SDL_GetAtomicInt(&live_allocations) != baseline) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Temporary event memory wasn't freed, expected %d live allocations, got %d",
+                     baseline, SDL_GetAtomicInt(&live_allocations));
+        result = 1;
+    } else {
+        SDL_Log("Temporary event memory was freed, %d live allocations", baseline);
+    }
+
+    SDL_ClearClipboardData();
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,310 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple test of the SDL job pool */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_JOBS     100000
+#define NUM_PARENTS  64
+#define NUM_CHILDREN 256
+
+typedef struct
+{
+    SDL_JobPool *pool;
+    SDL_AtomicInt done;
+    int results[NUM_JOBS];
+} FlatData;
+
+typedef struct
+{
+    FlatData *data;
+    int index;
+} FlatJob;
+
+typedef struct
+{
+    SDL_JobPool *pool;
+    SDL_AtomicInt children_done;
+    int index;
+} ParentJob;
+
+typedef struct
+{
+    SDL_JobGroup *group;
+    SDL_AtomicInt released;
+    SDL_AtomicInt waited;
+} LateData;
+
+static FlatJob flat_jobs[NUM_JOBS];
+static ParentJob parent_jobs[NUM_PARENTS];
+
+static void SDLCALL FlatJobFunc(void *userdata)
+{
+    FlatJob *job = (FlatJob *)userdata;
+    Uint32 value = (Uint32)job->index;
+    int i;
+
+    /* Do a little bit of busy work so the job isn't pure overhead */
+    for (i = 0; i < 100; ++i) {
+        value = value * 1664525u + 1013904223u;
+    }
+    job->data->results[job->index] = (int)(value & 0x7FFFFFFF) | 1;
+    SDL_AddAtomicInt(&job->data->done, 1);
+}
+
+static void SDLCALL ChildJobFunc(void *userdata)
+{
+    ParentJob *parent = (ParentJob *)userdata;
+
+    SDL_AddAtomicInt(&parent->children_done, 1);
+}
+
+static void SDLCALL ParentJobFunc(void *userdata)
+{
+    ParentJob *parent = (ParentJob *)userdata;
+    SDL_JobGroup *group = SDL_CreateJobGroup(parent->pool);
+    int i;
+
+    if (!group) {
+        return;
+    }
+
+    /* Jobs that wait on other jobs mustn't starve the pool */
+    for (i = 0; i < NUM_CHILDREN; ++i) {
+        SDL_SubmitJob(parent->pool, group, ChildJobFunc, parent);
+    }
+    SDL_WaitJobGroup(group);
+    SDL_DestroyJobGroup(group);
+}
+
+static void SDLCALL SpinJobFunc(void *userdata)
+{
+    LateData *data = (LateData *)userdata;
+
+    while (!SDL_GetAtomicInt(&data->released)) {
+        SDL_Delay(1);
+    }
+}
+
+static void SDLCALL WaiterJobFunc(void *userdata)
+{
+    LateData *data = (LateData *)userdata;
+
+    SDL_WaitJobGroup(data->group);
+    SDL_SetAtomicInt(&data->waited, 1);
+}
+
+static void SDLCALL ReleaseJobFunc(void *userdata)
+{
+    LateData *data = (LateData *)userdata;
+
+    SDL_SetAtomicInt(&data->released, 1);
+}
+
+static bool TestFlat(int num_threads)
+{
+    static FlatData data;
+    SDL_JobGroup *group;
+    Uint64 start, elapsed;
+    int i;
+
+    data.pool = SDL_CreateJobPool(num_threads);
+    if (!data.pool) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobPool(%d) failed: %s", num_threads, SDL_GetError());
+        return false;
+    }
+    SDL_SetAtomicInt(&data.done, 0);
+    SDL_memset(data.results, 0, sizeof(data.results));
+
+    group = SDL_CreateJobGroup(data.pool);
+    if (!group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobGroup() failed: %s", SDL_GetError());
+        SDL_DestroyJobPool(data.pool);
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_JOBS; ++i) {
+        flat_jobs[i].data = &data;
+        flat_jobs[i].index = i;
+        if (!SDL_SubmitJob(data.pool, group, FlatJobFunc, &flat_jobs[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_SubmitJob() failed: %s", SDL_GetError());
+            break;
+        }
+    }
+    SDL_WaitJobGroup(group);
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_Log("%d jobs on %d worker threads took %" SDL_PRIu64 " us",
+            NUM_JOBS, SDL_GetJobPoolThreadCount(data.pool), elapsed / SDL_NS_PER_US);
+
+    SDL_DestroyJobGroup(group);
+    SDL_DestroyJobPool(data.pool);
+
+    if (SDL_GetAtomicInt(&data.done) != NUM_JOBS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d jobs ran", SDL_GetAtomicInt(&data.done), NUM_JOBS);
+        return false;
+    }
+    for (i = 0; i < NUM_JOBS; ++i) {
+        if (!data.results[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Job %d didn't run", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool TestNested(int num_threads)
+{
+    SDL_JobPool *pool;
+    SDL_JobGroup *group;
+    bool result = true;
+    int i;
+
+    pool = SDL_CreateJobPool(num_threads);
+    if (!pool) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobPool(%d) failed: %s", num_threads, SDL_GetError());
+        return false;
+    }
+    group = SDL_CreateJobGroup(pool);
+    if (!group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobGroup() failed: %s", SDL_GetError());
+        SDL_DestroyJobPool(pool);
+        return false;
+    }
+
+    for (i = 0; i < NUM_PARENTS; ++i) {
+        parent_jobs[i].pool = pool;
+        parent_jobs[i].index = i;
+        SDL_SetAtomicInt(&parent_jobs[i].children_done, 0);
+        SDL_SubmitJob(pool, group, ParentJobFunc, &parent_jobs[i]);
+    }
+    SDL_WaitJobGroup(group);
+
+    for (i = 0; i < NUM_PARENTS; ++i) {
+        if (SDL_GetAtomicInt(&parent_jobs[i].children_done) != NUM_CHILDREN) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Parent job %d saw %d of %d children finish",
+                         i, SDL_GetAtomicInt(&parent_jobs[i].children_done), NUM_CHILDREN);
+            result = false;
+        }
+    }
+
+    if (result) {
+        SDL_Log("Nested jobs on %d worker threads completed", SDL_GetJobPoolThreadCount(pool));
+    }
+
+    SDL_DestroyJobGroup(group);
+    SDL_DestroyJobPool(pool);
+    return result;
+}
+
+/* A job submitted while every worker is busy or waiting on a group must still run */
+static bool TestLateSubmit(void)
+{
+    static LateData data;
+    SDL_JobPool *pool;
+    Uint64 start;
+    bool result = true;
+
+    pool = SDL_CreateJobPool(2);
+    if (!pool) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobPool(2) failed: %s", SDL_GetError());
+        return false;
+    }
+    if (SDL_GetJobPoolThreadCount(pool) != 2) {
+        SDL_Log("Skipping late submit test, only got %d worker threads", SDL_GetJobPoolThreadCount(pool));
+        SDL_DestroyJobPool(pool);
+        return true;
+    }
+    data.group = SDL_CreateJobGroup(pool);
+    if (!data.group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobGroup() failed: %s", SDL_GetError());
+        SDL_DestroyJobPool(pool);
+        return false;
+    }
+    SDL_SetAtomicInt(&data.released, 0);
+    SDL_SetAtomicInt(&data.waited, 0);
+
+    /* One worker spins on the group's job, the other waits for the group */
+    SDL_SubmitJob(pool, data.group, SpinJobFunc, &data);
+    SDL_SubmitJob(pool, NULL, WaiterJobFunc, &data);
+    SDL_Delay(100);
+    SDL_SubmitJob(pool, NULL, ReleaseJobFunc, &data);
+
+    start = SDL_GetTicks();
+    while (!SDL_GetAtomicInt(&data.waited)) {
+        if (SDL_GetTicks() - start > 5000) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Job submitted to a busy pool never ran");
+            SDL_SetAtomicInt(&data.released, 1);
+            result = false;
+            break;
+        }
+        SDL_Delay(1);
+    }
+
+    SDL_DestroyJobGroup(data.group);
+    SDL_DestroyJobPool(pool);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_threads = 0;
+    int i;
+    int result = 0;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                num_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("System has %d logical CPU cores", SDL_GetNumLogicalCPUCores());
+
+    if (!TestFlat(1) || !TestFlat(num_threads) ||
+        !TestNested(1) || !TestNested(num_threads) ||
+        !TestLateSubmit()) {
+        result = 1;
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -77,6 +77,84 @@ static void Draw(DrawState *s)
     SDL_RenderPresent(s->renderer);
 }
 
+static bool BenchmarkStretchMode(SDL_Surface *src, SDL_Surface *dst, SDL_Surface *reference, SDL_ScaleMode mode, const char *threads, int iterations, Uint64 *elapsed)
+{
+    Uint64 start;
+    int i;
+
+    SDL_SetHint(SDL_HINT_SURFACE_STRETCH_THREADS, threads);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_StretchSurface(src, NULL, dst, NULL, mode)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_StretchSurface() failed: %s", SDL_GetError());
+            return false;
+        }
+    }
+    *elapsed = (SDL_GetTicksNS() - start) / iterations;
+
+    if (reference && SDL_memcmp(reference->pixels, dst->pixels, (size_t)dst->pitch * dst->h) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Multithreaded output doesn't match single threaded output");
+        return false;
+    }
+    return true;
+}
+
+/* Compare single threaded and multithreaded scaling of a 4K frame to 1080p */
+static int Benchmark(int iterations)
+{
+    static const struct
+    {
+        SDL_ScaleMode mode;
+        const char *name;
+    } modes[] = {
+        { SDL_SCALEMODE_NEAREST, "nearest" },
+        { SDL_SCALEMODE_LINEAR, "linear" },
+    };
+    SDL_Surface *src, *dst, *reference;
+    Uint32 seed = 1;
+    Uint32 *pixels;
+    int result = 0;
+    int i;
+
+    src = SDL_CreateSurface(3840, 2160, SDL_PIXELFORMAT_XRGB8888);
+    dst = SDL_CreateSurface(1920, 1080, SDL_PIXELFORMAT_XRGB8888);
+    reference = SDL_CreateSurface(1920, 1080, SDL_PIXELFORMAT_XRGB8888);
+    if (!src || !dst || !reference) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    pixels = (Uint32 *)src->pixels;
+    for (i = 0; i < src->w * src->h; ++i) {
+        seed = seed * 1103515245 + 12345;
+        pixels[i] = seed;
+    }
+
+    SDL_Log("Scaling %dx%d to %dx%d, %d iterations, %d logical CPU cores",
+            src->w, src->h, dst->w, dst->h, iterations, SDL_GetNumLogicalCPUCores());
+
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        Uint64 single, multi;
+
+        if (!BenchmarkStretchMode(src, reference, NULL, modes[i].mode, "1", iterations, &single) ||
+            !BenchmarkStretchMode(src, dst, reference, modes[i].mode, "0", iterations, &multi)) {
+            result = 1;
+            break;
+        }
+        SDL_Log("%-8s single threaded: %8.3f ms, multithreaded: %8.3f ms",
+                modes[i].name, single / 1000000.0, multi / 1000000.0);
+    }
+
+done:
+    SDL_ResetHint(SDL_HINT_SURFACE_STRETCH_THREADS);
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(reference);
+    return result;
+}
+
 static void loop(void)
 {
     int i;
@@ -105,6 +183,7 @@ int main(int argc, char *argv[])
     int frames;
     Uint64 then, now;
     SDL_ScaleMode scale_mode = SDL_SCALEMODE_PIXELART;
+    int benchmark = 0;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, SDL_INIT_VIDEO);
@@ -128,6 +207,13 @@ int main(int argc, char *argv[])
             } else if (SDL_strcasecmp(argv[i], "--pixelart") == 0) {
                 scale_mode = SDL_SCALEMODE_PIXELART;
                 consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--benchmark") == 0) {
+                benchmark = 10;
+                consumed = 1;
+                if (argv[i + 1] && SDL_isdigit(*argv[i + 1])) {
+                    benchmark = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                }
             }
         }
         if (consumed < 0) {
@@ -135,6 +221,7 @@ int main(int argc, char *argv[])
                 "[--nearest]",
                 "[--linear]",
                 "[--pixelart]",
+                "[--benchmark [iterations]]",
                 NULL
             };
             SDLTest_CommonLogUsage(state, argv[0], options);
@@ -143,6 +230,13 @@ int main(int argc, char *argv[])
         i += consumed;
     }
 
+    if (benchmark) {
+        int result = Benchmark(benchmark);
+        SDL_Quit();
+        SDLTest_CommonDestroyState(state);
+        return result;
+    }
+
     if (!SDLTest_CommonInit(state)) {
         quit(1);
     }
@@ -0,0 +1,244 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Write and read back files with the async storage functions, both on file
+   storage, which goes through async I/O, and on an app-defined storage that
+   only has synchronous functions. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_FILES 8
+#define FILE_SIZE 100000
+
+static Uint8 contents[NUM_FILES][FILE_SIZE];
+
+/* An app-defined storage container that holds a single file in memory */
+static char memory_file[64];
+
+static bool SDLCALL Memory_Info(void *userdata, const char *path, SDL_PathInfo *info)
+{
+    if (SDL_strcmp(path, "memory.txt") != 0) {
+        return SDL_SetError("No such file");
+    }
+    info->type = SDL_PATHTYPE_FILE;
+    info->size = SDL_strlen(memory_file);
+    return true;
+}
+
+static bool SDLCALL Memory_ReadFile(void *userdata, const char *path, void *destination, Uint64 length)
+{
+    if (SDL_strcmp(path, "memory.txt") != 0 || length != SDL_strlen(memory_file)) {
+        return SDL_SetError("No such file");
+    }
+    SDL_memcpy(destination, memory_file, (size_t)length);
+    return true;
+}
+
+static bool SDLCALL Memory_WriteFile(void *userdata, const char *path, const void *source, Uint64 length)
+{
+    if (SDL_strcmp(path, "memory.txt") != 0 || length >= sizeof(memory_file)) {
+        return SDL_SetError("Can't write that");
+    }
+    SDL_memcpy(memory_file, source, (size_t)length);
+    memory_file[length] = '\0';
+    return true;
+}
+
+static bool WaitForOutcome(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    Uint64 start = SDL_GetTicks();
+
+    /* Oneshot requests may return false once while their file is closed */
+    while (!SDL_WaitAsyncIOResult(queue, outcome, 100)) {
+        if (SDL_GetTicks() - start > 10000) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Timed out waiting for an async storage request");
+            return false;
+        }
+    }
+    if (outcome->asyncio != NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Async storage outcome has an SDL_AsyncIO");
+        return false;
+    }
+    if (outcome->result != SDL_ASYNCIO_COMPLETE || outcome->bytes_transferred != outcome->bytes_requested) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Async storage request failed");
+        return false;
+    }
+    return true;
+}
+
+static bool TestFileStorage(SDL_Storage *storage, SDL_AsyncIOQueue *queue)
+{
+    char path[32];
+    bool seen[NUM_FILES];
+    int i;
+
+    for (i = 0; i < NUM_FILES; ++i) {
+        SDL_snprintf(path, sizeof(path), "storageasync%d.tmp", i);
+        if (!SDL_WriteStorageFileAsync(storage, path, contents[i], FILE_SIZE, queue, &contents[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_WriteStorageFileAsync(\"%s\") failed: %s", path, SDL_GetError());
+            return false;
+        }
+    }
+
+    SDL_zeroa(seen);
+    for (i = 0; i < NUM_FILES; ++i) {
+        SDL_AsyncIOOutcome outcome;
+        int index;
+
+        if (!WaitForOutcome(queue, &outcome)) {
+            return false;
+        }
+        index = (int)((Uint8(*)[FILE_SIZE])outcome.userdata - contents);
+        if (outcome.type != SDL_ASYNCIO_TASK_WRITE || index < 0 || index >= NUM_FILES || seen[index] ||
+            outcome.buffer != contents[index] || outcome.bytes_transferred != FILE_SIZE) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unexpected write outcome");
+            return false;
+        }
+        seen[index] = true;
+    }
+
+    for (i = 0; i < NUM_FILES; ++i) {
+        SDL_snprintf(path, sizeof(path), "storageasync%d.tmp", i);
+        if (!SDL_ReadStorageFileAsync(storage, path, queue, &contents[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadStorageFileAsync(\"%s\") failed: %s", path, SDL_GetError());
+            return false;
+        }
+    }
+
+    SDL_zeroa(seen);
+    for (i = 0; i < NUM_FILES; ++i) {
+        SDL_AsyncIOOutcome outcome;
+        int index;
+        bool matches;
+
+        if (!WaitForOutcome(queue, &outcome)) {
+            return false;
+        }
+        index = (int)((Uint8(*)[FILE_SIZE])outcome.userdata - contents);
+        matches = (outcome.type == SDL_ASYNCIO_TASK_READ && index >= 0 && index < NUM_FILES && !seen[index] &&
+                   outcome.bytes_transferred == FILE_SIZE && SDL_memcmp(outcome.buffer, contents[index], FILE_SIZE) == 0);
+        SDL_free(outcome.buffer);
+        if (!matches) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unexpected read outcome");
+            return false;
+        }
+        seen[index] = true;
+    }
+
+    if (SDL_ReadStorageFileAsync(storage, "missing.tmp", queue, NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reading a missing file succeeded");
+        return false;
+    }
+    return true;
+}
+
+static bool TestMemoryStorage(SDL_AsyncIOQueue *queue)
+{
+    SDL_StorageInterface iface;
+    SDL_Storage *storage;
+    SDL_AsyncIOOutcome outcome;
+    static const char text[] = "Hello from memory";
+    bool result = false;
+
+    SDL_INIT_INTERFACE(&iface);
+    iface.info = Memory_Info;
+    iface.read_file = Memory_ReadFile;
+    iface.write_file = Memory_WriteFile;
+    storage = SDL_OpenStorage(&iface, NULL);
+    if (!storage) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenStorage() failed: %s", SDL_GetError());
+        return false;
+    }
+
+    if (!SDL_WriteStorageFileAsync(storage, "memory.txt", text, SDL_strlen(text), queue, NULL) ||
+        !WaitForOutcome(queue, &outcome) || outcome.type != SDL_ASYNCIO_TASK_WRITE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Async write to memory storage failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    if (!SDL_ReadStorageFileAsync(storage, "memory.txt", queue, NULL) ||
+        !WaitForOutcome(queue, &outcome) || outcome.type != SDL_ASYNCIO_TASK_READ) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Async read from memory storage failed: %s", SDL_GetError());
+        goto done;
+    }
+    result = (SDL_strcmp((const char *)outcome.buffer, text) == 0);
+    SDL_free(outcome.buffer);
+    if (!result) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Memory storage returned the wrong contents");
+    }
+
+done:
+    SDL_CloseStorage(storage);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AsyncIOQueue *queue = NULL;
+    SDL_Storage *storage = NULL;
+    char path[32];
+    int result = 1;
+    int i, j;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
+        return 1;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < NUM_FILES; ++i) {
+        for (j = 0; j < FILE_SIZE; ++j) {
+            contents[i][j] = (Uint8)(i * 31 + j * 7);
+        }
+    }
+
+    queue = SDL_CreateAsyncIOQueue();
+    if (!queue) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateAsyncIOQueue() failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    storage = SDL_OpenFileStorage(".");
+    if (!storage) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenFileStorage() failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    if (TestFileStorage(storage, queue) && TestMemoryStorage(queue)) {
+        SDL_Log("All async storage tests passed");
+        result = 0;
+    }
+
+done:
+    for (i = 0; i < NUM_FILES; ++i) {
+        SDL_snprintf(path, sizeof(path), "storageasync%d.tmp", i);
+        SDL_RemoveStoragePath(storage, path);
+    }
+    SDL_CloseStorage(storage);
+    SDL_DestroyAsyncIOQueue(queue);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
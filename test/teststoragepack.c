@@ -0,0 +1,285 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Write a small .zip archive, open it with SDL_OpenPackStorage() and check
+   that path info, enumeration, globbing and reading all see its contents. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define TEST_FILENAME "storagepack.zip"
+
+#define LEVEL_TEXT "The quick brown fox jumps over the lazy dog. "
+
+/* LEVEL_TEXT repeated 8 times, raw deflate */
+static const Uint8 level_deflated[] = {
+    0x0b, 0xc9, 0x48, 0x55, 0x28, 0x2c, 0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53,
+    0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a, 0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x52, 0x28,
+    0x01, 0x4a, 0xe7, 0x24, 0x56, 0x55, 0x2a, 0xa4, 0xe4, 0xa7, 0xeb, 0x29, 0x84, 0x8c, 0x2a, 0x26,
+    0x57, 0x31, 0x00
+};
+
+typedef struct
+{
+    const char *name;
+    const void *data;       /* what's stored in the archive */
+    Uint32 data_len;
+    const void *contents;   /* what should come back out */
+    Uint32 size;
+    Uint16 method;
+    Uint32 offset;
+} ArchiveEntry;
+
+static char level_text[8 * sizeof(LEVEL_TEXT)];
+
+static ArchiveEntry entries[] = {
+    { "readme.txt", "Hello, world!", 13, "Hello, world!", 13, 0, 0 },
+    { "data/level1.txt", level_deflated, sizeof(level_deflated), level_text, 0, 8, 0 },
+    { "data/sub/x.bin", "\x01\x02\x03\x04", 4, "\x01\x02\x03\x04", 4, 0, 0 },
+    { "empty/", "", 0, "", 0, 0, 0 },
+};
+
+static Uint32 Crc32(const void *data, size_t len)
+{
+    const Uint8 *ptr = (const Uint8 *)data;
+    Uint32 crc = 0xFFFFFFFF;
+    size_t i;
+    int bit;
+
+    for (i = 0; i < len; ++i) {
+        crc ^= ptr[i];
+        for (bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static bool WriteHeader(SDL_IOStream *io, const ArchiveEntry *entry, bool central)
+{
+    const Uint16 name_len = (Uint16)SDL_strlen(entry->name);
+    bool result = true;
+
+    result = result && SDL_WriteU32LE(io, central ? 0x02014b50 : 0x04034b50);
+    if (central) {
+        result = result && SDL_WriteU16LE(io, 20); /* version made by */
+    }
+    result = result && SDL_WriteU16LE(io, 20);     /* version needed */
+    result = result && SDL_WriteU16LE(io, 0);      /* flags */
+    result = result && SDL_WriteU16LE(io, entry->method);
+    result = result && SDL_WriteU16LE(io, 0);      /* time */
+    result = result && SDL_WriteU16LE(io, (45 << 9) | (6 << 5) | 15); /* 2025-06-15 */
+    result = result && SDL_WriteU32LE(io, Crc32(entry->contents, entry->size));
+    result = result && SDL_WriteU32LE(io, entry->data_len);
+    result = result && SDL_WriteU32LE(io, entry->size);
+    result = result && SDL_WriteU16LE(io, name_len);
+    result = result && SDL_WriteU16LE(io, 0);      /* extra length */
+    if (central) {
+        result = result && SDL_WriteU16LE(io, 0);  /* comment length */
+        result = result && SDL_WriteU16LE(io, 0);  /* disk */
+        result = result && SDL_WriteU16LE(io, 0);  /* internal attributes */
+        result = result && SDL_WriteU32LE(io, 0);  /* external attributes */
+        result = result && SDL_WriteU32LE(io, entry->offset);
+    }
+    result = result && SDL_WriteIO(io, entry->name, name_len) == name_len;
+    return result;
+}
+
+static bool CreateArchive(void)
+{
+    SDL_IOStream *io = SDL_IOFromFile(TEST_FILENAME, "wb");
+    Uint32 cd_offset, cd_size;
+    bool result = true;
+    int i;
+
+    if (!io) {
+        return false;
+    }
+
+    for (i = 0; i < SDL_arraysize(entries); ++i) {
+        entries[i].offset = (Uint32)SDL_TellIO(io);
+        result = result && WriteHeader(io, &entries[i], false);
+        result = result && SDL_WriteIO(io, entries[i].data, entries[i].data_len) == entries[i].data_len;
+    }
+
+    cd_offset = (Uint32)SDL_TellIO(io);
+    for (i = 0; i < SDL_arraysize(entries); ++i) {
+        result = result && WriteHeader(io, &entries[i], true);
+    }
+    cd_size = (Uint32)SDL_TellIO(io) - cd_offset;
+
+    result = result && SDL_WriteU32LE(io, 0x06054b50);
+    result = result && SDL_WriteU16LE(io, 0);
+    result = result && SDL_WriteU16LE(io, 0);
+    result = result && SDL_WriteU16LE(io, SDL_arraysize(entries));
+    result = result && SDL_WriteU16LE(io, SDL_arraysize(entries));
+    result = result && SDL_WriteU32LE(io, cd_size);
+    result = result && SDL_WriteU32LE(io, cd_offset);
+    result = result && SDL_WriteU16LE(io, 0);
+
+    return SDL_CloseIO(io) && result;
+}
+
+static SDL_EnumerationResult SDLCALL CollectNames(void *userdata, const char *dirname, const char *fname)
+{
+    char *names = (char *)userdata;
+    SDL_strlcat(names, fname, 256);
+    SDL_strlcat(names, " ", 256);
+    return SDL_ENUM_CONTINUE;
+}
+
+static bool CheckPathType(SDL_Storage *storage, const char *path, SDL_PathType type, Uint64 size)
+{
+    SDL_PathInfo info;
+
+    if (!SDL_GetStoragePathInfo(storage, path, &info)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_GetStoragePathInfo(\"%s\") failed: %s", path, SDL_GetError());
+        return false;
+    }
+    if (info.type != type || info.size != size) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "\"%s\" has type %d size %" SDL_PRIu64 ", expected type %d size %" SDL_PRIu64,
+                     path, info.type, info.size, type, size);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckEnumerate(SDL_Storage *storage, const char *path, const char *expected)
+{
+    char names[256];
+
+    names[0] = '\0';
+    if (!SDL_EnumerateStorageDirectory(storage, path, CollectNames, names)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_EnumerateStorageDirectory(\"%s\") failed: %s", path, SDL_GetError());
+        return false;
+    }
+    if (SDL_strcmp(names, expected) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "\"%s\" contains \"%s\", expected \"%s\"", path, names, expected);
+        return false;
+    }
+    return true;
+}
+
+static bool RunTests(SDL_Storage *storage)
+{
+    char buffer[sizeof(level_text)];
+    char **globlist;
+    int count = 0;
+    int i;
+
+    if (!CheckPathType(storage, "", SDL_PATHTYPE_DIRECTORY, 0) ||
+        !CheckPathType(storage, "readme.txt", SDL_PATHTYPE_FILE, 13) ||
+        !CheckPathType(storage, "data", SDL_PATHTYPE_DIRECTORY, 0) ||
+        !CheckPathType(storage, "data/sub", SDL_PATHTYPE_DIRECTORY, 0) ||
+        !CheckPathType(storage, "data/level1.txt", SDL_PATHTYPE_FILE, entries[1].size) ||
+        !CheckPathType(storage, "empty", SDL_PATHTYPE_DIRECTORY, 0)) {
+        return false;
+    }
+    if (SDL_GetStoragePathInfo(storage, "missing.txt", NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Found a file that isn't in the archive");
+        return false;
+    }
+
+    if (!CheckEnumerate(storage, NULL, "data empty readme.txt ") ||
+        !CheckEnumerate(storage, "data", "level1.txt sub ") ||
+        !CheckEnumerate(storage, "data/sub", "x.bin ") ||
+        !CheckEnumerate(storage, "empty", "")) {
+        return false;
+    }
+
+    globlist = SDL_GlobStorageDirectory(storage, NULL, "*/*.txt", 0, &count);
+    if (!globlist || count != 1 || SDL_strcmp(globlist[0], "data/level1.txt") != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_GlobStorageDirectory() returned %d entries: %s", count, SDL_GetError());
+        SDL_free(globlist);
+        return false;
+    }
+    SDL_free(globlist);
+
+    for (i = 0; i < SDL_arraysize(entries); ++i) {
+        const ArchiveEntry *entry = &entries[i];
+        if (entry->name[SDL_strlen(entry->name) - 1] == '/') {
+            continue;
+        }
+        SDL_memset(buffer, 0, sizeof(buffer));
+        if (!SDL_ReadStorageFile(storage, entry->name, buffer, entry->size)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadStorageFile(\"%s\") failed: %s", entry->name, SDL_GetError());
+            return false;
+        }
+        if (SDL_memcmp(buffer, entry->contents, entry->size) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "\"%s\" has the wrong contents", entry->name);
+            return false;
+        }
+    }
+
+    if (SDL_ReadStorageFile(storage, "readme.txt", buffer, 5)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reading with the wrong length succeeded");
+        return false;
+    }
+    if (SDL_WriteStorageFile(storage, "new.txt", "x", 1)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Writing to an archive succeeded");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Storage *storage = NULL;
+    int result = 1;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
+        return 1;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < 8; ++i) {
+        SDL_strlcat(level_text, LEVEL_TEXT, sizeof(level_text));
+    }
+    entries[1].size = (Uint32)SDL_strlen(level_text);
+
+    if (!CreateArchive()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create %s: %s", TEST_FILENAME, SDL_GetError());
+        goto done;
+    }
+
+    storage = SDL_OpenPackStorage(TEST_FILENAME);
+    if (!storage) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenPackStorage() failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    if (RunTests(storage)) {
+        SDL_Log("All pack storage tests passed");
+        result = 0;
+    }
+
+done:
+    SDL_CloseStorage(storage);
+    SDL_RemovePath(TEST_FILENAME);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
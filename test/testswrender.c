@@ -0,0 +1,287 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measure the frame rate of the software renderer with a few testsprite
+   style scenes, drawn into an offscreen surface with
+   SDL_HINT_RENDER_SOFTWARE_THREADS set to each of the requested values.
+
+   Every run has to draw exactly the same image as the first one, so this
+   doubles as a check of the tile-parallel drawing. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SPRITE_SIZE 32
+#define MAX_THREAD_COUNTS 8
+
+typedef enum
+{
+    SCENE_SPRITES,
+    SCENE_FILLS,
+    SCENE_GEOMETRY,
+    NUM_SCENES
+} Scene;
+
+static const char *scene_names[NUM_SCENES] = {
+    "sprites",
+    "fills",
+    "geometry",
+};
+
+static int width = 1280;
+static int height = 720;
+static int num_sprites = 1000;
+static int num_frames = 100;
+
+static SDL_Texture *CreateSprite(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface = SDL_CreateSurface(SPRITE_SIZE, SPRITE_SIZE, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Texture *texture;
+    int x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const int dx = 2 * x - SPRITE_SIZE + 1;
+            const int dy = 2 * y - SPRITE_SIZE + 1;
+            const int d = dx * dx + dy * dy;
+            const int r = SPRITE_SIZE * SPRITE_SIZE;
+            /* A ball with a soft edge and a transparent outside */
+            const Uint32 a = (d >= r) ? 0 : (d < r / 2) ? 255 : (Uint32)(255 * 2 * (r - d) / r);
+            row[x] = (a << 24) | ((Uint32)(x * 8) << 16) | ((Uint32)(y * 8) << 8) | 0xC0;
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void GetSpritePosition(Uint64 *seed, int frame, float *x, float *y)
+{
+    const int range_x = width - SPRITE_SIZE;
+    const int range_y = height - SPRITE_SIZE;
+    const int vx = SDL_rand_r(seed, 7) - 3;
+    const int vy = SDL_rand_r(seed, 7) - 3;
+    int px = SDL_rand_r(seed, range_x) + vx * frame;
+    int py = SDL_rand_r(seed, range_y) + vy * frame;
+
+    px %= range_x;
+    py %= range_y;
+    *x = (float)(px < 0 ? px + range_x : px);
+    *y = (float)(py < 0 ? py + range_y : py);
+}
+
+static void DrawFrame(SDL_Renderer *renderer, SDL_Texture *sprite, Scene scene, int frame)
+{
+    static const int indices[] = { 0, 1, 2, 1, 2, 3 };
+    Uint64 seed = 42;
+    int i, j;
+
+    SDL_SetRenderDrawColor(renderer, 0xA0, 0xA0, 0xA0, 0xFF);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_FRect rect;
+
+        GetSpritePosition(&seed, frame, &rect.x, &rect.y);
+        rect.w = SPRITE_SIZE;
+        rect.h = SPRITE_SIZE;
+
+        switch (scene) {
+        case SCENE_SPRITES:
+            SDL_RenderTexture(renderer, sprite, NULL, &rect);
+            break;
+
+        case SCENE_FILLS:
+            SDL_SetRenderDrawColor(renderer, (Uint8)(i * 7), (Uint8)(i * 13), (Uint8)(i * 29), 0x80);
+            SDL_RenderFillRect(renderer, &rect);
+            break;
+
+        case SCENE_GEOMETRY:
+        {
+            const float angle = (float)(frame + i) * 0.05f;
+            const float c = SDL_cosf(angle) * SPRITE_SIZE * 0.7f;
+            const float s = SDL_sinf(angle) * SPRITE_SIZE * 0.7f;
+            SDL_Vertex verts[4];
+
+            for (j = 0; j < 4; ++j) {
+                const float u = (j & 1) ? 1.0f : 0.0f;
+                const float v = (j & 2) ? 1.0f : 0.0f;
+                verts[j].position.x = rect.x + SPRITE_SIZE / 2 + (u - 0.5f) * c - (v - 0.5f) * s;
+                verts[j].position.y = rect.y + SPRITE_SIZE / 2 + (u - 0.5f) * s + (v - 0.5f) * c;
+                verts[j].color.r = 1.0f;
+                verts[j].color.g = (j & 1) ? 1.0f : 0.5f;
+                verts[j].color.b = (j & 2) ? 1.0f : 0.5f;
+                verts[j].color.a = 1.0f;
+                verts[j].tex_coord.x = u;
+                verts[j].tex_coord.y = v;
+            }
+            SDL_RenderGeometry(renderer, (i & 1) ? sprite : NULL, verts, 4, indices, SDL_arraysize(indices));
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+}
+
+static SDL_Surface *RunScene(Scene scene, const char *threads)
+{
+    SDL_Surface *surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *sprite = NULL;
+    Uint64 start, elapsed;
+    int frame;
+
+    if (!surface) {
+        goto failed;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads);
+    renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!renderer) {
+        goto failed;
+    }
+    sprite = CreateSprite(renderer);
+    if (!sprite) {
+        goto failed;
+    }
+
+    start = SDL_GetTicksNS();
+    for (frame = 0; frame < num_frames; ++frame) {
+        DrawFrame(renderer, sprite, scene, frame);
+        SDL_FlushRenderer(renderer);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    SDL_Log("%-10s threads %-3s %8.1f frames/s", scene_names[scene], threads,
+            (double)num_frames * SDL_NS_PER_SECOND / (double)elapsed);
+
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    return surface;
+
+failed:
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run %s with %s threads: %s", scene_names[scene], threads, SDL_GetError());
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+    return NULL;
+}
+
+static bool SameImage(SDL_Surface *a, SDL_Surface *b)
+{
+    int y;
+
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, a->w * 4) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const char *thread_counts[MAX_THREAD_COUNTS];
+    int num_thread_counts = 0;
+    int result = 0;
+    int i, scene;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--width") == 0 && argv[i + 1]) {
+                width = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--height") == 0 && argv[i + 1]) {
+                height = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+                num_sprites = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                num_frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1] && num_thread_counts < MAX_THREAD_COUNTS) {
+                thread_counts[num_thread_counts++] = argv[i + 1];
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || width <= SPRITE_SIZE || height <= SPRITE_SIZE || num_sprites < 0 || num_frames <= 0) {
+            static const char *options[] = { "[--width W]", "[--height H]", "[--sprites N]", "[--frames N]", "[--threads N]...", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    /* Compare the calling thread against all cores by default */
+    if (num_thread_counts == 0) {
+        thread_counts[num_thread_counts++] = "1";
+        thread_counts[num_thread_counts++] = "0";
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Drawing %d sprites at %dx%d, %d frames per run, %d logical cores",
+            num_sprites, width, height, num_frames, SDL_GetNumLogicalCPUCores());
+
+    for (scene = 0; scene < NUM_SCENES; ++scene) {
+        SDL_Surface *reference = NULL;
+
+        for (i = 0; i < num_thread_counts; ++i) {
+            SDL_Surface *surface = RunScene((Scene)scene, thread_counts[i]);
+            if (!surface) {
+                result = 1;
+                continue;
+            }
+            if (!reference) {
+                reference = surface;
+                continue;
+            }
+            if (!SameImage(reference, surface)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s with %s threads doesn't match the first run", scene_names[scene], thread_counts[i]);
+                result = 1;
+            }
+            SDL_DestroySurface(surface);
+        }
+        SDL_DestroySurface(reference);
+    }
+
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -72,6 +72,86 @@ callback(void *param, SDL_TimerID timerID, Uint32 interval)
     return interval;
 }
 
+#define NUM_JITTER_TIMERS 10000
+
+typedef struct
+{
+    Uint64 expected;
+    Uint64 calls;
+    Uint64 total_late;
+    Uint64 max_late;
+} JitterTimerData;
+
+static Uint64 SDLCALL
+jitterNS(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    JitterTimerData *data = (JitterTimerData *)param;
+    Uint64 now = SDL_GetTicksNS();
+
+    if (now > data->expected) {
+        Uint64 late = now - data->expected;
+        data->total_late += late;
+        if (late > data->max_late) {
+            data->max_late = late;
+        }
+    }
+    ++data->calls;
+    data->expected = now + interval;
+    return interval;
+}
+
+static void test_timer_jitter(void)
+{
+    JitterTimerData *data;
+    SDL_TimerID *ids;
+    Uint64 start, now, calls = 0, total_late = 0, max_late = 0;
+    int i;
+
+    data = (JitterTimerData *)SDL_calloc(NUM_JITTER_TIMERS, sizeof(*data));
+    ids = (SDL_TimerID *)SDL_calloc(NUM_JITTER_TIMERS, sizeof(*ids));
+    if (!data || !ids) {
+        SDL_free(data);
+        SDL_free(ids);
+        return;
+    }
+
+    SDL_Log("Testing scheduling jitter with %d timers...", NUM_JITTER_TIMERS);
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_JITTER_TIMERS; ++i) {
+        /* Spread the intervals between 10 and 100 ms so timers expire in overlapping groups */
+        Uint64 interval = SDL_MS_TO_NS(10 + (i % 91));
+        data[i].expected = SDL_GetTicksNS() + interval;
+        ids[i] = SDL_AddTimerNS(interval, jitterNS, &data[i]);
+    }
+    now = SDL_GetTicksNS();
+    SDL_Log("Adding %d timers took %f ms", NUM_JITTER_TIMERS, (double)(now - start) / SDL_NS_PER_MS);
+
+    SDL_Delay(1000);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_JITTER_TIMERS; ++i) {
+        SDL_RemoveTimer(ids[i]);
+    }
+    now = SDL_GetTicksNS();
+    SDL_Log("Removing %d timers took %f ms", NUM_JITTER_TIMERS, (double)(now - start) / SDL_NS_PER_MS);
+
+    /* Let any callback that was already running finish before reading the results */
+    SDL_Delay(100);
+
+    for (i = 0; i < NUM_JITTER_TIMERS; ++i) {
+        calls += data[i].calls;
+        total_late += data[i].total_late;
+        if (data[i].max_late > max_late) {
+            max_late = data[i].max_late;
+        }
+    }
+    SDL_Log("%" SDL_PRIu64 " timer callbacks, average lateness %f ms, maximum lateness %f ms",
+            calls, calls ? (double)total_late / calls / SDL_NS_PER_MS : 0.0, (double)max_late / SDL_NS_PER_MS);
+
+    SDL_free(data);
+    SDL_free(ids);
+}
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -261,6 +341,8 @@ int main(int argc, char *argv[])
     SDL_RemoveTimer(t2);
     SDL_RemoveTimer(t3);
 
+    test_timer_jitter();
+
     ticks = 0;
     start_perf = SDL_GetPerformanceCounter();
     for (i = 0; i < 1000000; ++i) {